@@ -193,6 +193,8 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual Span<uint8_t> get_buffer_view(uint64_t p_length) const { return Span<uint8_t>(); } ///< get a read-only view of the next bytes without copying, or an empty span if unsupported. Advances the position on success, valid until the file is closed.
+	virtual Span<uint8_t> map_contents() { return Span<uint8_t>(); } ///< map the whole file read-only, or return an empty span if unsupported. The mapping stays valid until the file is closed.
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
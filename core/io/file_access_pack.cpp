@@ -30,8 +30,10 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/compression.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_patched.h"
+#include "core/io/marshalls.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/version.h"
@@ -46,7 +48,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_bundle, bool p_delta, const String &p_salt) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_bundle, bool p_delta, const String &p_salt, bool p_compressed) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -56,6 +58,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 	pf.encrypted = p_encrypted;
 	pf.bundle = p_bundle;
 	pf.delta = p_delta;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.salt = p_salt;
 	pf.offset = p_ofs;
@@ -292,7 +295,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	uint32_t ver_minor = f->get_32();
 	uint32_t ver_patch = f->get_32(); // Not used for validation.
 
-	ERR_FAIL_COND_V_MSG(version != PACK_FORMAT_VERSION_V4 && version != PACK_FORMAT_VERSION_V3 && version != PACK_FORMAT_VERSION_V2, false, vformat("Pack version unsupported: %d.", version));
+	ERR_FAIL_COND_V_MSG(version != PACK_FORMAT_VERSION_V5 && version != PACK_FORMAT_VERSION_V4 && version != PACK_FORMAT_VERSION_V3 && version != PACK_FORMAT_VERSION_V2, false, vformat("Pack version unsupported: %d.", version));
 	ERR_FAIL_COND_V_MSG(ver_major > GODOT_VERSION_MAJOR || (ver_major == GODOT_VERSION_MAJOR && ver_minor > GODOT_VERSION_MINOR), false, vformat("Pack created with a newer version of the engine: %d.%d.%d.", ver_major, ver_minor, ver_patch));
 
 	uint32_t pack_flags = f->get_32();
@@ -302,15 +305,15 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	String salt;
 
 	uint64_t file_base = f->get_64();
-	if ((version == PACK_FORMAT_VERSION_V4) || (version == PACK_FORMAT_VERSION_V3) || (version == PACK_FORMAT_VERSION_V2 && rel_filebase)) {
+	if ((version == PACK_FORMAT_VERSION_V5) || (version == PACK_FORMAT_VERSION_V4) || (version == PACK_FORMAT_VERSION_V3) || (version == PACK_FORMAT_VERSION_V2 && rel_filebase)) {
 		file_base += pck_start_pos;
 	}
 
-	if (version == PACK_FORMAT_VERSION_V3 || version == PACK_FORMAT_VERSION_V4) {
-		// V3/V4: Read directory offset and skip reserved part of the header.
+	if (version >= PACK_FORMAT_VERSION_V3) {
+		// V3+: Read directory offset and skip reserved part of the header.
 		uint64_t dir_offset = f->get_64() + pck_start_pos;
-		if (sparse_bundle && enc_directory && version == PACK_FORMAT_VERSION_V4) {
-			// V4: Read encrypted directory salt.
+		if (sparse_bundle && enc_directory && version >= PACK_FORMAT_VERSION_V4) {
+			// V4+: Read encrypted directory salt.
 			Vector<uint8_t> salt_data = f->get_buffer(32);
 			salt.append_latin1(Span((const char *)salt_data.ptr(), salt_data.size()));
 		}
@@ -366,13 +369,43 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		if (flags & PACK_FILE_REMOVAL) { // The file was removed.
 			PackedData::get_singleton()->remove_path(path);
 		} else {
-			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), sparse_bundle, (flags & PACK_FILE_DELTA), salt);
+			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), sparse_bundle, (flags & PACK_FILE_DELTA), salt, (flags & PACK_FILE_COMPRESSED));
 		}
 	}
 
+	if (!sparse_bundle) {
+		_map_pack(p_path);
+	}
+
 	return true;
 }
 
+void PackedSourcePCK::_map_pack(const String &p_path) {
+	// Platforms without file mapping keep reading packs through regular file access.
+	Span<uint8_t> data;
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+	if (file.is_valid()) {
+		data = file->map_contents();
+	}
+
+	MutexLock lock(mappings_mutex);
+	HashMap<String, PackMapping>::Iterator E = mappings.find(p_path);
+	if (E) {
+		// The pack may have changed on disk, files opened before keep using the previous mapping.
+		replaced_mappings.push_back(E->value.file);
+		mappings.remove(E);
+	}
+	if (!data.is_empty()) {
+		mappings.insert(p_path, { file, data });
+	}
+}
+
+Span<uint8_t> PackedSourcePCK::get_pack_mapping(const String &p_pack) {
+	MutexLock lock(mappings_mutex);
+	const PackMapping *mapping = mappings.getptr(p_pack);
+	return mapping ? mapping->data : Span<uint8_t>();
+}
+
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file, const Vector<uint8_t> &p_decryption_key) {
 	Ref<FileAccess> file(memnew(FileAccessPack(p_path, *p_file, p_decryption_key)));
 
@@ -449,7 +482,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!pf.compressed && pack_mapping.is_empty()) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -483,16 +518,52 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
+	uint64_t from = pos;
 	pos += to_read;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+	if (pf.compressed) {
+		return _read_compressed(p_dst, from, to_read);
+	}
+	if (!pack_mapping.is_empty()) {
+		memcpy(p_dst, pack_mapping.ptr() + off + from, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+Span<uint8_t> FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), Span<uint8_t>(), "File must be opened before use.");
+
+	// Views never cross the end of the packed file, short reads go through get_buffer().
+	if (eof || p_length == 0 || p_length > pf.size - pos) {
+		return Span<uint8_t>();
+	}
+
+	// Decompressed chunks can be evicted from the cache while the view is alive.
+	if (pf.compressed) {
+		return Span<uint8_t>();
+	}
+
+	// Plain files are viewed straight from the shared pack mapping.
+	if (!pack_mapping.is_empty()) {
+		Span<uint8_t> view(pack_mapping.ptr() + off + pos, p_length);
+		pos += p_length;
+		return view;
+	}
+
+	// Encrypted files are viewed from their decrypted buffer, loose files of sparse bundles aren't viewed.
+	Span<uint8_t> view = f->get_buffer_view(p_length);
+	if (view.size() == p_length) {
+		pos += p_length;
+	}
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -521,6 +592,128 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	pack_mapping = Span<uint8_t>();
+	chunk_cache.clear();
+}
+
+// Compressed file layout, offsets are relative to the start of the file data:
+//   uint32 chunk_size, uint32 chunk_count
+//   uint64 chunk_offsets[chunk_count + 1], chunk i is stored in [chunk_offsets[i], chunk_offsets[i + 1])
+//   chunk data, zstd compressed, or stored as-is when it doesn't shrink.
+// Every chunk but the last one decompresses to chunk_size bytes.
+
+Vector<uint8_t> FileAccessPack::compress_chunks(const uint8_t *p_data, uint64_t p_size, uint32_t p_chunk_size) {
+	ERR_FAIL_COND_V(p_chunk_size == 0, Vector<uint8_t>());
+	ERR_FAIL_COND_V(!p_data && p_size > 0, Vector<uint8_t>());
+
+	const uint64_t chunk_count = (p_size + p_chunk_size - 1) / p_chunk_size;
+	ERR_FAIL_COND_V(chunk_count >= UINT32_MAX, Vector<uint8_t>());
+
+	const uint64_t index_size = 8 + (chunk_count + 1) * 8;
+	if (index_size >= p_size) {
+		return Vector<uint8_t>(); // Too small to benefit.
+	}
+
+	Vector<uint8_t> out;
+	out.resize(index_size);
+	encode_uint32(p_chunk_size, out.ptrw());
+	encode_uint32(chunk_count, out.ptrw() + 4);
+
+	Vector<uint8_t> compressed;
+	compressed.resize(Compression::get_max_compressed_buffer_size(p_chunk_size, Compression::MODE_ZSTD));
+
+	for (uint64_t i = 0; i < chunk_count; i++) {
+		const uint8_t *src = p_data + i * p_chunk_size;
+		const int64_t size = MIN((uint64_t)p_chunk_size, p_size - i * p_chunk_size);
+		const int64_t compressed_size = Compression::compress(compressed.ptrw(), src, size, Compression::MODE_ZSTD);
+
+		const int64_t ofs = out.size();
+		encode_uint64(ofs, out.ptrw() + 8 + i * 8);
+		if (compressed_size > 0 && compressed_size < size) {
+			out.resize(ofs + compressed_size);
+			memcpy(out.ptrw() + ofs, compressed.ptr(), compressed_size);
+		} else {
+			out.resize(ofs + size);
+			memcpy(out.ptrw() + ofs, src, size);
+		}
+	}
+	encode_uint64(out.size(), out.ptrw() + 8 + chunk_count * 8);
+
+	if ((uint64_t)out.size() >= p_size) {
+		return Vector<uint8_t>(); // Not worth it, store as-is.
+	}
+	return out;
+}
+
+bool FileAccessPack::_read_chunk_index() {
+	f->seek(off);
+	chunk_size = f->get_32();
+	uint32_t chunk_count = f->get_32();
+	ERR_FAIL_COND_V(chunk_size == 0, false);
+	ERR_FAIL_COND_V((uint64_t)chunk_count != (pf.size + chunk_size - 1) / chunk_size, false);
+
+	chunk_offsets.resize(chunk_count + 1);
+	for (uint32_t i = 0; i <= chunk_count; i++) {
+		chunk_offsets[i] = f->get_64();
+		ERR_FAIL_COND_V(i > 0 && chunk_offsets[i] < chunk_offsets[i - 1], false);
+	}
+	return !f->eof_reached();
+}
+
+const Vector<uint8_t> *FileAccessPack::_get_chunk(uint32_t p_chunk) const {
+	const Vector<uint8_t> *cached = chunk_cache.getptr(p_chunk);
+	if (cached) {
+		return cached;
+	}
+
+	ERR_FAIL_UNSIGNED_INDEX_V(p_chunk, chunk_offsets.size() - 1, nullptr);
+	const uint64_t stored_size = chunk_offsets[p_chunk + 1] - chunk_offsets[p_chunk];
+	const uint64_t size = MIN((uint64_t)chunk_size, pf.size - (uint64_t)p_chunk * chunk_size);
+
+	Vector<uint8_t> data;
+	data.resize(size);
+
+	Span<uint8_t> src;
+	if (off + chunk_offsets[p_chunk + 1] <= pack_mapping.size()) {
+		src = Span<uint8_t>(pack_mapping.ptr() + off + chunk_offsets[p_chunk], stored_size);
+	} else {
+		f->seek(off + chunk_offsets[p_chunk]);
+	}
+
+	if (stored_size == size) {
+		// Stored as-is.
+		if (!src.is_empty()) {
+			memcpy(data.ptrw(), src.ptr(), size);
+		} else {
+			ERR_FAIL_COND_V(f->get_buffer(data.ptrw(), size) != size, nullptr);
+		}
+	} else {
+		if (src.is_empty()) {
+			chunk_read_buffer.resize(stored_size);
+			ERR_FAIL_COND_V(f->get_buffer(chunk_read_buffer.ptrw(), stored_size) != stored_size, nullptr);
+			src = chunk_read_buffer.span();
+		}
+		const int64_t result = Compression::decompress(data.ptrw(), size, src.ptr(), src.size(), Compression::MODE_ZSTD);
+		ERR_FAIL_COND_V_MSG(result != (int64_t)size, nullptr, vformat(R"(Corrupted chunk %d in pack-referenced file "%s".)", p_chunk, path));
+	}
+
+	return &chunk_cache.insert(p_chunk, data)->data;
+}
+
+uint64_t FileAccessPack::_read_compressed(uint8_t *p_dst, uint64_t p_from, uint64_t p_length) const {
+	uint64_t read = 0;
+	while (read < p_length) {
+		const uint64_t position = p_from + read;
+		const uint32_t chunk = position / chunk_size;
+		const Vector<uint8_t> *data = _get_chunk(chunk);
+		ERR_FAIL_NULL_V(data, read);
+
+		const uint64_t chunk_pos = position - (uint64_t)chunk * chunk_size;
+		const uint64_t count = MIN(p_length - read, data->size() - chunk_pos);
+		memcpy(p_dst + read, data->ptr() + chunk_pos, count);
+		read += count;
+	}
+	return read;
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Vector<uint8_t> &p_decryption_key) {
@@ -548,6 +741,13 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		ERR_FAIL_COND_MSG(f.is_null(), vformat(R"(Can't open pack-referenced file "%s" from pack "%s".)", p_path, pf.pack));
 		f->seek(pf.offset);
 		off = pf.offset;
+
+		if (!pf.encrypted && pf.src) {
+			pack_mapping = pf.src->get_pack_mapping(pf.pack);
+			if (!pf.compressed && pf.offset + pf.size > pack_mapping.size()) {
+				pack_mapping = Span<uint8_t>(); // Truncated pack, let regular reads report the error.
+			}
+		}
 	}
 
 	if (pf.encrypted) {
@@ -575,6 +775,14 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
+
+	if (pf.compressed) {
+		chunk_cache.set_capacity(CHUNK_CACHE_SIZE);
+		if (!_read_chunk_index()) {
+			f = Ref<FileAccess>();
+			ERR_FAIL_MSG(vformat(R"(Can't read the chunk index of compressed pack-referenced file "%s" from pack "%s".)", p_path, pf.pack));
+		}
+	}
 	pos = 0;
 	eof = false;
 }
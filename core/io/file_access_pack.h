@@ -32,9 +32,12 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/lru.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
@@ -42,9 +45,13 @@
 #define PACK_FORMAT_VERSION_V2 2
 #define PACK_FORMAT_VERSION_V3 3
 #define PACK_FORMAT_VERSION_V4 4
+#define PACK_FORMAT_VERSION_V5 5
 
 // The current packed file format version number.
-#define PACK_FORMAT_VERSION PACK_FORMAT_VERSION_V4
+#define PACK_FORMAT_VERSION PACK_FORMAT_VERSION_V5
+
+// Uncompressed size of the independently decompressible chunks of compressed files.
+#define PACK_COMPRESSED_CHUNK_SIZE (64 * 1024)
 
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0,
@@ -56,6 +63,7 @@ enum PackFileFlags {
 	PACK_FILE_ENCRYPTED = 1 << 0,
 	PACK_FILE_REMOVAL = 1 << 1,
 	PACK_FILE_DELTA = 1 << 2,
+	PACK_FILE_COMPRESSED = 1 << 3, // V5 and later.
 };
 
 class PackSource;
@@ -75,6 +83,7 @@ public:
 		bool encrypted;
 		bool bundle;
 		bool delta;
+		bool compressed = false;
 		String salt;
 	};
 
@@ -121,7 +130,7 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_bundle = false, bool p_delta = false, const String &p_salt = String()); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_bundle = false, bool p_delta = false, const String &p_salt = String(), bool p_compressed = false); // for PackSource
 	void remove_path(const String &p_path);
 	uint8_t *get_file_hash(const String &p_path);
 	Vector<PackedFile> get_delta_patches(const String &p_path) const;
@@ -152,13 +161,27 @@ class PackSource {
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) = 0;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) = 0;
+	virtual Span<uint8_t> get_pack_mapping(const String &p_pack) { return Span<uint8_t>(); } ///< read-only mapping of a whole pack shared by its files, or an empty span if it isn't mapped.
 	virtual ~PackSource() {}
 };
 
 class PackedSourcePCK : public PackSource {
+	// Each pack is mapped once and the mapping is shared by all the files opened from it.
+	// Mappings are only released with the source, views handed out by open files may still point into them.
+	struct PackMapping {
+		Ref<FileAccess> file;
+		Span<uint8_t> data;
+	};
+	Mutex mappings_mutex;
+	HashMap<String, PackMapping> mappings;
+	LocalVector<Ref<FileAccess>> replaced_mappings;
+
+	void _map_pack(const String &p_path);
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) override;
+	virtual Span<uint8_t> get_pack_mapping(const String &p_pack) override;
 };
 
 class PackedSourceDirectory : public PackSource {
@@ -179,6 +202,21 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+
+	// Mapping of the whole pack owned by the source, set for unencrypted files of regular packs.
+	Span<uint8_t> pack_mapping;
+
+	// Compressed files are split in chunks, see compress_chunks() for the layout.
+	static constexpr int CHUNK_CACHE_SIZE = 4;
+	uint32_t chunk_size = 0;
+	LocalVector<uint64_t> chunk_offsets;
+	mutable LRUCache<uint32_t, Vector<uint8_t>> chunk_cache;
+	mutable Vector<uint8_t> chunk_read_buffer;
+
+	bool _read_chunk_index();
+	const Vector<uint8_t> *_get_chunk(uint32_t p_chunk) const;
+	uint64_t _read_compressed(uint8_t *p_dst, uint64_t p_from, uint64_t p_length) const;
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual uint64_t _get_access_time(const String &p_file) override { return 0; }
@@ -205,6 +243,7 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_buffer_view(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -218,6 +257,8 @@ public:
 
 	virtual void close() override;
 
+	static Vector<uint8_t> compress_chunks(const uint8_t *p_data, uint64_t p_size, uint32_t p_chunk_size = PACK_COMPRESSED_CHUNK_SIZE);
+
 	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>());
 };
 
@@ -36,9 +36,26 @@
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
 
+// SSE2 is part of the baseline on x86_64 and NEON on ARM64. The mipmap kernels below do
+// the same integer and float operations as the scalar code, so their output is identical.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMAGE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define IMAGE_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(IMAGE_SSE2) || defined(IMAGE_NEON)
+static constexpr bool IMAGE_SIMD_MIPMAPS = true;
+#else
+static constexpr bool IMAGE_SIMD_MIPMAPS = false;
+#endif
+
 const char *Image::format_names[Image::FORMAT_MAX] = {
 	"Lum8",
 	"LumAlpha8",
@@ -116,6 +133,7 @@ Vector<uint8_t> (*Image::png_packer)(const Ref<Image> &) = nullptr;
 Vector<uint8_t> (*Image::basis_universal_packer)(const Ref<Image> &, Image::UsedChannels, const BasisUniversalPackerParams &) = nullptr;
 
 Ref<Image> (*Image::webp_unpacker)(const Vector<uint8_t> &) = nullptr;
+Ref<Image> (*Image::webp_unpacker_ptr)(const uint8_t *, int) = nullptr;
 Ref<Image> (*Image::png_unpacker)(const Vector<uint8_t> &) = nullptr;
 Ref<Image> (*Image::basis_universal_unpacker)(const Vector<uint8_t> &) = nullptr;
 Ref<Image> (*Image::basis_universal_unpacker_ptr)(const uint8_t *, int) = nullptr;
@@ -492,67 +510,109 @@ int Image::get_mipmap_count() const {
 	}
 }
 
+// Large images are processed in blocks of rows on the WorkerThreadPool. Every row is computed
+// exactly like in a serial loop, so the output doesn't depend on how the rows are split.
+static constexpr uint64_t IMAGE_ROW_BLOCK_ELEMENTS = 64 * 1024;
+
+template <typename F>
+struct ImageRowBlocks {
+	const F *func = nullptr;
+	uint32_t rows = 0;
+	uint32_t rows_per_block = 0;
+
+	void process(uint32_t p_block, void *p_userdata) {
+		const uint32_t from = p_block * rows_per_block;
+		(*func)(from, MIN(from + rows_per_block, rows));
+	}
+};
+
+// Calls `p_func(from, to)` on disjoint row ranges covering `[0, p_rows)`.
+template <typename F>
+static void _process_row_blocks(uint32_t p_rows, uint64_t p_elements_per_row, const F &p_func) {
+	const uint32_t rows_per_block = MAX(IMAGE_ROW_BLOCK_ELEMENTS / MAX(p_elements_per_row, (uint64_t)1), (uint64_t)1);
+	const uint32_t blocks = (p_rows + rows_per_block - 1) / rows_per_block;
+
+	// Waiting for a group blocks the calling thread, so pool threads stay serial to avoid starving the pool.
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (blocks < 2 || !pool || pool->get_thread_count() < 2 || pool->get_thread_index() != -1) {
+		p_func(0, p_rows);
+		return;
+	}
+
+	ImageRowBlocks<F> row_blocks;
+	row_blocks.func = &p_func;
+	row_blocks.rows = p_rows;
+	row_blocks.rows_per_block = rows_per_block;
+
+	WorkerThreadPool::GroupID group = pool->add_template_group_task(&row_blocks, &ImageRowBlocks<F>::process, (void *)nullptr, blocks, -1, true, SNAME("ImageProcessRows"));
+	pool->wait_for_group_task_completion(group);
+}
+
 // Using template generates perfectly optimized code due to constant expression reduction and unused variable removal present in all compilers.
 template <uint32_t read_bytes, bool read_alpha, uint32_t write_bytes, bool write_alpha, bool read_gray, bool write_gray>
 static void _convert(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
 	constexpr uint32_t max_bytes = MAX(read_bytes, write_bytes);
 
-	for (int y = 0; y < p_height; y++) {
-		for (int x = 0; x < p_width; x++) {
-			const uint8_t *rofs = &p_src[((y * p_width) + x) * (read_bytes + (read_alpha ? 1 : 0))];
-			uint8_t *wofs = &p_dst[((y * p_width) + x) * (write_bytes + (write_alpha ? 1 : 0))];
+	_process_row_blocks(p_height, p_width, [&](uint32_t p_from, uint32_t p_to) {
+		for (int y = p_from; y < (int)p_to; y++) {
+			for (int x = 0; x < p_width; x++) {
+				const uint8_t *rofs = &p_src[((y * p_width) + x) * (read_bytes + (read_alpha ? 1 : 0))];
+				uint8_t *wofs = &p_dst[((y * p_width) + x) * (write_bytes + (write_alpha ? 1 : 0))];
 
-			uint8_t rgba[4] = { 0, 0, 0, 255 };
+				uint8_t rgba[4] = { 0, 0, 0, 255 };
 
-			if constexpr (read_gray) {
-				rgba[0] = rofs[0];
-				rgba[1] = rofs[0];
-				rgba[2] = rofs[0];
-			} else {
-				for (uint32_t i = 0; i < max_bytes; i++) {
-					rgba[i] = (i < read_bytes) ? rofs[i] : 0;
+				if constexpr (read_gray) {
+					rgba[0] = rofs[0];
+					rgba[1] = rofs[0];
+					rgba[2] = rofs[0];
+				} else {
+					for (uint32_t i = 0; i < max_bytes; i++) {
+						rgba[i] = (i < read_bytes) ? rofs[i] : 0;
+					}
 				}
-			}
 
-			if constexpr (read_alpha || write_alpha) {
-				rgba[3] = read_alpha ? rofs[read_bytes] : 255;
-			}
+				if constexpr (read_alpha || write_alpha) {
+					rgba[3] = read_alpha ? rofs[read_bytes] : 255;
+				}
 
-			if constexpr (write_gray) {
-				// REC.709
-				const uint8_t luminance = (13938U * rgba[0] + 46869U * rgba[1] + 4729U * rgba[2] + 32768U) >> 16U;
-				wofs[0] = luminance;
-			} else {
-				for (uint32_t i = 0; i < write_bytes; i++) {
-					wofs[i] = rgba[i];
+				if constexpr (write_gray) {
+					// REC.709
+					const uint8_t luminance = (13938U * rgba[0] + 46869U * rgba[1] + 4729U * rgba[2] + 32768U) >> 16U;
+					wofs[0] = luminance;
+				} else {
+					for (uint32_t i = 0; i < write_bytes; i++) {
+						wofs[i] = rgba[i];
+					}
 				}
-			}
 
-			if constexpr (write_alpha) {
-				wofs[write_bytes] = rgba[3];
+				if constexpr (write_alpha) {
+					wofs[write_bytes] = rgba[3];
+				}
 			}
 		}
-	}
+	});
 }
 
 template <typename T, uint32_t read_channels, uint32_t write_channels, T def_zero, T def_one>
 static void _convert_fast(int p_width, int p_height, const T *p_src, T *p_dst) {
-	uint32_t dst_count = 0;
-	uint32_t src_count = 0;
+	_process_row_blocks(p_height, p_width, [&](uint32_t p_from, uint32_t p_to) {
+		uint32_t dst_count = p_from * p_width * write_channels;
+		uint32_t src_count = p_from * p_width * read_channels;
 
-	const int resolution = p_width * p_height;
+		const int resolution = (p_to - p_from) * p_width;
 
-	for (int i = 0; i < resolution; i++) {
-		memcpy(p_dst + dst_count, p_src + src_count, MIN(read_channels, write_channels) * sizeof(T));
+		for (int i = 0; i < resolution; i++) {
+			memcpy(p_dst + dst_count, p_src + src_count, MIN(read_channels, write_channels) * sizeof(T));
 
-		if constexpr (write_channels > read_channels) {
-			const T def_value[4] = { def_zero, def_zero, def_zero, def_one };
-			memcpy(p_dst + dst_count + read_channels, &def_value[read_channels], (write_channels - read_channels) * sizeof(T));
-		}
+			if constexpr (write_channels > read_channels) {
+				const T def_value[4] = { def_zero, def_zero, def_zero, def_one };
+				memcpy(p_dst + dst_count + read_channels, &def_value[read_channels], (write_channels - read_channels) * sizeof(T));
+			}
 
-		dst_count += write_channels;
-		src_count += read_channels;
-	}
+			dst_count += write_channels;
+			src_count += read_channels;
+		}
+	});
 }
 
 static bool _are_formats_compatible(Image::Format p_format0, Image::Format p_format1) {
@@ -592,12 +652,14 @@ void Image::convert(Format p_new_format) {
 			uint8_t *dst_mip_ptr = new_img.ptrw() + dst_mip_ofs;
 			const uint8_t *src_mip_ptr = ptr() + src_mip_ofs;
 
-			for (int y = 0; y < h; y++) {
-				for (int x = 0; x < w; x++) {
-					uint32_t mip_ofs = y * w + x;
-					new_img._set_color_at_ofs(dst_mip_ptr, mip_ofs, _get_color_at_ofs(src_mip_ptr, mip_ofs));
+			_process_row_blocks(h, w, [&](uint32_t p_from, uint32_t p_to) {
+				for (int y = p_from; y < (int)p_to; y++) {
+					for (int x = 0; x < w; x++) {
+						uint32_t mip_ofs = y * w + x;
+						new_img._set_color_at_ofs(dst_mip_ptr, mip_ofs, _get_color_at_ofs(src_mip_ptr, mip_ofs));
+					}
 				}
-			}
+			});
 		}
 
 		_copy_internals_from(new_img);
@@ -890,85 +952,86 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int height = p_src_height;
 	double xfac = (double)width / p_dst_width;
 	double yfac = (double)height / p_dst_height;
-	// coordinates of source points and coefficients
-	double ox, oy, dx, dy;
-	int ox1, oy1, ox2, oy2;
-	// destination pixel values
 	// width and height decreased by 1
 	int ymax = height - 1;
 	int xmax = width - 1;
-	// temporary pointer
-
-	for (uint32_t y = 0; y < p_dst_height; y++) {
-		// Y coordinates
-		oy = (double)(y + 0.5) * yfac - 0.5;
-		oy1 = (int)oy;
-		dy = oy - (double)oy1;
 
-		for (uint32_t x = 0; x < p_dst_width; x++) {
-			// X coordinates
-			ox = (double)(x + 0.5) * xfac - 0.5;
-			ox1 = (int)ox;
-			dx = ox - (double)ox1;
+	_process_row_blocks(p_dst_height, p_dst_width * CC * 16, [&](uint32_t p_from, uint32_t p_to) {
+		// coordinates of source points and coefficients
+		double ox, oy, dx, dy;
+		int ox1, oy1, ox2, oy2;
 
-			// initial pixel value
+		for (uint32_t y = p_from; y < p_to; y++) {
+			// Y coordinates
+			oy = (double)(y + 0.5) * yfac - 0.5;
+			oy1 = (int)oy;
+			dy = oy - (double)oy1;
 
-			T *__restrict dst = ((T *)p_dst) + (y * p_dst_width + x) * CC;
+			for (uint32_t x = 0; x < p_dst_width; x++) {
+				// X coordinates
+				ox = (double)(x + 0.5) * xfac - 0.5;
+				ox1 = (int)ox;
+				dx = ox - (double)ox1;
 
-			double color[CC] = {};
+				// initial pixel value
 
-			for (int n = -1; n < 3; n++) {
-				// get Y coefficient
-				[[maybe_unused]] double k1 = _bicubic_interp_kernel(dy - (double)n);
+				T *__restrict dst = ((T *)p_dst) + (y * p_dst_width + x) * CC;
 
-				oy2 = oy1 + n;
-				if (oy2 < 0) {
-					oy2 = 0;
-				}
-				if (oy2 > ymax) {
-					oy2 = ymax;
-				}
+				double color[CC] = {};
 
-				for (int m = -1; m < 3; m++) {
-					// get X coefficient
-					[[maybe_unused]] double k2 = k1 * _bicubic_interp_kernel((double)m - dx);
+				for (int n = -1; n < 3; n++) {
+					// get Y coefficient
+					[[maybe_unused]] double k1 = _bicubic_interp_kernel(dy - (double)n);
 
-					ox2 = ox1 + m;
-					if (ox2 < 0) {
-						ox2 = 0;
+					oy2 = oy1 + n;
+					if (oy2 < 0) {
+						oy2 = 0;
 					}
-					if (ox2 > xmax) {
-						ox2 = xmax;
+					if (oy2 > ymax) {
+						oy2 = ymax;
 					}
 
-					// get pixel of original image
-					const T *__restrict p = ((T *)p_src) + (oy2 * p_src_width + ox2) * CC;
+					for (int m = -1; m < 3; m++) {
+						// get X coefficient
+						[[maybe_unused]] double k2 = k1 * _bicubic_interp_kernel((double)m - dx);
 
-					for (int i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2 && TYPE == IMAGE_SCALING_FLOAT) { //half float
-							color[i] = Math::half_to_float(p[i]);
-						} else {
-							color[i] += p[i] * k2;
+						ox2 = ox1 + m;
+						if (ox2 < 0) {
+							ox2 = 0;
+						}
+						if (ox2 > xmax) {
+							ox2 = xmax;
+						}
+
+						// get pixel of original image
+						const T *__restrict p = ((T *)p_src) + (oy2 * p_src_width + ox2) * CC;
+
+						for (int i = 0; i < CC; i++) {
+							if constexpr (sizeof(T) == 2 && TYPE == IMAGE_SCALING_FLOAT) { //half float
+								color[i] = Math::half_to_float(p[i]);
+							} else {
+								color[i] += p[i] * k2;
+							}
 						}
 					}
 				}
-			}
 
-			for (int i = 0; i < CC; i++) {
-				if constexpr (sizeof(T) == 1) { //byte
-					dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 255);
-				} else if constexpr (sizeof(T) == 2) {
-					if constexpr (TYPE == IMAGE_SCALING_FLOAT) {
-						dst[i] = Math::make_half_float(color[i]); //half float
+				for (int i = 0; i < CC; i++) {
+					if constexpr (sizeof(T) == 1) { //byte
+						dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 255);
+					} else if constexpr (sizeof(T) == 2) {
+						if constexpr (TYPE == IMAGE_SCALING_FLOAT) {
+							dst[i] = Math::make_half_float(color[i]); //half float
+						} else {
+							dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 65535); // uint16
+						}
 					} else {
-						dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 65535); // uint16
+						dst[i] = color[i];
 					}
-				} else {
-					dst[i] = color[i];
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, typename T, ImageScaleType TYPE>
@@ -978,65 +1041,84 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 	constexpr uint32_t FRAC_HALF = (FRAC_LEN >> 1);
 	constexpr uint32_t FRAC_MASK = FRAC_LEN - 1;
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
-		// Add 0.5 in order to interpolate based on pixel center
-		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
-		// Calculate nearest src pixel center above current, and truncate to get y index
-		uint32_t src_yofs_up = src_yofs_up_fp >= FRAC_HALF ? (src_yofs_up_fp - FRAC_HALF) >> FRAC_BITS : 0;
-		uint32_t src_yofs_down = (src_yofs_up_fp + FRAC_HALF) >> FRAC_BITS;
-		if (src_yofs_down >= p_src_height) {
-			src_yofs_down = p_src_height - 1;
-		}
-		// Calculate distance to pixel center of src_yofs_up
-		uint32_t src_yofs_frac = src_yofs_up_fp & FRAC_MASK;
-		src_yofs_frac = src_yofs_frac >= FRAC_HALF ? src_yofs_frac - FRAC_HALF : src_yofs_frac + FRAC_HALF;
-
-		uint32_t y_ofs_up = src_yofs_up * p_src_width * CC;
-		uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
-
-		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
-			uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
-			uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
-			if (src_xofs_right >= p_src_width) {
-				src_xofs_right = p_src_width - 1;
+	_process_row_blocks(p_dst_height, p_dst_width * CC, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			// Add 0.5 in order to interpolate based on pixel center
+			uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
+			// Calculate nearest src pixel center above current, and truncate to get y index
+			uint32_t src_yofs_up = src_yofs_up_fp >= FRAC_HALF ? (src_yofs_up_fp - FRAC_HALF) >> FRAC_BITS : 0;
+			uint32_t src_yofs_down = (src_yofs_up_fp + FRAC_HALF) >> FRAC_BITS;
+			if (src_yofs_down >= p_src_height) {
+				src_yofs_down = p_src_height - 1;
 			}
-			uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
-			src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
-
-			src_xofs_left *= CC;
-			src_xofs_right *= CC;
-
-			for (uint32_t l = 0; l < CC; l++) {
-				if constexpr (sizeof(T) == 1) { //uint8
-					uint32_t p00 = p_src[y_ofs_up + src_xofs_left + l] << FRAC_BITS;
-					uint32_t p10 = p_src[y_ofs_up + src_xofs_right + l] << FRAC_BITS;
-					uint32_t p01 = p_src[y_ofs_down + src_xofs_left + l] << FRAC_BITS;
-					uint32_t p11 = p_src[y_ofs_down + src_xofs_right + l] << FRAC_BITS;
-
-					uint32_t interp_up = p00 + (((p10 - p00) * src_xofs_frac) >> FRAC_BITS);
-					uint32_t interp_down = p01 + (((p11 - p01) * src_xofs_frac) >> FRAC_BITS);
-					uint32_t interp = interp_up + (((interp_down - interp_up) * src_yofs_frac) >> FRAC_BITS);
-					interp >>= FRAC_BITS;
-					p_dst[i * p_dst_width * CC + j * CC + l] = uint8_t(interp);
-				} else if constexpr (sizeof(T) == 2) {
-					if constexpr (TYPE == IMAGE_SCALING_FLOAT) { //half float
-						float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
-						float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
-						const T *src = ((const T *)p_src);
-						T *dst = ((T *)p_dst);
+			// Calculate distance to pixel center of src_yofs_up
+			uint32_t src_yofs_frac = src_yofs_up_fp & FRAC_MASK;
+			src_yofs_frac = src_yofs_frac >= FRAC_HALF ? src_yofs_frac - FRAC_HALF : src_yofs_frac + FRAC_HALF;
+
+			uint32_t y_ofs_up = src_yofs_up * p_src_width * CC;
+			uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
+
+			for (uint32_t j = 0; j < p_dst_width; j++) {
+				uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
+				uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
+				uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
+				if (src_xofs_right >= p_src_width) {
+					src_xofs_right = p_src_width - 1;
+				}
+				uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
+				src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
+
+				src_xofs_left *= CC;
+				src_xofs_right *= CC;
+
+				for (uint32_t l = 0; l < CC; l++) {
+					if constexpr (sizeof(T) == 1) { //uint8
+						uint32_t p00 = p_src[y_ofs_up + src_xofs_left + l] << FRAC_BITS;
+						uint32_t p10 = p_src[y_ofs_up + src_xofs_right + l] << FRAC_BITS;
+						uint32_t p01 = p_src[y_ofs_down + src_xofs_left + l] << FRAC_BITS;
+						uint32_t p11 = p_src[y_ofs_down + src_xofs_right + l] << FRAC_BITS;
+
+						uint32_t interp_up = p00 + (((p10 - p00) * src_xofs_frac) >> FRAC_BITS);
+						uint32_t interp_down = p01 + (((p11 - p01) * src_xofs_frac) >> FRAC_BITS);
+						uint32_t interp = interp_up + (((interp_down - interp_up) * src_yofs_frac) >> FRAC_BITS);
+						interp >>= FRAC_BITS;
+						p_dst[i * p_dst_width * CC + j * CC + l] = uint8_t(interp);
+					} else if constexpr (sizeof(T) == 2) {
+						if constexpr (TYPE == IMAGE_SCALING_FLOAT) { //half float
+							float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
+							float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
+							const T *src = ((const T *)p_src);
+							T *dst = ((T *)p_dst);
 
-						float p00 = Math::half_to_float(src[y_ofs_up + src_xofs_left + l]);
-						float p10 = Math::half_to_float(src[y_ofs_up + src_xofs_right + l]);
-						float p01 = Math::half_to_float(src[y_ofs_down + src_xofs_left + l]);
-						float p11 = Math::half_to_float(src[y_ofs_down + src_xofs_right + l]);
+							float p00 = Math::half_to_float(src[y_ofs_up + src_xofs_left + l]);
+							float p10 = Math::half_to_float(src[y_ofs_up + src_xofs_right + l]);
+							float p01 = Math::half_to_float(src[y_ofs_down + src_xofs_left + l]);
+							float p11 = Math::half_to_float(src[y_ofs_down + src_xofs_right + l]);
 
-						float interp_up = p00 + (p10 - p00) * xofs_frac;
-						float interp_down = p01 + (p11 - p01) * xofs_frac;
-						float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+							float interp_up = p00 + (p10 - p00) * xofs_frac;
+							float interp_down = p01 + (p11 - p01) * xofs_frac;
+							float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+
+							dst[i * p_dst_width * CC + j * CC + l] = Math::make_half_float(interp);
+						} else { //uint16
+							float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
+							float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
+							const T *src = ((const T *)p_src);
+							T *dst = ((T *)p_dst);
+
+							float p00 = src[y_ofs_up + src_xofs_left + l];
+							float p10 = src[y_ofs_up + src_xofs_right + l];
+							float p01 = src[y_ofs_down + src_xofs_left + l];
+							float p11 = src[y_ofs_down + src_xofs_right + l];
+
+							float interp_up = p00 + (p10 - p00) * xofs_frac;
+							float interp_down = p01 + (p11 - p01) * xofs_frac;
+							float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+
+							dst[i * p_dst_width * CC + j * CC + l] = uint16_t(interp);
+						}
+					} else if constexpr (sizeof(T) == 4) { //float
 
-						dst[i * p_dst_width * CC + j * CC + l] = Math::make_half_float(interp);
-					} else { //uint16
 						float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
 						float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
 						const T *src = ((const T *)p_src);
@@ -1051,50 +1133,35 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 						float interp_down = p01 + (p11 - p01) * xofs_frac;
 						float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
 
-						dst[i * p_dst_width * CC + j * CC + l] = uint16_t(interp);
+						dst[i * p_dst_width * CC + j * CC + l] = interp;
 					}
-				} else if constexpr (sizeof(T) == 4) { //float
-
-					float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
-					float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
-					const T *src = ((const T *)p_src);
-					T *dst = ((T *)p_dst);
-
-					float p00 = src[y_ofs_up + src_xofs_left + l];
-					float p10 = src[y_ofs_up + src_xofs_right + l];
-					float p01 = src[y_ofs_down + src_xofs_left + l];
-					float p11 = src[y_ofs_down + src_xofs_right + l];
-
-					float interp_up = p00 + (p10 - p00) * xofs_frac;
-					float interp_down = p01 + (p11 - p01) * xofs_frac;
-					float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
-
-					dst[i * p_dst_width * CC + j * CC + l] = interp;
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, typename T>
 static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
-		uint32_t src_yofs = (i + 0.5) * p_src_height / p_dst_height;
-		uint32_t y_ofs = src_yofs * p_src_width * CC;
+	_process_row_blocks(p_dst_height, p_dst_width * CC, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			uint32_t src_yofs = (i + 0.5) * p_src_height / p_dst_height;
+			uint32_t y_ofs = src_yofs * p_src_width * CC;
 
-		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs = (j + 0.5) * p_src_width / p_dst_width;
-			src_xofs *= CC;
+			for (uint32_t j = 0; j < p_dst_width; j++) {
+				uint32_t src_xofs = (j + 0.5) * p_src_width / p_dst_width;
+				src_xofs *= CC;
 
-			for (uint32_t l = 0; l < CC; l++) {
-				const T *src = ((const T *)p_src);
-				T *dst = ((T *)p_dst);
+				for (uint32_t l = 0; l < CC; l++) {
+					const T *src = ((const T *)p_src);
+					T *dst = ((T *)p_dst);
 
-				T p = src[y_ofs + src_xofs + l];
-				dst[i * p_dst_width * CC + j * CC + l] = p;
+					T p = src[y_ofs + src_xofs + l];
+					dst[i * p_dst_width * CC + j * CC + l] = p;
+				}
 			}
 		}
-	}
+	});
 }
 
 #define LANCZOS_TYPE 3
@@ -1120,47 +1187,50 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		// Split by columns of the buffer, since the kernel is shared by all the pixels of a column.
+		_process_row_blocks(dst_width, src_height * CC * half_kernel * 2, [&](uint32_t p_from, uint32_t p_to) {
+			float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
-			// The corresponding point on the source image
-			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
-			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
-			int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
+			for (int32_t buffer_x = p_from; buffer_x < (int32_t)p_to; buffer_x++) {
+				// The corresponding point on the source image
+				float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
+				int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
+				int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
 
-			// Create the kernel used by all the pixels of the column
-			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-				kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
-			}
+				// Create the kernel used by all the pixels of the column
+				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+					kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
+				}
 
-			for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-					float lanczos_val = kernel[target_x - start_x];
-					weight += lanczos_val;
+					for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+						float lanczos_val = kernel[target_x - start_x];
+						weight += lanczos_val;
 
-					const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+						const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2 && TYPE == IMAGE_SCALING_FLOAT) { //half float
-							pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
-						} else {
-							pixel[i] += src_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							if constexpr (sizeof(T) == 2 && TYPE == IMAGE_SCALING_FLOAT) { //half float
+								pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
+							} else {
+								pixel[i] += src_data[i] * lanczos_val;
+							}
 						}
 					}
-				}
 
-				float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
+					float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					for (uint32_t i = 0; i < CC; i++) {
+						dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of first pass
 
 	{ // SECOND PASS (vertical + result)
@@ -1170,54 +1240,56 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		float scale_factor = MAX(y_scale, 1);
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		_process_row_blocks(dst_height, dst_width * CC * half_kernel * 2, [&](uint32_t p_from, uint32_t p_to) {
+			float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t dst_y = 0; dst_y < dst_height; dst_y++) {
-			float buffer_y = (dst_y + 0.5f) * y_scale;
-			int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
-			int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
+			for (int32_t dst_y = p_from; dst_y < (int32_t)p_to; dst_y++) {
+				float buffer_y = (dst_y + 0.5f) * y_scale;
+				int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
+				int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
 
-			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-				kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
-			}
+				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+					kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
+				}
 
-			for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-					float lanczos_val = kernel[target_y - start_y];
-					weight += lanczos_val;
+					for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+						float lanczos_val = kernel[target_y - start_y];
+						weight += lanczos_val;
 
-					float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
+						float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						pixel[i] += buffer_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							pixel[i] += buffer_data[i] * lanczos_val;
+						}
 					}
-				}
 
-				T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
+					T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					pixel[i] /= weight;
+					for (uint32_t i = 0; i < CC; i++) {
+						pixel[i] /= weight;
+
+						if constexpr (sizeof(T) == 1) { //byte
+							dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
+						} else if constexpr (sizeof(T) == 2) {
+							if constexpr (TYPE == IMAGE_SCALING_FLOAT) { //half float
+								dst_data[i] = Math::make_half_float(pixel[i]);
+							} else { //uint16
+								dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 65535);
+							}
 
-					if constexpr (sizeof(T) == 1) { //byte
-						dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
-					} else if constexpr (sizeof(T) == 2) {
-						if constexpr (TYPE == IMAGE_SCALING_FLOAT) { //half float
-							dst_data[i] = Math::make_half_float(pixel[i]);
-						} else { //uint16
-							dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 65535);
+						} else { // float
+							dst_data[i] = pixel[i];
 						}
-
-					} else { // float
-						dst_data[i] = pixel[i];
 					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of second pass
 
 	memdelete_arr(buffer);
@@ -1957,6 +2029,63 @@ int64_t Image::_get_dst_image_size(int p_width, int p_height, Format p_format, i
 	return size;
 }
 
+// Averages `p_count` RGBA8 or RGBAF pixels of a 2x2 box filter and returns how many were processed,
+// the remaining ones are left to the scalar loop.
+template <typename Component>
+static uint32_t _generate_po2_mipmap_rgba_simd(const Component *p_up, const Component *p_down, Component *p_dst, uint32_t p_count) {
+	uint32_t done = 0;
+#if defined(IMAGE_SSE2)
+	if constexpr (std::is_same_v<Component, uint8_t>) {
+		// Same as `average_4_uint8()`: (a + b + c + d + 2) >> 2 in 16-bit lanes.
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i two = _mm_set1_epi16(2);
+		for (; done + 4 <= p_count; done += 4) {
+			__m128i res[2];
+			for (int half = 0; half < 2; half++) {
+				const __m128i up = _mm_loadu_si128((const __m128i *)(p_up + done * 8 + half * 16));
+				const __m128i down = _mm_loadu_si128((const __m128i *)(p_down + done * 8 + half * 16));
+				const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(up, zero), _mm_unpacklo_epi8(down, zero)); // Source pixels 0 and 1.
+				const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(up, zero), _mm_unpackhi_epi8(down, zero)); // Source pixels 2 and 3.
+				const __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+				res[half] = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+			}
+			_mm_storeu_si128((__m128i *)(p_dst + done * 4), _mm_packus_epi16(res[0], res[1]));
+		}
+	} else {
+		// Same as `average_4_float()`: ((a + b + c + d) * 0.25, added in the same order.
+		const __m128 quarter = _mm_set1_ps(0.25f);
+		for (; done < p_count; done++) {
+			const __m128 a = _mm_loadu_ps(p_up + done * 8);
+			const __m128 b = _mm_loadu_ps(p_up + done * 8 + 4);
+			const __m128 c = _mm_loadu_ps(p_down + done * 8);
+			const __m128 d = _mm_loadu_ps(p_down + done * 8 + 4);
+			_mm_storeu_ps(p_dst + done * 4, _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(a, b), c), d), quarter));
+		}
+	}
+#elif defined(IMAGE_NEON)
+	if constexpr (std::is_same_v<Component, uint8_t>) {
+		for (; done + 2 <= p_count; done += 2) {
+			const uint8x16_t up = vld1q_u8(p_up + done * 8);
+			const uint8x16_t down = vld1q_u8(p_down + done * 8);
+			const uint16x8_t lo = vaddl_u8(vget_low_u8(up), vget_low_u8(down));
+			const uint16x8_t hi = vaddl_u8(vget_high_u8(up), vget_high_u8(down));
+			uint16x8_t sum = vcombine_u16(vadd_u16(vget_low_u16(lo), vget_high_u16(lo)), vadd_u16(vget_low_u16(hi), vget_high_u16(hi)));
+			sum = vshrq_n_u16(vaddq_u16(sum, vdupq_n_u16(2)), 2);
+			vst1_u8(p_dst + done * 4, vmovn_u16(sum));
+		}
+	} else {
+		for (; done < p_count; done++) {
+			const float32x4_t a = vld1q_f32(p_up + done * 8);
+			const float32x4_t b = vld1q_f32(p_up + done * 8 + 4);
+			const float32x4_t c = vld1q_f32(p_down + done * 8);
+			const float32x4_t d = vld1q_f32(p_down + done * 8 + 4);
+			vst1q_f32(p_dst + done * 4, vmulq_n_f32(vaddq_f32(vaddq_f32(vaddq_f32(a, b), c), d), 0.25f));
+		}
+	}
+#endif
+	return done;
+}
+
 template <typename Component, int CC, bool renormalize,
 		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
 		void (*renormalize_func)(Component *)>
@@ -1968,27 +2097,40 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
-		const Component *rup_ptr = &p_src[i * 2 * down_step];
-		const Component *rdown_ptr = rup_ptr + down_step;
-		Component *dst_ptr = &p_dst[i * dst_w * CC];
-		uint32_t count = dst_w;
-
-		while (count) {
-			count--;
-			for (int j = 0; j < CC; j++) {
-				average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
+	_process_row_blocks(dst_h, dst_w * CC * 4, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			const Component *rup_ptr = &p_src[i * 2 * down_step];
+			const Component *rdown_ptr = rup_ptr + down_step;
+			Component *dst_ptr = &p_dst[i * dst_w * CC];
+			uint32_t count = dst_w;
+
+			// 8-bit and float channels are always averaged with `average_4_uint8()` and `average_4_float()`.
+			if constexpr (IMAGE_SIMD_MIPMAPS && CC == 4 && !renormalize && (std::is_same_v<Component, uint8_t> || std::is_same_v<Component, float>)) {
+				if (right_step == CC) {
+					const uint32_t done = _generate_po2_mipmap_rgba_simd(rup_ptr, rdown_ptr, dst_ptr, count);
+					count -= done;
+					dst_ptr += done * CC;
+					rup_ptr += done * right_step * 2;
+					rdown_ptr += done * right_step * 2;
+				}
 			}
 
-			if constexpr (renormalize) {
-				renormalize_func(dst_ptr);
-			}
+			while (count) {
+				count--;
+				for (int j = 0; j < CC; j++) {
+					average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
+				}
 
-			dst_ptr += CC;
-			rup_ptr += right_step * 2;
-			rdown_ptr += right_step * 2;
+				if constexpr (renormalize) {
+					renormalize_func(dst_ptr);
+				}
+
+				dst_ptr += CC;
+				rup_ptr += right_step * 2;
+				rdown_ptr += right_step * 2;
+			}
 		}
-	}
+	});
 }
 
 void Image::_generate_mipmap_from_format(Image::Format p_format, const uint8_t *p_src, uint8_t *p_dst, uint32_t p_width, uint32_t p_height, bool p_renormalize) {
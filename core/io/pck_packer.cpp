@@ -53,6 +53,10 @@ void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("add_file_from_buffer", "target_path", "data", "encrypt"), &PCKPacker::add_file_from_buffer, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file_removal", "target_path"), &PCKPacker::add_file_removal);
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("set_compression_enabled", "enabled"), &PCKPacker::set_compression_enabled);
+	ClassDB::bind_method(D_METHOD("is_compression_enabled"), &PCKPacker::is_compression_enabled);
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "compression_enabled"), "set_compression_enabled", "is_compression_enabled");
 }
 
 Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const String &p_key, bool p_encrypt_directory) {
@@ -125,6 +129,7 @@ Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const Stri
 	file->seek(file_base);
 
 	files.clear();
+	stored_content.clear();
 
 	return OK;
 }
@@ -184,6 +189,27 @@ Error PCKPacker::_add_file(const String &p_target_path, const String &p_source_p
 	}
 	pf.encrypted = p_encrypt;
 
+	// Identical content is only stored once, later files point to the same data.
+	String content_key;
+	{
+		unsigned char hash[32];
+		CryptoCore::sha256(p_data.ptr(), p_data.size(), hash);
+		content_key = String::hex_encode_buffer(hash, 32) + (p_encrypt ? "e" : "") + (compression_enabled ? "c" : "");
+	}
+	const File *stored = stored_content.getptr(content_key);
+	if (stored) {
+		pf.ofs = stored->ofs;
+		pf.compressed = stored->compressed;
+		files.push_back(pf);
+		return OK;
+	}
+
+	Vector<uint8_t> compressed;
+	if (compression_enabled) {
+		compressed = FileAccessPack::compress_chunks(p_data.ptr(), p_data.size());
+		pf.compressed = !compressed.is_empty();
+	}
+
 	Ref<FileAccess> ftmp = file;
 
 	Ref<FileAccessEncrypted> fae;
@@ -196,7 +222,7 @@ Error PCKPacker::_add_file(const String &p_target_path, const String &p_source_p
 		ftmp = fae;
 	}
 
-	ftmp->store_buffer(p_data);
+	ftmp->store_buffer(pf.compressed ? compressed : p_data);
 
 	if (fae.is_valid()) {
 		ftmp.unref();
@@ -209,6 +235,7 @@ Error PCKPacker::_add_file(const String &p_target_path, const String &p_source_p
 	}
 
 	files.push_back(pf);
+	stored_content[content_key] = pf;
 
 	return OK;
 }
@@ -265,6 +292,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 
 		if (p_verbose) {
@@ -281,6 +311,14 @@ Error PCKPacker::flush(bool p_verbose) {
 	return OK;
 }
 
+void PCKPacker::set_compression_enabled(bool p_enabled) {
+	compression_enabled = p_enabled;
+}
+
+bool PCKPacker::is_compression_enabled() const {
+	return compression_enabled;
+}
+
 PCKPacker::~PCKPacker() {
 	if (file.is_valid()) {
 		flush();
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
 
 class FileAccess;
 
@@ -42,6 +43,7 @@ class PCKPacker : public RefCounted {
 
 	Vector<uint8_t> key;
 	bool enc_dir = false;
+	bool compression_enabled = false;
 
 	uint64_t file_base = 0;
 	uint64_t file_base_ofs = 0;
@@ -56,10 +58,14 @@ class PCKPacker : public RefCounted {
 		uint64_t size = 0;
 		bool encrypted = false;
 		bool removal = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
 	};
 	Vector<File> files;
 
+	// Files already stored in the pack, by content hash, so identical files share their data.
+	HashMap<String, File> stored_content;
+
 	Error _add_file(const String &p_target_path, const String &p_source_path, const Vector<uint8_t> &p_data, bool p_encrypt = false);
 
 public:
@@ -69,5 +75,8 @@ public:
 	Error add_file_removal(const String &p_target_path);
 	Error flush(bool p_verbose = false);
 
+	void set_compression_enabled(bool p_enabled);
+	bool is_compression_enabled() const;
+
 	~PCKPacker();
 };
@@ -164,6 +164,10 @@ StringName ResourceLoaderBinary::_get_string() {
 		if (len == 0) {
 			return StringName();
 		}
+		Span<uint8_t> view = f->get_buffer_view(len);
+		if (!view.is_empty()) {
+			return String::utf8((const char *)view.ptr(), len);
+		}
 		f->get_buffer((uint8_t *)&str_buf[0], len);
 		return String::utf8(&str_buf[0], len);
 	}
@@ -930,6 +934,10 @@ String ResourceLoaderBinary::get_unicode_string() {
 	if (len == 0) {
 		return String();
 	}
+	Span<uint8_t> view = f->get_buffer_view(len);
+	if (!view.is_empty()) {
+		return String::utf8((const char *)view.ptr(), len);
+	}
 	f->get_buffer((uint8_t *)&str_buf[0], len);
 	return String::utf8(&str_buf[0], len);
 }
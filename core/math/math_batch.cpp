@@ -0,0 +1,334 @@
+/**************************************************************************/
+/*  math_batch.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "math_batch.h"
+
+#include "core/math/aabb.h"
+#include "core/math/quaternion.h"
+#include "core/math/transform_3d.h"
+
+// SSE2 is part of the baseline on x86_64 (and enabled on x86_32 builds), and NEON on ARM64,
+// so no runtime detection is needed for either. The kernels only use plain multiplies and adds
+// in the same order as the scalar code, so they give the same results unless the compiler
+// fuses the scalar operations.
+#ifndef REAL_T_IS_DOUBLE
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_BATCH_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define MATH_BATCH_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace MathBatch {
+
+#if defined(MATH_BATCH_SSE)
+
+static _FORCE_INLINE_ __m128 _load_vector3(const Vector3 &p_v) {
+	// Vector3 is only 12 bytes, so a 16-byte load could read past the end of an array.
+	return _mm_setr_ps(p_v.x, p_v.y, p_v.z, 0.0f);
+}
+
+static _FORCE_INLINE_ void _store_vector3(__m128 p_v, Vector3 &r_v) {
+	alignas(16) float f[4];
+	_mm_store_ps(f, p_v);
+	r_v.x = f[0];
+	r_v.y = f[1];
+	r_v.z = f[2];
+}
+
+// Returns `(p_a * p_x + p_b * p_y) + p_c * p_z`, the same order as `Vector3::dot()`.
+static _FORCE_INLINE_ __m128 _combine(__m128 p_a, __m128 p_b, __m128 p_c, float p_x, float p_y, float p_z) {
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(p_a, _mm_set1_ps(p_x)), _mm_mul_ps(p_b, _mm_set1_ps(p_y))), _mm_mul_ps(p_c, _mm_set1_ps(p_z)));
+}
+
+static _FORCE_INLINE_ void _multiply_transform(const Basis &p_basis, __m128 p_col0, __m128 p_col1, __m128 p_col2, __m128 p_origin, const Transform3D &p_src, Transform3D &r_dst) {
+	const __m128 row0 = _load_vector3(p_src.basis.rows[0]);
+	const __m128 row1 = _load_vector3(p_src.basis.rows[1]);
+	const __m128 row2 = _load_vector3(p_src.basis.rows[2]);
+	const Vector3 src_origin = p_src.origin;
+
+	_store_vector3(_mm_add_ps(_combine(p_col0, p_col1, p_col2, src_origin.x, src_origin.y, src_origin.z), p_origin), r_dst.origin);
+	_store_vector3(_combine(row0, row1, row2, p_basis.rows[0][0], p_basis.rows[0][1], p_basis.rows[0][2]), r_dst.basis.rows[0]);
+	_store_vector3(_combine(row0, row1, row2, p_basis.rows[1][0], p_basis.rows[1][1], p_basis.rows[1][2]), r_dst.basis.rows[1]);
+	_store_vector3(_combine(row0, row1, row2, p_basis.rows[2][0], p_basis.rows[2][1], p_basis.rows[2][2]), r_dst.basis.rows[2]);
+}
+
+void transform_points(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *p_dst, uint32_t p_count) {
+	const Basis &b = p_transform.basis;
+	const __m128 col0 = _mm_setr_ps(b.rows[0][0], b.rows[1][0], b.rows[2][0], 0.0f);
+	const __m128 col1 = _mm_setr_ps(b.rows[0][1], b.rows[1][1], b.rows[2][1], 0.0f);
+	const __m128 col2 = _mm_setr_ps(b.rows[0][2], b.rows[1][2], b.rows[2][2], 0.0f);
+	const __m128 origin = _load_vector3(p_transform.origin);
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		const Vector3 v = p_src[i];
+		_store_vector3(_mm_add_ps(_combine(col0, col1, col2, v.x, v.y, v.z), origin), p_dst[i]);
+	}
+}
+
+void multiply_transforms(const Transform3D *p_a, const Transform3D *p_b, Transform3D *p_dst, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		const Transform3D a = p_a[i];
+		const __m128 col0 = _mm_setr_ps(a.basis.rows[0][0], a.basis.rows[1][0], a.basis.rows[2][0], 0.0f);
+		const __m128 col1 = _mm_setr_ps(a.basis.rows[0][1], a.basis.rows[1][1], a.basis.rows[2][1], 0.0f);
+		const __m128 col2 = _mm_setr_ps(a.basis.rows[0][2], a.basis.rows[1][2], a.basis.rows[2][2], 0.0f);
+		_multiply_transform(a.basis, col0, col1, col2, _load_vector3(a.origin), p_b[i], p_dst[i]);
+	}
+}
+
+void multiply_transforms(const Transform3D &p_parent, const Transform3D *p_src, Transform3D *p_dst, uint32_t p_count) {
+	const Basis &b = p_parent.basis;
+	const __m128 col0 = _mm_setr_ps(b.rows[0][0], b.rows[1][0], b.rows[2][0], 0.0f);
+	const __m128 col1 = _mm_setr_ps(b.rows[0][1], b.rows[1][1], b.rows[2][1], 0.0f);
+	const __m128 col2 = _mm_setr_ps(b.rows[0][2], b.rows[1][2], b.rows[2][2], 0.0f);
+	const __m128 origin = _load_vector3(p_parent.origin);
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		_multiply_transform(b, col0, col1, col2, origin, p_src[i], p_dst[i]);
+	}
+}
+
+void normalize_quaternions(Quaternion *p_quaternions, uint32_t p_count) {
+	const __m128 one = _mm_set1_ps(1.0f);
+
+	uint32_t i = 0;
+	for (; i + 4 <= p_count; i += 4) {
+		float *q = &p_quaternions[i].x;
+		__m128 x = _mm_loadu_ps(q);
+		__m128 y = _mm_loadu_ps(q + 4);
+		__m128 z = _mm_loadu_ps(q + 8);
+		__m128 w = _mm_loadu_ps(q + 12);
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+
+		const __m128 length_squared = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(w, w));
+		const __m128 inv_length = _mm_div_ps(one, _mm_sqrt_ps(length_squared));
+		x = _mm_mul_ps(x, inv_length);
+		y = _mm_mul_ps(y, inv_length);
+		z = _mm_mul_ps(z, inv_length);
+		w = _mm_mul_ps(w, inv_length);
+
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_storeu_ps(q, x);
+		_mm_storeu_ps(q + 4, y);
+		_mm_storeu_ps(q + 8, z);
+		_mm_storeu_ps(q + 12, w);
+	}
+
+	for (; i < p_count; i++) {
+		p_quaternions[i].normalize();
+	}
+}
+
+AABB merge_aabbs(const AABB *p_aabbs, uint32_t p_count) {
+	if (p_count == 0) {
+		return AABB();
+	}
+
+	__m128 min = _load_vector3(p_aabbs[0].position);
+	__m128 max = _mm_add_ps(_load_vector3(p_aabbs[0].size), min);
+	for (uint32_t i = 1; i < p_count; i++) {
+		const __m128 begin = _load_vector3(p_aabbs[i].position);
+		min = _mm_min_ps(min, begin);
+		max = _mm_max_ps(max, _mm_add_ps(_load_vector3(p_aabbs[i].size), begin));
+	}
+
+	AABB aabb;
+	_store_vector3(min, aabb.position);
+	_store_vector3(_mm_sub_ps(max, min), aabb.size);
+	return aabb;
+}
+
+const char *get_simd_name() {
+	return "SSE2";
+}
+
+#elif defined(MATH_BATCH_NEON)
+
+static _FORCE_INLINE_ float32x4_t _load_vector3(const Vector3 &p_v) {
+	const float f[4] = { p_v.x, p_v.y, p_v.z, 0.0f };
+	return vld1q_f32(f);
+}
+
+static _FORCE_INLINE_ void _store_vector3(float32x4_t p_v, Vector3 &r_v) {
+	r_v.x = vgetq_lane_f32(p_v, 0);
+	r_v.y = vgetq_lane_f32(p_v, 1);
+	r_v.z = vgetq_lane_f32(p_v, 2);
+}
+
+// Returns `(p_a * p_x + p_b * p_y) + p_c * p_z`, the same order as `Vector3::dot()`.
+static _FORCE_INLINE_ float32x4_t _combine(float32x4_t p_a, float32x4_t p_b, float32x4_t p_c, float p_x, float p_y, float p_z) {
+	return vaddq_f32(vaddq_f32(vmulq_n_f32(p_a, p_x), vmulq_n_f32(p_b, p_y)), vmulq_n_f32(p_c, p_z));
+}
+
+static _FORCE_INLINE_ void _multiply_transform(const Basis &p_basis, float32x4_t p_col0, float32x4_t p_col1, float32x4_t p_col2, float32x4_t p_origin, const Transform3D &p_src, Transform3D &r_dst) {
+	const float32x4_t row0 = _load_vector3(p_src.basis.rows[0]);
+	const float32x4_t row1 = _load_vector3(p_src.basis.rows[1]);
+	const float32x4_t row2 = _load_vector3(p_src.basis.rows[2]);
+	const Vector3 src_origin = p_src.origin;
+
+	_store_vector3(vaddq_f32(_combine(p_col0, p_col1, p_col2, src_origin.x, src_origin.y, src_origin.z), p_origin), r_dst.origin);
+	_store_vector3(_combine(row0, row1, row2, p_basis.rows[0][0], p_basis.rows[0][1], p_basis.rows[0][2]), r_dst.basis.rows[0]);
+	_store_vector3(_combine(row0, row1, row2, p_basis.rows[1][0], p_basis.rows[1][1], p_basis.rows[1][2]), r_dst.basis.rows[1]);
+	_store_vector3(_combine(row0, row1, row2, p_basis.rows[2][0], p_basis.rows[2][1], p_basis.rows[2][2]), r_dst.basis.rows[2]);
+}
+
+static _FORCE_INLINE_ void _get_columns(const Basis &p_basis, float32x4_t &r_col0, float32x4_t &r_col1, float32x4_t &r_col2) {
+	r_col0 = _load_vector3(Vector3(p_basis.rows[0][0], p_basis.rows[1][0], p_basis.rows[2][0]));
+	r_col1 = _load_vector3(Vector3(p_basis.rows[0][1], p_basis.rows[1][1], p_basis.rows[2][1]));
+	r_col2 = _load_vector3(Vector3(p_basis.rows[0][2], p_basis.rows[1][2], p_basis.rows[2][2]));
+}
+
+void transform_points(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *p_dst, uint32_t p_count) {
+	float32x4_t col0, col1, col2;
+	_get_columns(p_transform.basis, col0, col1, col2);
+	const float32x4_t origin = _load_vector3(p_transform.origin);
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		const Vector3 v = p_src[i];
+		_store_vector3(vaddq_f32(_combine(col0, col1, col2, v.x, v.y, v.z), origin), p_dst[i]);
+	}
+}
+
+void multiply_transforms(const Transform3D *p_a, const Transform3D *p_b, Transform3D *p_dst, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		const Transform3D a = p_a[i];
+		float32x4_t col0, col1, col2;
+		_get_columns(a.basis, col0, col1, col2);
+		_multiply_transform(a.basis, col0, col1, col2, _load_vector3(a.origin), p_b[i], p_dst[i]);
+	}
+}
+
+void multiply_transforms(const Transform3D &p_parent, const Transform3D *p_src, Transform3D *p_dst, uint32_t p_count) {
+	float32x4_t col0, col1, col2;
+	_get_columns(p_parent.basis, col0, col1, col2);
+	const float32x4_t origin = _load_vector3(p_parent.origin);
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		_multiply_transform(p_parent.basis, col0, col1, col2, origin, p_src[i], p_dst[i]);
+	}
+}
+
+void normalize_quaternions(Quaternion *p_quaternions, uint32_t p_count) {
+	uint32_t i = 0;
+	for (; i + 4 <= p_count; i += 4) {
+		float *q = &p_quaternions[i].x;
+		// De-interleaves into x, y, z and w vectors.
+		float32x4x4_t v = vld4q_f32(q);
+
+		const float32x4_t length_squared = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(v.val[0], v.val[0]), vmulq_f32(v.val[1], v.val[1])), vmulq_f32(v.val[2], v.val[2])), vmulq_f32(v.val[3], v.val[3]));
+		const float32x4_t inv_length = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(length_squared));
+		for (int j = 0; j < 4; j++) {
+			v.val[j] = vmulq_f32(v.val[j], inv_length);
+		}
+
+		vst4q_f32(q, v);
+	}
+
+	for (; i < p_count; i++) {
+		p_quaternions[i].normalize();
+	}
+}
+
+AABB merge_aabbs(const AABB *p_aabbs, uint32_t p_count) {
+	if (p_count == 0) {
+		return AABB();
+	}
+
+	float32x4_t min = _load_vector3(p_aabbs[0].position);
+	float32x4_t max = vaddq_f32(_load_vector3(p_aabbs[0].size), min);
+	for (uint32_t i = 1; i < p_count; i++) {
+		const float32x4_t begin = _load_vector3(p_aabbs[i].position);
+		min = vminq_f32(min, begin);
+		max = vmaxq_f32(max, vaddq_f32(_load_vector3(p_aabbs[i].size), begin));
+	}
+
+	AABB aabb;
+	_store_vector3(min, aabb.position);
+	_store_vector3(vsubq_f32(max, min), aabb.size);
+	return aabb;
+}
+
+const char *get_simd_name() {
+	return "NEON";
+}
+
+#else
+
+void transform_points(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *p_dst, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		p_dst[i] = p_transform.xform(p_src[i]);
+	}
+}
+
+void multiply_transforms(const Transform3D *p_a, const Transform3D *p_b, Transform3D *p_dst, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		p_dst[i] = p_a[i] * p_b[i];
+	}
+}
+
+void multiply_transforms(const Transform3D &p_parent, const Transform3D *p_src, Transform3D *p_dst, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		p_dst[i] = p_parent * p_src[i];
+	}
+}
+
+void normalize_quaternions(Quaternion *p_quaternions, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		p_quaternions[i].normalize();
+	}
+}
+
+AABB merge_aabbs(const AABB *p_aabbs, uint32_t p_count) {
+	if (p_count == 0) {
+		return AABB();
+	}
+
+	// Track the end points rather than calling `merge_with()`, so the result matches the SIMD versions exactly.
+	Vector3 min = p_aabbs[0].position;
+	Vector3 max = p_aabbs[0].size + min;
+	for (uint32_t i = 1; i < p_count; i++) {
+		const Vector3 &begin = p_aabbs[i].position;
+		const Vector3 end = p_aabbs[i].size + begin;
+		min = Vector3(MIN(min.x, begin.x), MIN(min.y, begin.y), MIN(min.z, begin.z));
+		max = Vector3(MAX(max.x, end.x), MAX(max.y, end.y), MAX(max.z, end.z));
+	}
+
+	return AABB(min, max - min);
+}
+
+const char *get_simd_name() {
+	return "none";
+}
+
+#endif
+
+} //namespace MathBatch
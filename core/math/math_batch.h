@@ -0,0 +1,60 @@
+/**************************************************************************/
+/*  math_batch.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/math_defs.h"
+
+struct AABB;
+struct Quaternion;
+struct Transform3D;
+struct Vector3;
+
+// Batch versions of common math operations, for hot loops over large arrays.
+// They use SSE on x86 and NEON on ARM64 when `real_t` is single-precision,
+// and fall back to scalar code otherwise. Results match the equivalent scalar
+// operations, within floating-point tolerance.
+namespace MathBatch {
+
+// Sets `p_dst[i] = p_transform.xform(p_src[i])`. `p_src` and `p_dst` may be the same array.
+void transform_points(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *p_dst, uint32_t p_count);
+// Sets `p_dst[i] = p_a[i] * p_b[i]`. `p_dst` may be the same array as either input.
+void multiply_transforms(const Transform3D *p_a, const Transform3D *p_b, Transform3D *p_dst, uint32_t p_count);
+// Sets `p_dst[i] = p_parent * p_src[i]`. `p_src` and `p_dst` may be the same array.
+void multiply_transforms(const Transform3D &p_parent, const Transform3D *p_src, Transform3D *p_dst, uint32_t p_count);
+// Normalizes all quaternions in place.
+void normalize_quaternions(Quaternion *p_quaternions, uint32_t p_count);
+// Returns the AABB enclosing all of `p_aabbs`, or an empty AABB if `p_count` is 0.
+AABB merge_aabbs(const AABB *p_aabbs, uint32_t p_count);
+
+// Name of the instruction set used by the kernels, for debugging and tests.
+const char *get_simd_name();
+
+} //namespace MathBatch
@@ -32,6 +32,7 @@
 
 #include "core/math/aabb.h"
 #include "core/math/basis.h"
+#include "core/math/math_batch.h"
 #include "core/math/plane.h"
 #include "core/templates/vector.h"
 
@@ -259,12 +260,7 @@ Vector<Vector3> Transform3D::xform(const Vector<Vector3> &p_array) const {
 	Vector<Vector3> array;
 	array.resize(p_array.size());
 
-	const Vector3 *r = p_array.ptr();
-	Vector3 *w = array.ptrw();
-
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform(r[i]);
-	}
+	MathBatch::transform_points(*this, p_array.ptr(), array.ptrw(), p_array.size());
 	return array;
 }
 
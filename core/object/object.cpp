@@ -43,21 +43,6 @@
 
 #ifdef DEBUG_ENABLED
 
-struct _ObjectDebugLock {
-	ObjectID obj_id;
-
-	_ObjectDebugLock(Object *p_obj) {
-		obj_id = p_obj->get_instance_id();
-		p_obj->_lock_index.ref();
-	}
-	~_ObjectDebugLock() {
-		Object *obj_ptr = ObjectDB::get_instance(obj_id);
-		if (likely(obj_ptr)) {
-			obj_ptr->_lock_index.unref();
-		}
-	}
-};
-
 #define OBJ_DEBUG_LOCK _ObjectDebugLock _debug_lock(this);
 
 #else
@@ -1271,64 +1256,85 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+Object::SignalData::Snapshot *Object::SignalData::get_snapshot() {
+	if (!snapshot) {
+		snapshot = memnew(Snapshot);
+		snapshot->refcount.init();
+		snapshot->callables.reserve(slot_map.size());
+		snapshot->flags.reserve(slot_map.size());
+		for (const KeyValue<Callable, Slot> &slot_kv : slot_map) {
+			snapshot->callables.push_back(slot_kv.value.conn.callable);
+			snapshot->flags.push_back(slot_kv.value.conn.flags);
+			snapshot->has_one_shot = snapshot->has_one_shot || (slot_kv.value.conn.flags & CONNECT_ONE_SHOT);
+		}
+	}
+	snapshot->refcount.ref();
+	return snapshot;
+}
+
+void Object::SignalData::clear_snapshot() {
+	if (snapshot) {
+		unref_snapshot(snapshot);
+		snapshot = nullptr;
+	}
+}
+
+void Object::SignalData::unref_snapshot(Snapshot *p_snapshot) {
+	if (p_snapshot->refcount.unref()) {
+		memdelete(p_snapshot);
+	}
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
 	}
 
-	constexpr int MAX_SLOTS_ON_STACK = 5;
-	// Don't default initialize the Callable objects on the stack, just reserve the space - we'll memnew_placement() them later.
-	alignas(Callable) uint8_t slot_callable_stack[sizeof(Callable) * MAX_SLOTS_ON_STACK];
-	uint32_t slot_flags_stack[MAX_SLOTS_ON_STACK];
-
-	Callable *slot_callables = (Callable *)slot_callable_stack;
-	uint32_t *slot_flags = slot_flags_stack;
-	uint32_t slot_count = 0;
+	SignalData::Snapshot *snapshot = nullptr;
 
 	{
+		// Only the lookup and the snapshot reference are done under the lock,
+		// and one-shot disconnections when there are any.
 		OBJ_SIGNAL_LOCK
 
 		SignalData *s = signal_map.getptr(p_name);
-		if (!s) {
-#ifdef DEBUG_ENABLED
-			bool signal_is_valid = ClassDB::has_signal(get_class_name(), p_name);
-			//check in script
-			ERR_FAIL_COND_V_MSG(!signal_is_valid && script_instance && !script_instance->get_script()->has_script_signal(p_name), ERR_UNAVAILABLE, vformat("Can't emit non-existing signal \"%s\".", p_name));
-#endif
-			//not connected? just return
-			return ERR_UNAVAILABLE;
-		}
-
-		if (s->slot_map.size() > MAX_SLOTS_ON_STACK) {
-			slot_callables = (Callable *)memalloc(sizeof(Callable) * s->slot_map.size());
-			slot_flags = (uint32_t *)memalloc(sizeof(uint32_t) * s->slot_map.size());
+		if (s) {
+			// Ensure that disconnecting the signal or even deleting the object
+			// will not affect the signal calling. The snapshot is only rebuilt
+			// after the connections change, so emitting doesn't copy them.
+			snapshot = s->get_snapshot();
 		}
 
-		// Ensure that disconnecting the signal or even deleting the object
-		// will not affect the signal calling.
-		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-			slot_flags[slot_count] = slot_kv.value.conn.flags;
-			++slot_count;
-		}
-
-		DEV_ASSERT(slot_count == s->slot_map.size());
-
 		// Disconnect all one-shot connections before emitting to prevent recursion.
-		for (uint32_t i = 0; i < slot_count; ++i) {
-			bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+		if (snapshot && snapshot->has_one_shot) {
+			for (uint32_t i = 0; i < snapshot->callables.size(); ++i) {
+				bool disconnect = snapshot->flags[i] & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-			if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
-				// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
-				disconnect = false;
-			}
+				if (disconnect && (snapshot->flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+					// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
+					disconnect = false;
+				}
 #endif
-			if (disconnect) {
-				_disconnect(p_name, slot_callables[i]);
+				if (disconnect) {
+					_disconnect(p_name, snapshot->callables[i]);
+				}
 			}
 		}
 	}
 
+	if (!snapshot) {
+#ifdef DEBUG_ENABLED
+		// Validated outside of the signal lock, ClassDB and scripts take their own locks.
+		bool signal_is_valid = ClassDB::has_signal(get_class_name(), p_name);
+		//check in script
+		ERR_FAIL_COND_V_MSG(!signal_is_valid && script_instance && !script_instance->get_script()->has_script_signal(p_name), ERR_UNAVAILABLE, vformat("Can't emit non-existing signal \"%s\".", p_name));
+#endif
+		//not connected? just return
+		return ERR_UNAVAILABLE;
+	}
+
+	const uint32_t slot_count = snapshot->callables.size();
+
 	OBJ_DEBUG_LOCK
 
 	// If this is a ref-counted object, prevent it from being destroyed during signal
@@ -1344,8 +1350,8 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Variant source = this;
 
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+		const Callable &callable = snapshot->callables[i];
+		const uint32_t &flags = snapshot->flags[i];
 
 		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
@@ -1410,14 +1416,7 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
-	}
-
-	if (slot_callables != (Callable *)slot_callable_stack) {
-		memfree(slot_callables);
-		memfree(slot_flags);
-	}
+	SignalData::unref_snapshot(snapshot);
 
 	if (pending_unref) {
 		// We have to do the same Ref<T> would do. We can't just use Ref<T>
@@ -1669,6 +1668,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->clear_snapshot();
 
 	return OK;
 }
@@ -1749,6 +1749,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->clear_snapshot();
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -2491,13 +2492,24 @@ void postinitialize_handler(Object *p_object) {
 
 void ObjectDB::debug_objects(DebugFunc p_func, void *p_user_data) {
 	spin_lock.lock();
-
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object, p_user_data);
+	// Makes remove_instance() wait for the lock, so objects aren't freed while being visited.
+	debugging.set();
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	const uint32_t max = slot_max.get();
+	for (uint32_t i = 0, count = slot_count.get(); i < max && count != 0; i++) {
+		ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.id.get() == 0) {
+			continue;
+		}
+		Object *object = object_slot.object.load(std::memory_order_acquire);
+		if (object) {
+			p_func(object, p_user_data);
 			count--;
 		}
 	}
+
+	debugging.clear();
 	spin_lock.unlock();
 }
 
@@ -2547,46 +2559,114 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 }
 #endif
 
+struct ObjectDB::ThreadCache {
+	static constexpr uint32_t SIZE = 256;
+	static constexpr uint32_t BATCH = 64;
+	static constexpr uint64_t VALIDATOR_BATCH = 1024;
+
+	uint32_t slots[SIZE];
+	uint32_t count = 0;
+	uint32_t generation = 0;
+	uint64_t next_validator = 0;
+	uint64_t validator_end = 0;
+
+	_FORCE_INLINE_ void validate() {
+		const uint32_t current = ObjectDB::generation.get();
+		if (unlikely(generation != current)) {
+			// ObjectDB was cleaned up since this thread last used it.
+			count = 0;
+			next_validator = 0;
+			validator_end = 0;
+			generation = current;
+		}
+	}
+
+	~ThreadCache() {
+		if (count > 0 && generation == ObjectDB::generation.get()) {
+			ObjectDB::_flush_cache(*this, 0);
+		}
+	}
+};
+
 SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+SafeNumeric<uint32_t> ObjectDB::slot_count;
+SafeNumeric<uint32_t> ObjectDB::slot_max;
+ObjectDB::ObjectSlot *ObjectDB::pages[OBJECTDB_MAX_PAGES] = {};
+LocalVector<uint32_t> ObjectDB::free_slots;
+SafeNumeric<uint64_t> ObjectDB::validator_counter;
+SafeNumeric<uint32_t> ObjectDB::generation;
+SafeFlag ObjectDB::debugging;
+thread_local ObjectDB::ThreadCache ObjectDB::thread_cache;
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	return slot_count.get();
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
+void ObjectDB::_refill_cache(ThreadCache &r_cache) {
 	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+	if (free_slots.is_empty()) {
+		const uint32_t first_slot = slot_max.get();
+		const uint32_t page = first_slot >> OBJECTDB_PAGE_BITS;
+		CRASH_COND(page == OBJECTDB_MAX_PAGES);
+
+		ObjectSlot *new_page = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_PAGE_SIZE);
+		for (uint32_t i = 0; i < OBJECTDB_PAGE_SIZE; i++) {
+			memnew_placement(&new_page[i], ObjectSlot);
+			new_page[i].object.store(nullptr, std::memory_order_relaxed);
 		}
-		slot_max = new_slot_max;
+		pages[page] = new_page;
+
+		// Pushed in reverse, so lower slots are handed out first.
+		for (uint32_t i = OBJECTDB_PAGE_SIZE; i > 0; i--) {
+			free_slots.push_back(first_slot + i - 1);
+		}
+		// Publish the page only once it's initialized, lookups rely on it.
+		slot_max.set(first_slot + OBJECTDB_PAGE_SIZE);
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
-		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+	uint32_t remaining = free_slots.size();
+	const uint32_t take = MIN(remaining, ThreadCache::BATCH);
+	for (uint32_t i = 0; i < take; i++) {
+		r_cache.slots[r_cache.count++] = free_slots[--remaining];
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
+	free_slots.resize(remaining);
+
+	spin_lock.unlock();
+}
+
+void ObjectDB::_flush_cache(ThreadCache &r_cache, uint32_t p_keep) {
+	spin_lock.lock();
+	for (uint32_t i = p_keep; i < r_cache.count; i++) {
+		free_slots.push_back(r_cache.slots[i]);
 	}
-	object_slots[slot].validator = validator_counter;
+	r_cache.count = p_keep;
+	spin_lock.unlock();
+}
 
-	uint64_t id = validator_counter;
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	ThreadCache &cache = thread_cache;
+	cache.validate();
+
+	if (unlikely(cache.count == 0)) {
+		_refill_cache(cache);
+	}
+
+	const uint32_t slot = cache.slots[--cache.count];
+	ObjectSlot &object_slot = _get_slot(slot);
+	ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
+
+	// Validators are reserved in blocks per thread, so they stay unique without contention.
+	uint64_t validator = 0;
+	while (validator == 0) {
+		if (unlikely(cache.next_validator == cache.validator_end)) {
+			cache.next_validator = validator_counter.postadd(ThreadCache::VALIDATOR_BATCH);
+			cache.validator_end = cache.next_validator + ThreadCache::VALIDATOR_BATCH;
+		}
+		validator = cache.next_validator++ & OBJECTDB_VALIDATOR_MASK;
+	}
+
+	uint64_t id = validator;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -2594,9 +2674,11 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
+	// Both stores release, so a lookup that sees the new id also sees the new pointer.
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.id.set(id);
 
-	spin_lock.unlock();
+	slot_count.increment();
 
 	return ObjectID(id);
 }
@@ -2605,33 +2687,31 @@ void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
 
-	spin_lock.lock();
+	ObjectSlot &object_slot = _get_slot(slot);
 
 #ifdef DEBUG_ENABLED
+	ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
+	ERR_FAIL_COND(object_slot.id.get() != t);
+#endif
 
-	if (object_slots[slot].object != p_object) {
+	//invalidate, so checks against it fail
+	object_slot.id.set(0);
+	object_slot.object.store(nullptr, std::memory_order_release);
+	slot_count.decrement();
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (unlikely(debugging.is_set())) {
+		// debug_objects() may be visiting this object, wait until it's done.
+		spin_lock.lock();
 		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
-	}
-	{
-		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
-		}
 	}
 
-#endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
-
-	spin_lock.unlock();
+	ThreadCache &cache = thread_cache;
+	cache.validate();
+	if (unlikely(cache.count == ThreadCache::SIZE)) {
+		_flush_cache(cache, ThreadCache::SIZE - ThreadCache::BATCH);
+	}
+	cache.slots[cache.count++] = slot;
 }
 
 void ObjectDB::setup() {
@@ -2641,8 +2721,9 @@ void ObjectDB::setup() {
 void ObjectDB::cleanup() {
 	spin_lock.lock();
 
-	if (slot_count > 0) {
-		WARN_PRINT(vformat("%d ObjectDB %s leaked at exit (run with `--verbose` for details).", slot_count, slot_count == 1 ? "instance was" : "instances were"));
+	const uint32_t leaked = slot_count.get();
+	if (leaked > 0) {
+		WARN_PRINT(vformat("%d ObjectDB %s leaked at exit (run with `--verbose` for details).", leaked, leaked == 1 ? "instance was" : "instances were"));
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			// Ensure calling the native classes because if a leaked instance has a script
 			// that overrides any of those methods, it'd not be OK to call them at this point,
@@ -2651,9 +2732,11 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, count = leaked, max = slot_max.get(); i < max && count != 0; i++) {
+				ObjectSlot &object_slot = _get_slot(i);
+				uint64_t id = object_slot.id.get();
+				if (id) {
+					Object *obj = object_slot.object.load(std::memory_order_acquire);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2666,7 +2749,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Reference count: " + itos((static_cast<RefCounted *>(obj))->get_reference_count());
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					DEV_ASSERT((id & OBJECTDB_SLOT_MAX_COUNT_MASK) == i);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2677,9 +2760,15 @@ void ObjectDB::cleanup() {
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < OBJECTDB_MAX_PAGES && pages[i]; i++) {
+		memfree(pages[i]);
+		pages[i] = nullptr;
 	}
+	free_slots.reset();
+	slot_max.set(0);
+	slot_count.set(0);
+	// Invalidates the per-thread slot caches, which still point to the freed pages.
+	generation.increment();
 
 	spin_lock.unlock();
 }
@@ -38,6 +38,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
@@ -634,9 +635,35 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// Immutable copy of the connections, shared by all emissions until they change.
+		// Handlers may connect or disconnect while it is being dispatched.
+		struct Snapshot {
+			SafeRefCount refcount;
+			LocalVector<Callable> callables;
+			LocalVector<uint32_t> flags;
+			bool has_one_shot = false;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot> slot_map;
+		Snapshot *snapshot = nullptr;
 		bool removable = false;
+
+		Snapshot *get_snapshot();
+		void clear_snapshot();
+		static void unref_snapshot(Snapshot *p_snapshot);
+
+		SignalData() {}
+		SignalData(const SignalData &p_other) :
+				user(p_other.user), slot_map(p_other.slot_map), removable(p_other.removable) {}
+		SignalData &operator=(const SignalData &p_other) {
+			clear_snapshot();
+			user = p_other.user;
+			slot_map = p_other.slot_map;
+			removable = p_other.removable;
+			return *this;
+		}
+		~SignalData() { clear_snapshot(); }
 	};
 	friend struct _ObjectSignalLock;
 	mutable Mutex *signal_mutex = nullptr;
@@ -1083,18 +1110,30 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
+	// Slots live in fixed pages that never move, so lookups only need to validate the full
+	// ObjectID stored in the slot and don't take any lock. Slot allocation goes through
+	// per-thread caches that are refilled from (and flushed to) a shared free list in batches.
+#define OBJECTDB_PAGE_BITS 12
+#define OBJECTDB_PAGE_SIZE (uint32_t(1) << OBJECTDB_PAGE_BITS)
+#define OBJECTDB_PAGE_MASK (OBJECTDB_PAGE_SIZE - 1)
+#define OBJECTDB_MAX_PAGES (uint32_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_PAGE_BITS))
+
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		SafeNumeric<uint64_t> id; // Zero if the slot is free.
+		std::atomic<Object *> object;
 	};
 
-	static SpinLock spin_lock;
-	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	struct ThreadCache;
+
+	static SpinLock spin_lock; // Protects the free list and page allocation.
+	static SafeNumeric<uint32_t> slot_count;
+	static SafeNumeric<uint32_t> slot_max;
+	static ObjectSlot *pages[OBJECTDB_MAX_PAGES];
+	static LocalVector<uint32_t> free_slots;
+	static SafeNumeric<uint64_t> validator_counter;
+	static SafeNumeric<uint32_t> generation;
+	static SafeFlag debugging;
+	static thread_local ThreadCache thread_cache;
 
 	friend class Object;
 	friend void unregister_core_types();
@@ -1103,6 +1142,13 @@ class ObjectDB {
 	static ObjectID add_instance(Object *p_object);
 	static void remove_instance(Object *p_object);
 
+	static void _refill_cache(ThreadCache &r_cache);
+	static void _flush_cache(ThreadCache &r_cache, uint32_t p_keep);
+
+	_ALWAYS_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return pages[p_slot >> OBJECTDB_PAGE_BITS][p_slot & OBJECTDB_PAGE_MASK];
+	}
+
 	friend void register_core_types();
 	static void setup();
 
@@ -1113,20 +1159,19 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
+		ERR_FAIL_COND_V(slot >= slot_max.get(), nullptr); // This should never happen unless RID is corrupted.
 
-		spin_lock.lock();
-
-		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		ObjectSlot &object_slot = _get_slot(slot);
+		if (unlikely(object_slot.id.get() != id)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed (and reused) while reading, validators are never reused.
+		if (unlikely(object_slot.id.get() != id)) {
+			return nullptr;
+		}
 
 		return object;
 	}
@@ -1143,6 +1188,27 @@ public:
 	static int get_object_count();
 };
 
+#ifdef DEBUG_ENABLED
+
+// Prevents an object from being freed while one of its methods runs.
+// Used by `Object::callp()` and by callers that bypass it.
+struct _ObjectDebugLock {
+	ObjectID obj_id;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj_id = p_obj->get_instance_id();
+		p_obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		Object *obj_ptr = ObjectDB::get_instance(obj_id);
+		if (likely(obj_ptr)) {
+			obj_ptr->_lock_index.unref();
+		}
+	}
+};
+
+#endif // DEBUG_ENABLED
+
 // Using `RequiredResult<T>` as the return type indicates that null will only be returned in the case of an error.
 // This allows GDExtension language bindings to use the appropriate error handling mechanism for that language
 // when null is returned (for example, throwing an exception), rather than simply returning the value.
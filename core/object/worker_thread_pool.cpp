@@ -59,6 +59,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	int pool_thread_index = thread_ids[Thread::get_caller_id()];
 	ThreadData &curr_thread = threads[pool_thread_index];
 	Task *prev_task = nullptr; // In case this is recursively called.
+	bool cancelled = false;
 
 	bool safe_for_nodes_backup = is_current_thread_safe_for_nodes();
 	CallQueue *call_queue_backup = MessageQueue::get_singleton() != MessageQueue::get_main_singleton() ? MessageQueue::get_singleton() : nullptr;
@@ -82,10 +83,17 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		if (p_task->pending_notify_yield_over) {
 			curr_thread.yield_is_over = true;
 		}
+		cancelled = p_task->cancelled;
 		task_mutex.unlock();
 	}
+#else
+	bool cancelled = p_task->cancelled;
 #endif
 
+	// Tasks whose dependencies got satisfied by this one finishing.
+	// Only non-empty after unlocking if they must run on this thread (no pool threads).
+	LocalVector<Task *> released_tasks;
+
 #ifdef THREADS_ENABLED
 	bool low_priority = p_task->low_priority;
 #endif
@@ -121,8 +129,13 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		if (do_post) {
+			{
+				MutexLock task_lock(task_mutex);
+				p_task->group->completed.set_to(true);
+				_release_dependents(p_task->group->dependents, false, released_tasks);
+				_post_released_tasks(released_tasks);
+			}
 			p_task->group->done_semaphore.post();
-			p_task->group->completed.set_to(true);
 		}
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
@@ -138,7 +151,12 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		task_mutex.lock();
 		task_allocator.free(p_task);
 	} else {
-		if (p_task->native_func) {
+		if (unlikely(cancelled)) {
+			// Cancelled after being queued. It's not run, but it still completes so waiters and dependents are released.
+			if (p_task->template_userdata) {
+				memdelete(p_task->template_userdata);
+			}
+		} else if (p_task->native_func) {
 			p_task->native_func(p_task->native_func_userdata);
 		} else if (p_task->template_userdata) {
 			p_task->template_userdata->callback();
@@ -148,18 +166,8 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		task_mutex.lock();
-		p_task->completed = true;
-		p_task->pool_thread_index = -1;
-		if (p_task->waiting_user) {
-			p_task->done_semaphore.post(p_task->waiting_user);
-		}
-		// Let awaiters know.
-		for (uint32_t i = 0; i < threads.size(); i++) {
-			if (threads[i].awaited_task == p_task) {
-				threads[i].cond_var.notify_one();
-				threads[i].signaled = true;
-			}
-		}
+		_complete_task(p_task, released_tasks);
+		_post_released_tasks(released_tasks);
 	}
 
 #ifdef THREADS_ENABLED
@@ -181,15 +189,47 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
 	MessageQueue::set_thread_singleton_override(call_queue_backup);
 #endif
+
+	for (Task *task : released_tasks) {
+		_process_task(task);
+	}
+}
+
+void WorkerThreadPool::_complete_task(Task *p_task, LocalVector<Task *> &r_released) {
+	p_task->completed = true;
+	p_task->pool_thread_index = -1;
+	if (p_task->waiting_user) {
+		p_task->done_semaphore.post(p_task->waiting_user);
+	}
+	// Let awaiters know.
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (threads[i].awaited_task == p_task) {
+			threads[i].cond_var.notify_one();
+			threads[i].signaled = true;
+		}
+	}
+	_release_dependents(p_task->dependents, p_task->cancelled, r_released);
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
 	Thread::set_name(vformat("WorkerThread %d", thread_data->index));
 
+	uint32_t local_streak = 0;
 	while (true) {
 		Task *task_to_process = nullptr;
-		{
+
+		// Fast path: take work from the local queues without touching the task mutex.
+		// The streak limit makes sure the shared queue is still looked at every once in a while.
+		if (local_streak < LOCAL_TASK_STREAK_MAX) {
+			task_to_process = thread_data->pool->_pop_local_task(thread_data, false);
+		}
+
+		if (task_to_process) {
+			local_streak++;
+		} else {
+			local_streak = 0;
+
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
 			MutexLock lock(thread_data->pool->task_mutex);
@@ -202,17 +242,23 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 				thread_data->signaled = false;
 
-				if (!thread_data->pool->task_queue.first()) {
-					// There wasn't a task available yet.
-					// Let's wait for the next notification, then recheck.
-					thread_data->cond_var.wait(lock);
-					continue;
+				if (thread_data->pool->task_queue.first()) {
+					// Got a task to process! Remove it from the queue, then break into the task handling section.
+					task_to_process = thread_data->pool->task_queue.first()->self();
+					thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
+					break;
 				}
 
-				// Got a task to process! Remove it from the queue, then break into the task handling section.
-				task_to_process = thread_data->pool->task_queue.first()->self();
-				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
-				break;
+				// Pushes to the local queues happen with the mutex held, so if nothing can be
+				// taken now, the notification for any later push can't be missed.
+				task_to_process = thread_data->pool->_pop_local_task(thread_data, true);
+				if (task_to_process) {
+					break;
+				}
+
+				// There wasn't a task available yet.
+				// Let's wait for the next notification, then recheck.
+				thread_data->cond_var.wait(lock);
 			}
 		}
 
@@ -246,24 +292,35 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
 
+	// Pump tasks must be visible to the restrictions in _wait_collaboratively(), so they always use the shared queues.
+	ThreadData *local_thread = p_pump_task ? nullptr : caller_pool_thread;
+
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
-		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
-			if (!p_high_priority) {
-				low_priority_threads_used++;
-			}
-			to_process++;
-		} else {
-			// Too many threads using low priority, must go to queue.
-			low_priority_task_queue.add_last(&p_tasks[i]->task_elem);
-			to_promote++;
-		}
+		_queue_task(p_tasks[i], local_thread, to_process, to_promote);
 	}
 
 	_notify_threads(caller_pool_thread, to_process, to_promote);
 }
 
+void WorkerThreadPool::_queue_task(Task *p_task, ThreadData *p_local_thread, uint32_t &r_to_process, uint32_t &r_to_promote) {
+	if (!p_task->low_priority || low_priority_threads_used < max_low_priority_threads) {
+		// High-priority tasks posted from a pool thread go to its own queue, where idle threads can steal them.
+		// Low-priority tasks need the bookkeeping of the shared queues.
+		if (!p_local_thread || p_task->low_priority || !p_local_thread->local_queue.push(p_task)) {
+			task_queue.add_last(&p_task->task_elem);
+		}
+		if (p_task->low_priority) {
+			low_priority_threads_used++;
+		}
+		r_to_process++;
+	} else {
+		// Too many threads using low priority, must go to queue.
+		low_priority_task_queue.add_last(&p_task->task_elem);
+		r_to_promote++;
+	}
+}
+
 void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count) {
 	uint32_t to_process = p_process_count;
 	uint32_t to_promote = p_promote_count;
@@ -340,11 +397,177 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_pop_local_task(ThreadData *p_thread_data, bool p_exhaustive) {
+	Task *task = nullptr;
+	if (p_thread_data->local_queue.pop(task)) {
+		return task;
+	}
+
+	uint32_t thread_count = threads.size();
+	if (thread_count < 2) {
+		return nullptr;
+	}
+
+	// Start at a different victim each time so stealers don't all hammer the same queue.
+	uint32_t start = steal_index.increment();
+	for (uint32_t i = 0; i < thread_count; i++) {
+		ThreadData &victim = threads[(start + i) % thread_count];
+		if (&victim == p_thread_data) {
+			continue;
+		}
+		while (true) {
+			if (victim.local_queue.steal(task)) {
+				return task;
+			}
+			// A failed steal may only mean another thread won the race for the same task.
+			if (!p_exhaustive || victim.local_queue.is_empty()) {
+				break;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+bool WorkerThreadPool::_has_local_tasks() const {
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (!threads[i].local_queue.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Returns how many of the dependencies are still pending, and registers the task or group as a dependent of those.
+// Dependencies that are already finished are skipped, but if any of them was cancelled, so is the dependent.
+uint32_t WorkerThreadPool::_register_dependencies(const Span<TaskID> &p_dependencies, Task *p_task, Group *p_group, bool &r_cancelled) {
+	uint32_t pending = 0;
+	for (const TaskID &dependency : p_dependencies) {
+		Task **taskp = tasks.getptr(dependency);
+		if (taskp) {
+			Task *predecessor = *taskp;
+			if (predecessor->completed) {
+				r_cancelled = r_cancelled || predecessor->cancelled;
+				continue;
+			}
+			if (p_task) {
+				predecessor->dependents.tasks.push_back(p_task);
+			} else {
+				predecessor->dependents.groups.push_back(p_group);
+			}
+			pending++;
+			continue;
+		}
+
+		Group **groupp = groups.getptr(dependency);
+		if (groupp) {
+			Group *predecessor = *groupp;
+			if (predecessor->completed.is_set()) {
+				r_cancelled = r_cancelled || predecessor->cancelled;
+				continue;
+			}
+			if (p_task) {
+				predecessor->dependents.tasks.push_back(p_task);
+			} else {
+				predecessor->dependents.groups.push_back(p_group);
+			}
+			pending++;
+			continue;
+		}
+
+		// Tasks and groups are only forgotten once they have been waited for, which means they are done.
+		ERR_CONTINUE_MSG(dependency <= INVALID_TASK_ID || dependency >= (TaskID)last_task, vformat("Invalid task or group ID as dependency: %d.", dependency));
+	}
+	return pending;
+}
+
+void WorkerThreadPool::_release_dependents(Dependents &p_dependents, bool p_cancelled, LocalVector<Task *> &r_released) {
+	for (Task *task : p_dependents.tasks) {
+		task->cancelled = task->cancelled || p_cancelled;
+		DEV_ASSERT(task->pending_dependencies > 0);
+		task->pending_dependencies--;
+		if (task->pending_dependencies == 0) {
+			r_released.push_back(task);
+		}
+	}
+	for (Group *group : p_dependents.groups) {
+		group->cancelled = group->cancelled || p_cancelled;
+		DEV_ASSERT(group->pending_dependencies > 0);
+		group->pending_dependencies--;
+		if (group->pending_dependencies == 0) {
+			if (group->cancelled) {
+				_cancel_group(group, r_released);
+			} else {
+				for (Task *task : group->held_tasks) {
+					r_released.push_back(task);
+				}
+				group->held_tasks.clear();
+			}
+		}
+	}
+	p_dependents.tasks.clear();
+	p_dependents.groups.clear();
+}
+
+// Queues the released tasks. If there are no pool threads, they are left in the vector so the caller runs them after unlocking.
+void WorkerThreadPool::_post_released_tasks(LocalVector<Task *> &r_released) {
+	if (r_released.is_empty()) {
+		return;
+	}
+
+	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
+	uint32_t to_process = 0;
+	uint32_t to_promote = 0;
+	uint32_t to_run_here = 0;
+
+	// Completing cancelled tasks may release further tasks, so the size is rechecked on every iteration.
+	for (uint32_t i = 0; i < r_released.size(); i++) {
+		Task *task = r_released[i];
+		if (task->cancelled) {
+			DEV_ASSERT(!task->group); // Cancelled groups never release their tasks.
+			if (task->template_userdata) {
+				memdelete(task->template_userdata);
+			}
+			_complete_task(task, r_released);
+		} else if (threads.is_empty()) {
+			r_released[to_run_here++] = task;
+		} else {
+			_queue_task(task, caller_pool_thread, to_process, to_promote);
+		}
+	}
+	r_released.resize(to_run_here);
+
+	if (to_process || to_promote) {
+		_notify_threads(caller_pool_thread, to_process, to_promote);
+	}
+}
+
+// Finishes a group that won't run because a dependency was cancelled.
+void WorkerThreadPool::_cancel_group(Group *p_group, LocalVector<Task *> &r_released) {
+	if (!p_group->held_tasks.is_empty() && p_group->held_tasks[0]->template_userdata) {
+		memdelete(p_group->held_tasks[0]->template_userdata); // Shared by all the tasks of the group.
+	}
+	for (Task *task : p_group->held_tasks) {
+		task_allocator.free(task);
+	}
+	p_group->held_tasks.clear();
+
+	p_group->completed.set_to(true);
+	_release_dependents(p_group->dependents, true, r_released);
+	p_group->done_semaphore.post();
+
+	uint32_t max_users = p_group->tasks_used + 1; // Add 1 because the thread waiting for it is also user.
+	uint32_t finished_users = p_group->finished.add(p_group->tasks_used); // The tasks will never run, so they finish here.
+	if (finished_users == max_users) {
+		group_allocator.free(p_group);
+	}
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task) {
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task, const Span<TaskID> &p_dependencies) {
 	MutexLock<BinaryMutex> lock(task_mutex);
 
 	// Get a free task
@@ -357,8 +580,26 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
 	task->is_pump_task = p_pump_task;
+	task->low_priority = !p_high_priority;
 	tasks.insert(id, task);
 
+	if (!p_dependencies.is_empty()) {
+		DEV_ASSERT(!p_pump_task);
+		bool cancelled = false;
+		task->pending_dependencies = _register_dependencies(p_dependencies, task, nullptr, cancelled);
+		task->cancelled = cancelled;
+		if (task->pending_dependencies) {
+			return id; // Posted once the dependencies are done.
+		}
+		if (cancelled) {
+			if (p_template_userdata) {
+				memdelete(p_template_userdata);
+			}
+			task->completed = true; // Nobody can be waiting for it or depending on it yet.
+			return id;
+		}
+	}
+
 #ifdef THREADS_ENABLED
 	if (p_pump_task) {
 		pump_task_count++;
@@ -390,6 +631,14 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_task_bind(const Callable &p_actio
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, false);
 }
 
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const Span<TaskID> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, false, p_dependencies);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_task_with_dependencies(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, false, p_dependencies.span());
+}
+
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	MutexLock task_lock(task_mutex);
 	const Task *const *taskp = tasks.getptr(p_task_id);
@@ -400,6 +649,37 @@ bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	return (*taskp)->completed;
 }
 
+Error WorkerThreadPool::cancel_task(TaskID p_task_id) {
+	MutexLock task_lock(task_mutex);
+	Task **taskp = tasks.getptr(p_task_id);
+	if (!taskp) {
+		ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Invalid Task ID"); // Invalid task
+	}
+	Task *task = *taskp;
+
+	if (task->cancelled) {
+		return OK;
+	}
+	if (task->completed || task->pool_thread_index != -1) {
+		return ERR_BUSY; // Too late.
+	}
+
+	// The task can't be taken out of a local queue by another thread, so instead of removing it,
+	// it's left wherever it is and skipped when it would run. Dependents get cancelled at that point.
+	task->cancelled = true;
+	return OK;
+}
+
+bool WorkerThreadPool::is_task_cancelled(TaskID p_task_id) const {
+	MutexLock task_lock(task_mutex);
+	const Task *const *taskp = tasks.getptr(p_task_id);
+	if (!taskp) {
+		ERR_FAIL_V_MSG(false, "Invalid Task ID"); // Invalid task
+	}
+
+	return (*taskp)->cancelled;
+}
+
 Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	task_mutex.lock();
 	Task **taskp = tasks.getptr(p_task_id);
@@ -518,7 +798,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || _has_local_tasks()) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -536,7 +816,10 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 			}
 
-			if (p_caller_pool_thread->pool->task_queue.first()) {
+			// Local queues never hold pump tasks, so they are always fine to take from here.
+			task_to_process = _pop_local_task(p_caller_pool_thread, true);
+
+			if (!task_to_process && p_caller_pool_thread->pool->task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				if ((p_task == ThreadData::YIELDING || p_caller_pool_thread->has_pump_task == true) && task_to_process->is_pump_task) {
 					task_to_process = nullptr;
@@ -589,7 +872,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_local_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -652,7 +935,7 @@ void WorkerThreadPool::notify_yield_over(TaskID p_task_id) {
 	td.cond_var.notify_one();
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Span<TaskID> &p_dependencies) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = MAX(1u, threads.size());
@@ -687,6 +970,7 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 			task->group = group;
 			task->callable = p_callable;
 			task->template_userdata = p_template_userdata;
+			task->low_priority = !p_high_priority;
 			tasks_posted[i] = task;
 			// No task ID is used.
 		}
@@ -694,6 +978,22 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 
 	groups[id] = group;
 
+	// Dependencies are ignored for empty groups, which are complete from the start.
+	if (p_tasks && !p_dependencies.is_empty()) {
+		bool cancelled = false;
+		group->pending_dependencies = _register_dependencies(p_dependencies, nullptr, group, cancelled);
+		group->cancelled = cancelled;
+		if (group->pending_dependencies || cancelled) {
+			group->held_tasks.resize(p_tasks);
+			memcpy(group->held_tasks.ptr(), tasks_posted, sizeof(Task *) * p_tasks);
+			if (!group->pending_dependencies) {
+				LocalVector<Task *> released; // Stays empty; nothing can depend on this group yet.
+				_cancel_group(group, released);
+			}
+			return id; // Posted once the dependencies are done.
+		}
+	}
+
 	_post_tasks(tasks_posted, p_tasks, p_high_priority, lock, false);
 
 	return id;
@@ -707,6 +1007,14 @@ WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_act
 	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
 }
 
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task_with_dependencies(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Span<TaskID> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_group_task_with_dependencies(const Callable &p_action, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies.span());
+}
+
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
 	MutexLock task_lock(task_mutex);
 	const Group *const *groupp = groups.getptr(p_group);
@@ -891,12 +1199,16 @@ void WorkerThreadPool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
 	ClassDB::bind_method(D_METHOD("get_caller_task_id"), &WorkerThreadPool::get_caller_task_id);
+	ClassDB::bind_method(D_METHOD("add_task_with_dependencies", "action", "dependencies", "high_priority", "description"), &WorkerThreadPool::add_task_with_dependencies, DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("cancel_task", "task_id"), &WorkerThreadPool::cancel_task);
+	ClassDB::bind_method(D_METHOD("is_task_cancelled", "task_id"), &WorkerThreadPool::is_task_cancelled);
 
 	ClassDB::bind_method(D_METHOD("add_group_task", "action", "elements", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_group_task_completed", "group_id"), &WorkerThreadPool::is_group_task_completed);
 	ClassDB::bind_method(D_METHOD("get_group_processed_element_count", "group_id"), &WorkerThreadPool::get_group_processed_element_count);
 	ClassDB::bind_method(D_METHOD("wait_for_group_task_completion", "group_id"), &WorkerThreadPool::wait_for_group_task_completion);
 	ClassDB::bind_method(D_METHOD("get_caller_group_id"), &WorkerThreadPool::get_caller_group_id);
+	ClassDB::bind_method(D_METHOD("add_group_task_with_dependencies", "action", "elements", "dependencies", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task_with_dependencies, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
 }
 
 WorkerThreadPool *WorkerThreadPool::get_named_pool(const StringName &p_name) {
@@ -40,6 +40,7 @@
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
+#include "core/templates/work_stealing_deque.h"
 #include "core/variant/callable.h"
 
 class WorkerThreadPool : public Object {
@@ -54,6 +55,13 @@ public:
 
 private:
 	struct Task;
+	struct Group;
+
+	// Tasks and groups released (or cancelled) when a task or group finishes.
+	struct Dependents {
+		LocalVector<Task *> tasks;
+		LocalVector<Group *> groups;
+	};
 
 	struct BaseTemplateUserdata {
 		virtual void callback() {}
@@ -70,6 +78,10 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		uint32_t pending_dependencies = 0;
+		bool cancelled = false;
+		LocalVector<Task *> held_tasks; // Not posted until the dependencies are done.
+		Dependents dependents;
 	};
 
 	struct Task {
@@ -83,6 +95,7 @@ private:
 		bool completed : 1;
 		bool pending_notify_yield_over : 1;
 		bool is_pump_task : 1;
+		bool cancelled : 1;
 		Group *group = nullptr;
 		SelfList<Task> task_elem;
 		uint32_t waiting_pool = 0;
@@ -90,17 +103,22 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		uint32_t pending_dependencies = 0;
+		Dependents dependents;
 
 		void free_template_userdata();
 		Task() :
 				completed(false),
 				pending_notify_yield_over(false),
 				is_pump_task(false),
+				cancelled(false),
 				task_elem(this) {}
 	};
 
 	static const uint32_t TASKS_PAGE_SIZE = 1024;
 	static const uint32_t GROUPS_PAGE_SIZE = 256;
+	static const uint32_t LOCAL_QUEUE_SIZE = 1024; // Per pool thread. Overflow goes to the shared queue.
+	static const uint32_t LOCAL_TASK_STREAK_MAX = 64; // Lock-free pops before a pool thread rechecks the shared queue.
 
 	PagedAllocator<Task, false, TASKS_PAGE_SIZE> task_allocator;
 	PagedAllocator<Group, false, GROUPS_PAGE_SIZE> group_allocator;
@@ -124,6 +142,8 @@ private:
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
+		// High-priority tasks posted by this thread. Only this thread pushes and pops; others steal.
+		WorkStealingDeque<Task *, LOCAL_QUEUE_SIZE> local_queue;
 
 		ThreadData() :
 				signaled(false),
@@ -169,6 +189,7 @@ private:
 	uint32_t max_low_priority_threads = 0;
 	uint32_t low_priority_threads_used = 0;
 	uint32_t notify_index = 0; // For rotating across threads, no help distributing load.
+	SafeNumeric<uint32_t> steal_index; // For rotating the first victim when stealing.
 
 	uint64_t last_task = 1;
 	int pump_task_count = 0;
@@ -179,11 +200,21 @@ private:
 
 	void _process_task(Task *task);
 
+	void _queue_task(Task *p_task, ThreadData *p_local_thread, uint32_t &r_to_process, uint32_t &r_to_promote);
 	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock, bool p_pump_task);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
 	bool _try_promote_low_priority_task();
 
+	Task *_pop_local_task(ThreadData *p_thread_data, bool p_exhaustive);
+	bool _has_local_tasks() const;
+
+	uint32_t _register_dependencies(const Span<TaskID> &p_dependencies, Task *p_task, Group *p_group, bool &r_cancelled);
+	void _release_dependents(Dependents &p_dependents, bool p_cancelled, LocalVector<Task *> &r_released);
+	void _post_released_tasks(LocalVector<Task *> &r_released);
+	void _complete_task(Task *p_task, LocalVector<Task *> &r_released);
+	void _cancel_group(Group *p_group, LocalVector<Task *> &r_released);
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -195,8 +226,8 @@ private:
 	static thread_local UnlockableLocks unlockable_locks[MAX_UNLOCKABLE_LOCKS];
 #endif
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task = false);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task = false, const Span<TaskID> &p_dependencies = Span<TaskID>());
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Span<TaskID> &p_dependencies = Span<TaskID>());
 
 	template <typename C, typename M, typename U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -235,35 +266,43 @@ protected:
 
 public:
 	template <typename C, typename M, typename U>
-	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String()) {
+	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String(), const Span<TaskID> &p_dependencies = Span<TaskID>()) {
 		typedef TaskUserData<C, M, U> TUD;
 		TUD *ud = memnew(TUD);
 		ud->instance = p_instance;
 		ud->method = p_method;
 		ud->userdata = p_userdata;
-		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description);
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, false, p_dependencies);
 	}
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String(), bool p_pump_task = false);
 	TaskID add_task_bind(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// The task is posted once every task and group in `p_dependencies` has finished.
+	TaskID add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const Span<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_task_with_dependencies(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
+	Error cancel_task(TaskID p_task_id);
+	bool is_task_cancelled(TaskID p_task_id) const;
 
 	void yield();
 	void notify_yield_over(TaskID p_task_id);
 
 	template <typename C, typename M, typename U>
-	GroupID add_template_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+	GroupID add_template_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String(), const Span<TaskID> &p_dependencies = Span<TaskID>()) {
 		typedef GroupUserData<C, M, U> GroupUD;
 		GroupUD *ud = memnew(GroupUD);
 		ud->instance = p_instance;
 		ud->method = p_method;
 		ud->userdata = p_userdata;
-		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description);
+		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
 	}
 	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_native_group_task_with_dependencies(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Span<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_group_task_with_dependencies(const Callable &p_action, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
@@ -0,0 +1,205 @@
+/**************************************************************************/
+/*  frame_arena.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_arena.h"
+
+#include "core/os/memory.h"
+#include "core/os/mutex.h"
+#include "core/templates/safe_refcount.h"
+
+// Each allocation is prefixed with its size, so realloc can move it out of the arena.
+static constexpr size_t HEADER_SIZE = Memory::get_aligned_address(sizeof(uint64_t), Memory::MAX_ALIGN);
+static constexpr uint32_t INVALID_CHUNK = UINT32_MAX;
+
+uint8_t *FrameArena::region = nullptr;
+size_t FrameArena::region_size = 0;
+thread_local uint32_t FrameArena::scope_depth = 0;
+
+// One reference is held by the owning thread, plus one per live allocation.
+static SafeNumeric<uint32_t> *chunk_refs = nullptr;
+// Links the chunks owned by a thread. Only touched by the owner.
+static uint32_t *chunk_next = nullptr;
+
+static BinaryMutex free_chunks_mutex;
+static uint32_t *free_chunks = nullptr;
+static uint32_t free_chunk_count = 0;
+
+struct FrameArenaThread {
+	uint32_t current = INVALID_CHUNK; // Head of the owned chunk list, bump allocated from.
+	size_t offset = 0;
+	FrameArena::Stats frame;
+	FrameArena::Stats last_frame;
+
+	~FrameArenaThread();
+};
+
+static thread_local FrameArenaThread arena_thread;
+
+static bool _acquire_chunk(uint32_t &r_chunk) {
+	MutexLock lock(free_chunks_mutex);
+	if (free_chunk_count == 0) {
+		return false;
+	}
+	r_chunk = free_chunks[--free_chunk_count];
+	chunk_refs[r_chunk].set(1);
+	return true;
+}
+
+static void _release_chunk(uint32_t p_chunk) {
+	if (chunk_refs[p_chunk].decrement() > 0) {
+		return; // Payloads still alive, the last free() will return it.
+	}
+	MutexLock lock(free_chunks_mutex);
+	free_chunks[free_chunk_count++] = p_chunk;
+}
+
+FrameArenaThread::~FrameArenaThread() {
+	uint32_t chunk = current;
+	while (chunk != INVALID_CHUNK) {
+		uint32_t next = chunk_next[chunk];
+		_release_chunk(chunk);
+		chunk = next;
+	}
+	current = INVALID_CHUNK;
+}
+
+void FrameArena::setup(size_t p_size) {
+	ERR_FAIL_COND_MSG(region != nullptr, "FrameArena was already set up.");
+	const uint32_t chunk_count = p_size / CHUNK_SIZE;
+	if (chunk_count == 0) {
+		return;
+	}
+
+	// Never released: payloads handed out from the region may outlive the main loop.
+	region = (uint8_t *)Memory::alloc_static(chunk_count * CHUNK_SIZE);
+	ERR_FAIL_NULL(region);
+	chunk_refs = memnew_arr(SafeNumeric<uint32_t>, chunk_count);
+	chunk_next = memnew_arr(uint32_t, chunk_count);
+	free_chunks = memnew_arr(uint32_t, chunk_count);
+	for (uint32_t i = 0; i < chunk_count; i++) {
+		free_chunks[i] = chunk_count - i - 1;
+	}
+	free_chunk_count = chunk_count;
+
+	region_size = chunk_count * CHUNK_SIZE;
+}
+
+void FrameArena::push_scope() {
+	scope_depth++;
+}
+
+void FrameArena::pop_scope() {
+	DEV_ASSERT(scope_depth > 0);
+	scope_depth--;
+}
+
+void *FrameArena::alloc(size_t p_bytes) {
+	FrameArenaThread &thread = arena_thread;
+	const size_t size = Memory::get_aligned_address(p_bytes + HEADER_SIZE, Memory::MAX_ALIGN);
+	if (size > MAX_ALLOCATION_SIZE) {
+		thread.frame.fallbacks++;
+		return nullptr;
+	}
+
+	if (thread.current == INVALID_CHUNK || thread.offset + size > CHUNK_SIZE) {
+		uint32_t chunk;
+		if (!_acquire_chunk(chunk)) {
+			thread.frame.fallbacks++;
+			return nullptr;
+		}
+		chunk_next[chunk] = thread.current;
+		thread.current = chunk;
+		thread.offset = 0;
+	}
+
+	uint8_t *mem = region + size_t(thread.current) * CHUNK_SIZE + thread.offset;
+	thread.offset += size;
+	chunk_refs[thread.current].increment();
+
+	*(uint64_t *)mem = p_bytes;
+
+	thread.frame.allocations++;
+	thread.frame.bytes += p_bytes;
+	return mem + HEADER_SIZE;
+}
+
+size_t FrameArena::get_allocation_size(const void *p_ptr) {
+	return *(const uint64_t *)((const uint8_t *)p_ptr - HEADER_SIZE);
+}
+
+void FrameArena::free(void *p_ptr) {
+	_release_chunk(((uintptr_t)p_ptr - (uintptr_t)region) / CHUNK_SIZE);
+}
+
+void FrameArena::end_frame() {
+	FrameArenaThread &thread = arena_thread;
+
+	// Keep the first chunk that is entirely unused for the next frame, hand everything
+	// else back. Chunks with escaped payloads stay out of the pool until those are freed.
+	uint32_t kept = INVALID_CHUNK;
+	uint32_t chunk = thread.current;
+	while (chunk != INVALID_CHUNK) {
+		const uint32_t next = chunk_next[chunk];
+		if (kept == INVALID_CHUNK && chunk_refs[chunk].get() == 1) {
+			kept = chunk;
+		} else {
+			if (chunk_refs[chunk].get() > 1) {
+				thread.frame.pinned_chunks++;
+			}
+			_release_chunk(chunk);
+		}
+		chunk = next;
+	}
+
+	thread.current = kept;
+	if (kept != INVALID_CHUNK) {
+		chunk_next[kept] = INVALID_CHUNK;
+	}
+	thread.offset = 0;
+
+	thread.last_frame = thread.frame;
+	thread.frame = Stats();
+}
+
+FrameArena::Stats FrameArena::get_last_frame_stats() {
+	return arena_thread.last_frame;
+}
+
+uint64_t FrameArena::get_last_frame_allocations() {
+	return arena_thread.last_frame.allocations;
+}
+
+uint64_t FrameArena::get_last_frame_fallbacks() {
+	return arena_thread.last_frame.fallbacks;
+}
+
+uint64_t FrameArena::get_last_frame_pinned_chunks() {
+	return arena_thread.last_frame.pinned_chunks;
+}
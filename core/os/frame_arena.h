@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  frame_arena.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/typedefs.h"
+
+// Opt-in bump allocator for short-lived payloads (mostly CowData buffers
+// behind String, Vector and Array) created during a frame.
+//
+// While a thread is inside a FrameArena::Scope, small Memory::alloc_static()
+// requests are carved out of per-thread chunks of a region reserved once at
+// startup instead of going to malloc. Each chunk counts its live allocations;
+// at FrameArena::end_frame() every chunk whose payloads were all freed is
+// recycled at once. Payloads that escape the frame simply keep their chunk
+// alive until they are freed (from any thread), and when the region runs out
+// allocations fall back to malloc, so the arena never changes semantics.
+class FrameArena {
+public:
+	static constexpr size_t CHUNK_SIZE = 16 * 1024;
+	static constexpr size_t MAX_ALLOCATION_SIZE = 1024;
+
+	struct Stats {
+		uint64_t allocations = 0; // Served from the arena, i.e. malloc calls avoided.
+		uint64_t bytes = 0;
+		uint64_t fallbacks = 0; // Requested inside a scope, but served by malloc.
+		uint64_t pinned_chunks = 0; // Chunks kept alive by escaped payloads at the end of the frame.
+	};
+
+	class Scope {
+	public:
+		_FORCE_INLINE_ Scope() { push_scope(); }
+		_FORCE_INLINE_ ~Scope() { pop_scope(); }
+	};
+
+private:
+	static uint8_t *region;
+	static size_t region_size;
+	static thread_local uint32_t scope_depth;
+
+public:
+	static void setup(size_t p_size);
+	_FORCE_INLINE_ static bool is_enabled() { return region_size != 0; }
+
+	_FORCE_INLINE_ static bool is_active() { return region_size != 0 && scope_depth != 0; }
+	_FORCE_INLINE_ static bool owns(const void *p_ptr) { return (uintptr_t)p_ptr - (uintptr_t)region < region_size; }
+
+	static void push_scope();
+	static void pop_scope();
+
+	// Returns nullptr if the request can't be served, the caller must then use malloc.
+	static void *alloc(size_t p_bytes);
+	static size_t get_allocation_size(const void *p_ptr);
+	static void free(void *p_ptr);
+
+	// Recycles the calling thread's unused chunks. Called by the main loop for the main thread,
+	// other threads that open scopes must call it themselves.
+	static void end_frame();
+	static Stats get_last_frame_stats();
+
+	static uint64_t get_last_frame_allocations();
+	static uint64_t get_last_frame_fallbacks();
+	static uint64_t get_last_frame_pinned_chunks();
+};
@@ -0,0 +1,232 @@
+/**************************************************************************/
+/*  heap_profiler.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "heap_profiler.h"
+
+#include "core/os/mutex.h"
+#include "core/os/os.h"
+#include "core/templates/hash_map.h"
+
+// Frames belonging to the profiler itself: the capture function, record_alloc() and the Memory function calling it.
+static constexpr int SKIP_FRAMES = 3;
+static constexpr uint32_t FILTER_SIZE = 16384;
+
+SafeFlag HeapProfiler::active;
+thread_local const char *HeapProfiler::current_tag = nullptr;
+
+struct HeapProfilerCallsiteKey {
+	void *frames[HeapProfiler::MAX_FRAMES];
+	int frame_count = 0;
+	const char *tag = nullptr;
+
+	uint32_t hash() const {
+		uint32_t h = hash_murmur3_buffer(frames, frame_count * sizeof(void *));
+		return hash_murmur3_one_64((uint64_t)tag, h);
+	}
+
+	bool operator==(const HeapProfilerCallsiteKey &p_other) const {
+		return frame_count == p_other.frame_count && tag == p_other.tag && memcmp(frames, p_other.frames, frame_count * sizeof(void *)) == 0;
+	}
+};
+
+struct HeapProfilerSample {
+	uint32_t callsite = 0;
+	uint64_t weight = 0;
+};
+
+struct HeapProfilerThread {
+	int64_t countdown = 0;
+	bool busy = false; // Set while the profiler itself allocates.
+};
+
+static thread_local HeapProfilerThread profiler_thread;
+
+static BinaryMutex profiler_mutex;
+static uint64_t sample_interval = 0;
+static uint64_t start_ticks = 0;
+static uint64_t live_bytes = 0;
+static LocalVector<HeapProfiler::Callsite> callsites;
+static HashMap<HeapProfilerCallsiteKey, uint32_t> callsite_map;
+static HashMap<void *, HeapProfilerSample> samples;
+
+// Counts sampled pointers per hash bucket, so frees of unsampled memory (nearly all of them)
+// are rejected without taking the lock.
+static SafeNumeric<uint32_t> sample_filter[FILTER_SIZE];
+
+static HeapProfiler::CaptureFunc capture_func = nullptr;
+static HeapProfiler::SymbolizeFunc symbolize_func = nullptr;
+
+_FORCE_INLINE_ static uint32_t _filter_index(void *p_ptr) {
+	return hash_murmur3_one_64((uint64_t)p_ptr) & (FILTER_SIZE - 1);
+}
+
+void HeapProfiler::start(uint64_t p_sample_interval) {
+	ERR_FAIL_COND_MSG(p_sample_interval == 0, "Heap profiler sample interval must be greater than zero.");
+
+	HeapProfilerThread &thread = profiler_thread;
+	thread.busy = true;
+	{
+		MutexLock lock(profiler_mutex);
+		for (const KeyValue<void *, HeapProfilerSample> &E : samples) {
+			sample_filter[_filter_index(E.key)].decrement();
+		}
+		samples.clear();
+		callsites.clear();
+		callsite_map.clear();
+		samples.reserve(4096);
+		callsites.reserve(1024);
+		callsite_map.reserve(1024);
+		live_bytes = 0;
+		sample_interval = p_sample_interval;
+		start_ticks = OS::get_singleton() ? OS::get_singleton()->get_ticks_usec() : 0;
+	}
+	thread.busy = false;
+
+	active.set();
+}
+
+void HeapProfiler::stop() {
+	active.clear();
+}
+
+uint64_t HeapProfiler::get_sample_interval() {
+	MutexLock lock(profiler_mutex);
+	return sample_interval;
+}
+
+double HeapProfiler::get_profiling_time() {
+	if (!OS::get_singleton()) {
+		return 0.0;
+	}
+	MutexLock lock(profiler_mutex);
+	return (OS::get_singleton()->get_ticks_usec() - start_ticks) / 1000000.0;
+}
+
+void HeapProfiler::record_alloc(void *p_ptr, size_t p_bytes) {
+	HeapProfilerThread &thread = profiler_thread;
+	if (thread.busy || p_ptr == nullptr) {
+		return;
+	}
+	thread.countdown -= p_bytes;
+	if (likely(thread.countdown > 0)) {
+		return;
+	}
+
+	thread.busy = true;
+
+	HeapProfilerCallsiteKey key;
+	key.tag = current_tag;
+	if (capture_func) {
+		void *frames[MAX_FRAMES + SKIP_FRAMES];
+		const int count = capture_func(frames, MAX_FRAMES + SKIP_FRAMES);
+		key.frame_count = MAX(0, count - SKIP_FRAMES);
+		memcpy(key.frames, frames + SKIP_FRAMES, key.frame_count * sizeof(void *));
+	}
+
+	{
+		MutexLock lock(profiler_mutex);
+		if (active.is_set()) {
+			thread.countdown = sample_interval;
+			const uint64_t weight = MAX(uint64_t(p_bytes), sample_interval);
+
+			uint32_t *index = callsite_map.getptr(key);
+			if (index == nullptr) {
+				Callsite callsite;
+				memcpy(callsite.frames, key.frames, key.frame_count * sizeof(void *));
+				callsite.frame_count = key.frame_count;
+				callsite.tag = key.tag;
+				callsites.push_back(callsite);
+				index = &callsite_map.insert(key, callsites.size() - 1)->value;
+			}
+
+			Callsite &callsite = callsites[*index];
+			callsite.live_bytes += weight;
+			callsite.allocated_bytes += weight;
+			live_bytes += weight;
+
+			HeapProfilerSample sample;
+			sample.callsite = *index;
+			sample.weight = weight;
+			samples.insert(p_ptr, sample);
+			sample_filter[_filter_index(p_ptr)].increment();
+		}
+	}
+
+	thread.busy = false;
+}
+
+void HeapProfiler::record_free(void *p_ptr) {
+	HeapProfilerThread &thread = profiler_thread;
+	if (thread.busy || sample_filter[_filter_index(p_ptr)].get() == 0) {
+		return;
+	}
+
+	thread.busy = true;
+	{
+		MutexLock lock(profiler_mutex);
+		HashMap<void *, HeapProfilerSample>::Iterator E = samples.find(p_ptr);
+		if (E) {
+			Callsite &callsite = callsites[E->value.callsite];
+			callsite.live_bytes -= E->value.weight;
+			live_bytes -= E->value.weight;
+			samples.remove(E);
+			sample_filter[_filter_index(p_ptr)].decrement();
+		}
+	}
+	thread.busy = false;
+}
+
+void HeapProfiler::set_backtrace_functions(CaptureFunc p_capture, SymbolizeFunc p_symbolize) {
+	capture_func = p_capture;
+	symbolize_func = p_symbolize;
+}
+
+String HeapProfiler::symbolize(void *p_address) {
+	if (symbolize_func) {
+		return symbolize_func(p_address);
+	}
+	return String::num_uint64((uint64_t)p_address, 16);
+}
+
+void HeapProfiler::get_callsites(LocalVector<Callsite> &r_callsites) {
+	HeapProfilerThread &thread = profiler_thread;
+	const bool was_busy = thread.busy;
+	thread.busy = true;
+	{
+		MutexLock lock(profiler_mutex);
+		r_callsites = callsites;
+	}
+	thread.busy = was_busy;
+}
+
+uint64_t HeapProfiler::get_live_bytes() {
+	MutexLock lock(profiler_mutex);
+	return live_bytes;
+}
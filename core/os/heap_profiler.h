@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*  heap_profiler.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+class String;
+
+// Low overhead sampling heap profiler fed by Memory::alloc_static() and friends.
+//
+// Roughly one allocation every `sample_interval` bytes is recorded together
+// with its call stack and the subsystem tag active on the allocating thread.
+// Each sample stands for `sample_interval` bytes (or its own size, if larger),
+// which gives unbiased estimates of live bytes and allocation volume per
+// callsite without tracking every allocation. Call stacks are only captured
+// if the platform registered a capture function, otherwise samples are only
+// aggregated per tag.
+class HeapProfiler {
+public:
+	static constexpr int MAX_FRAMES = 16;
+
+	typedef int (*CaptureFunc)(void **r_frames, int p_max_frames);
+	typedef String (*SymbolizeFunc)(void *p_address);
+
+	struct Callsite {
+		void *frames[MAX_FRAMES] = {};
+		int frame_count = 0;
+		const char *tag = nullptr;
+		uint64_t live_bytes = 0; // Estimated.
+		uint64_t allocated_bytes = 0; // Estimated, since profiling started.
+	};
+
+	// Marks allocations made by the current thread while in scope as belonging to a subsystem.
+	class Tag {
+		const char *previous;
+
+	public:
+		_FORCE_INLINE_ Tag(const char *p_tag) {
+			previous = current_tag;
+			current_tag = p_tag;
+		}
+		_FORCE_INLINE_ ~Tag() { current_tag = previous; }
+	};
+
+private:
+	static SafeFlag active;
+	static thread_local const char *current_tag;
+
+public:
+	_FORCE_INLINE_ static bool is_active() { return active.is_set(); }
+
+	static void start(uint64_t p_sample_interval);
+	static void stop();
+	static uint64_t get_sample_interval();
+	static double get_profiling_time();
+
+	static void record_alloc(void *p_ptr, size_t p_bytes);
+	static void record_free(void *p_ptr);
+
+	static void set_backtrace_functions(CaptureFunc p_capture, SymbolizeFunc p_symbolize);
+	static String symbolize(void *p_address);
+
+	static void get_callsites(LocalVector<Callsite> &r_callsites);
+	static uint64_t get_live_bytes();
+};
@@ -31,6 +31,8 @@
 #include "memory.h"
 
 #include "core/math/math_funcs_binary.h"
+#include "core/os/frame_arena.h"
+#include "core/os/heap_profiler.h"
 #include "core/profiling/profiling.h"
 #include "core/templates/safe_refcount.h"
 
@@ -105,15 +107,26 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	void *mem;
-	if constexpr (p_ensure_zero) {
-		mem = calloc(1, p_bytes + (prepad ? DATA_OFFSET : 0));
-	} else {
-		mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+	void *mem = nullptr;
+	if (unlikely(FrameArena::is_active())) {
+		mem = FrameArena::alloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+		if constexpr (p_ensure_zero) {
+			if (mem) {
+				memset(mem, 0, p_bytes + (prepad ? DATA_OFFSET : 0));
+			}
+		}
 	}
 
-	ERR_FAIL_NULL_V(mem, nullptr);
-	GodotProfileAlloc(mem, p_bytes + (prepad ? DATA_OFFSET : 0));
+	if (mem == nullptr) {
+		if constexpr (p_ensure_zero) {
+			mem = calloc(1, p_bytes + (prepad ? DATA_OFFSET : 0));
+		} else {
+			mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+		}
+
+		ERR_FAIL_NULL_V(mem, nullptr);
+		GodotProfileAlloc(mem, p_bytes + (prepad ? DATA_OFFSET : 0));
+	}
 
 	if (prepad) {
 		uint8_t *s8 = (uint8_t *)mem;
@@ -125,10 +138,13 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 		uint64_t new_mem_usage = _current_mem_usage.add(p_bytes);
 		_max_mem_usage.exchange_if_greater(new_mem_usage);
 #endif
-		return s8 + DATA_OFFSET;
-	} else {
-		return mem;
+		mem = s8 + DATA_OFFSET;
+	}
+
+	if (unlikely(HeapProfiler::is_active())) {
+		HeapProfiler::record_alloc(mem, p_bytes);
 	}
+	return mem;
 }
 
 template void *Memory::alloc_static<true>(size_t p_bytes, bool p_pad_align);
@@ -147,6 +163,24 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
+	if (unlikely(FrameArena::owns(p_memory))) {
+		// Arena blocks can't grow in place, move the payload to a new block.
+		const size_t prev_bytes = FrameArena::get_allocation_size(prepad ? mem - DATA_OFFSET : mem) - (prepad ? DATA_OFFSET : 0);
+		void *ret = nullptr;
+		if (p_bytes > 0) {
+			ret = alloc_static(p_bytes, p_pad_align);
+			ERR_FAIL_NULL_V(ret, nullptr);
+			memcpy(ret, p_memory, MIN(prev_bytes, p_bytes));
+		}
+		free_static(p_memory, p_pad_align);
+		return ret;
+	}
+
+	const bool profile = HeapProfiler::is_active();
+	if (unlikely(profile)) {
+		HeapProfiler::record_free(p_memory);
+	}
+
 	if (prepad) {
 		mem -= DATA_OFFSET;
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
@@ -176,6 +210,9 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 			*s = p_bytes;
 
+			if (unlikely(profile)) {
+				HeapProfiler::record_alloc(mem + DATA_OFFSET, p_bytes);
+			}
 			return mem + DATA_OFFSET;
 		}
 	} else {
@@ -185,6 +222,9 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 		ERR_FAIL_COND_V(mem == nullptr && p_bytes > 0, nullptr);
 		GodotProfileAlloc(mem, p_bytes);
 
+		if (unlikely(profile)) {
+			HeapProfiler::record_alloc(mem, p_bytes);
+		}
 		return mem;
 	}
 }
@@ -192,6 +232,10 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	ERR_FAIL_NULL(p_ptr);
 
+	if (unlikely(HeapProfiler::is_active())) {
+		HeapProfiler::record_free(p_ptr);
+	}
+
 	uint8_t *mem = (uint8_t *)p_ptr;
 
 #ifdef DEBUG_ENABLED
@@ -207,13 +251,15 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
 		_current_mem_usage.sub(*s);
 #endif
+	}
 
-		GodotProfileFree(mem);
-		free(mem);
-	} else {
-		GodotProfileFree(mem);
-		free(mem);
+	if (unlikely(FrameArena::owns(mem))) {
+		FrameArena::free(mem);
+		return;
 	}
+
+	GodotProfileFree(mem);
+	free(mem);
 }
 
 uint64_t Memory::get_mem_available() {
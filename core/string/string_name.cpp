@@ -36,34 +36,109 @@
 #include "core/templates/paged_allocator.h"
 
 struct StringName::Table {
-	constexpr static uint32_t TABLE_BITS = 16;
-	constexpr static uint32_t TABLE_LEN = 1 << TABLE_BITS;
-	constexpr static uint32_t TABLE_MASK = TABLE_LEN - 1;
+	// Names are split in shards by the low bits of their hash, each with its own
+	// lock, buckets and allocator, so threads interning different names rarely contend.
+	constexpr static uint32_t SHARD_BITS = 6;
+	constexpr static uint32_t SHARD_COUNT = 1 << SHARD_BITS;
+	constexpr static uint32_t SHARD_MASK = SHARD_COUNT - 1;
+	// Buckets per shard at startup, doubled whenever a shard holds more names than buckets.
+	constexpr static uint32_t INITIAL_BUCKET_BITS = 10;
+
+	struct alignas(64) Shard {
+		BinaryMutex mutex;
+		_Data **buckets = nullptr;
+		uint32_t bucket_mask = 0;
+		uint32_t count = 0;
+		PagedAllocator<_Data, false, 256> allocator;
+
+		_FORCE_INLINE_ _Data *&get_bucket(uint32_t p_hash) {
+			return buckets[(p_hash >> SHARD_BITS) & bucket_mask];
+		}
+
+		void insert(_Data *p_data) {
+			_Data *&bucket = get_bucket(p_data->hash);
+			p_data->next = bucket;
+			p_data->prev = nullptr;
+			if (bucket) {
+				bucket->prev = p_data;
+			}
+			bucket = p_data;
+
+			count++;
+			if (count > bucket_mask + 1) {
+				grow();
+			}
+		}
+
+		void remove(_Data *p_data) {
+			if (p_data->prev) {
+				p_data->prev->next = p_data->next;
+			} else {
+				get_bucket(p_data->hash) = p_data->next;
+			}
+			if (p_data->next) {
+				p_data->next->prev = p_data->prev;
+			}
+			count--;
+		}
+
+		void grow() {
+			_Data **old_buckets = buckets;
+			const uint32_t old_len = bucket_mask + 1;
+
+			buckets = (_Data **)memalloc(sizeof(_Data *) * old_len * 2);
+			memset(buckets, 0, sizeof(_Data *) * old_len * 2);
+			bucket_mask = old_len * 2 - 1;
+			count = 0;
+
+			for (uint32_t i = 0; i < old_len; i++) {
+				_Data *d = old_buckets[i];
+				while (d) {
+					_Data *next = d->next;
+					insert(d);
+					d = next;
+				}
+			}
+			memfree(old_buckets);
+		}
+	};
 
-	static inline _Data *table[TABLE_LEN];
-	static inline BinaryMutex mutex;
-	static inline PagedAllocator<_Data> allocator;
+	static Shard shards[SHARD_COUNT];
+
+	_FORCE_INLINE_ static Shard &get_shard(uint32_t p_hash) {
+		return shards[p_hash & SHARD_MASK];
+	}
 };
 
+StringName::Table::Shard StringName::Table::shards[StringName::Table::SHARD_COUNT];
+
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
-	for (uint32_t i = 0; i < Table::TABLE_LEN; i++) {
-		Table::table[i] = nullptr;
+	for (Table::Shard &shard : Table::shards) {
+		const uint32_t len = 1 << Table::INITIAL_BUCKET_BITS;
+		shard.buckets = (_Data **)memalloc(sizeof(_Data *) * len);
+		memset(shard.buckets, 0, sizeof(_Data *) * len);
+		shard.bucket_mask = len - 1;
+		shard.count = 0;
 	}
 	configured = true;
 }
 
 void StringName::cleanup() {
-	MutexLock lock(Table::mutex);
+	for (Table::Shard &shard : Table::shards) {
+		shard.mutex.lock();
+	}
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		Vector<_Data *> data;
-		for (uint32_t i = 0; i < Table::TABLE_LEN; i++) {
-			_Data *d = Table::table[i];
-			while (d) {
-				data.push_back(d);
-				d = d->next;
+		for (Table::Shard &shard : Table::shards) {
+			for (uint32_t i = 0; i <= shard.bucket_mask; i++) {
+				_Data *d = shard.buckets[i];
+				while (d) {
+					data.push_back(d);
+					d = d->next;
+				}
 			}
 		}
 
@@ -86,47 +161,49 @@ void StringName::cleanup() {
 	}
 #endif
 	int lost_strings = 0;
-	for (uint32_t i = 0; i < Table::TABLE_LEN; i++) {
-		while (Table::table[i]) {
-			_Data *d = Table::table[i];
-			if (d->static_count.get() != d->refcount.get()) {
-				lost_strings++;
-
-				if (OS::get_singleton()->is_stdout_verbose()) {
-					print_line(vformat("Orphan StringName: %s (static: %d, total: %d)", d->name, d->static_count.get(), d->refcount.get()));
+	for (Table::Shard &shard : Table::shards) {
+		for (uint32_t i = 0; i <= shard.bucket_mask; i++) {
+			while (shard.buckets[i]) {
+				_Data *d = shard.buckets[i];
+				if (d->static_count.get() != d->refcount.get()) {
+					lost_strings++;
+
+					if (OS::get_singleton()->is_stdout_verbose()) {
+						print_line(vformat("Orphan StringName: %s (static: %d, total: %d)", d->name, d->static_count.get(), d->refcount.get()));
+					}
 				}
-			}
 
-			Table::table[i] = Table::table[i]->next;
-			Table::allocator.free(d);
+				shard.buckets[i] = shard.buckets[i]->next;
+				shard.allocator.free(d);
+			}
 		}
+		memfree(shard.buckets);
+		shard.buckets = nullptr;
+		shard.bucket_mask = 0;
+		shard.count = 0;
 	}
 	if (lost_strings) {
 		print_verbose(vformat("StringName: %d unclaimed string names at exit.", lost_strings));
 	}
 	configured = false;
+
+	for (Table::Shard &shard : Table::shards) {
+		shard.mutex.unlock();
+	}
 }
 
 void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(Table::mutex);
+		Table::Shard &shard = Table::get_shard(_data->hash);
+		MutexLock lock(shard.mutex);
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			ERR_PRINT("BUG: Unreferenced static string to 0: " + _data->name);
 		}
-		if (_data->prev) {
-			_data->prev->next = _data->next;
-		} else {
-			const uint32_t idx = _data->hash & Table::TABLE_MASK;
-			Table::table[idx] = _data->next;
-		}
-
-		if (_data->next) {
-			_data->next->prev = _data->prev;
-		}
-		Table::allocator.free(_data);
+		shard.remove(_data);
+		shard.allocator.free(_data);
 	}
 
 	_data = nullptr;
@@ -212,10 +289,10 @@ StringName::StringName(const char *p_name, bool p_static) {
 	}
 
 	const uint32_t hash = String::hash(p_name);
-	const uint32_t idx = hash & Table::TABLE_MASK;
+	Table::Shard &shard = Table::get_shard(hash);
 
-	MutexLock lock(Table::mutex);
-	_data = Table::table[idx];
+	MutexLock lock(shard.mutex);
+	_data = shard.get_bucket(hash);
 
 	while (_data) {
 		// compare hash first
@@ -238,13 +315,11 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return;
 	}
 
-	_data = Table::allocator.alloc();
+	_data = shard.allocator.alloc();
 	_data->name = p_name;
 	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->next = Table::table[idx];
-	_data->prev = nullptr;
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
@@ -253,10 +328,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 		_data->static_count.increment();
 	}
 #endif
-	if (Table::table[idx]) {
-		Table::table[idx]->prev = _data;
-	}
-	Table::table[idx] = _data;
+	shard.insert(_data);
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -269,10 +341,10 @@ StringName::StringName(const String &p_name, bool p_static) {
 	}
 
 	const uint32_t hash = p_name.hash();
-	const uint32_t idx = hash & Table::TABLE_MASK;
+	Table::Shard &shard = Table::get_shard(hash);
 
-	MutexLock lock(Table::mutex);
-	_data = Table::table[idx];
+	MutexLock lock(shard.mutex);
+	_data = shard.get_bucket(hash);
 
 	while (_data) {
 		if (_data->hash == hash && _data->name == p_name) {
@@ -294,13 +366,11 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	_data = Table::allocator.alloc();
+	_data = shard.allocator.alloc();
 	_data->name = p_name;
 	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->next = Table::table[idx];
-	_data->prev = nullptr;
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		// Keep in memory, force static.
@@ -309,10 +379,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 	}
 #endif
 
-	if (Table::table[idx]) {
-		Table::table[idx]->prev = _data;
-	}
-	Table::table[idx] = _data;
+	shard.insert(_data);
 }
 
 bool operator==(const String &p_name, const StringName &p_string_name) {
@@ -236,6 +236,28 @@ private:
 		return elem;
 	}
 
+	template <typename, typename, typename, typename, uint32_t>
+	friend class SmallHashMap;
+
+	// Takes over elements allocated with Allocator, keeping their addresses. The map must be empty.
+	void _adopt_elements(HashMapElement<TKey, TValue> *const *p_elements, const uint32_t *p_hashes, uint32_t p_count, HashMapElement<TKey, TValue> *p_head, HashMapElement<TKey, TValue> *p_tail) {
+		DEV_ASSERT(_size == 0);
+		reserve(p_count / MAX_OCCUPANCY + 1);
+
+		if (_elements == nullptr) {
+			uint32_t capacity = hash_table_size_primes[_capacity_idx];
+			static_assert(EMPTY_HASH == 0, "Assuming EMPTY_HASH = 0 for alloc_static_zeroed call");
+			_hashes = reinterpret_cast<uint32_t *>(Memory::alloc_static_zeroed(sizeof(uint32_t) * capacity));
+			_elements = reinterpret_cast<HashMapElement<TKey, TValue> **>(Memory::alloc_static(sizeof(HashMapElement<TKey, TValue> *) * capacity));
+		}
+
+		for (uint32_t i = 0; i < p_count; i++) {
+			_insert_element(p_hashes[i], p_elements[i]);
+		}
+		_head_element = p_head;
+		_tail_element = p_tail;
+	}
+
 	void _clear_data() {
 		HashMapElement<TKey, TValue> *current = _tail_element;
 		while (current != nullptr) {
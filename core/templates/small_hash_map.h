@@ -0,0 +1,338 @@
+/**************************************************************************/
+/*  small_hash_map.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/hash_map.h"
+
+/**
+ * A HashMap wrapper that keeps up to SMALL_CAPACITY entries in a short list
+ * and only builds the hash table once that capacity is exceeded.
+ *
+ * Small maps (the common case for options, keyword arguments and most
+ * script dictionaries) therefore skip the two hash table allocations:
+ * lookups are a linear scan over the stored hashes. Entries are allocated
+ * and linked in insertion order exactly like HashMap elements, so iterators
+ * are shared between both representations, and promotion hands the elements
+ * over to the HashMap. Iteration order and pointers to entries are preserved
+ * across promotion, as with HashMap.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>,
+		uint32_t SMALL_CAPACITY = 4>
+class SmallHashMap {
+	static_assert(SMALL_CAPACITY > 0 && SMALL_CAPACITY <= 32, "SmallHashMap small capacity must be between 1 and 32.");
+
+public:
+	using Element = HashMapElement<TKey, TValue>;
+	using Map = HashMap<TKey, TValue, Hasher, Comparator>;
+	using Iterator = typename Map::Iterator;
+	using ConstIterator = typename Map::ConstIterator;
+
+private:
+	struct Small {
+		Element *elements[SMALL_CAPACITY]; // In no particular order, iteration follows the links.
+		uint32_t hashes[SMALL_CAPACITY];
+		Element *head_element;
+		Element *tail_element;
+		uint32_t size;
+	};
+
+	// Only one representation is alive at a time, depending on _promoted.
+	union {
+		Small _small;
+		Map _map;
+	};
+	bool _promoted = false;
+
+	_FORCE_INLINE_ void _small_init() {
+		_small.head_element = nullptr;
+		_small.tail_element = nullptr;
+		_small.size = 0;
+	}
+
+	int _small_find(const TKey &p_key, uint32_t p_hash) const {
+		for (uint32_t i = 0; i < _small.size; i++) {
+			if (_small.hashes[i] == p_hash && Comparator::compare(_small.elements[i]->data.key, p_key)) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	Element *_small_lookup(const TKey &p_key, uint32_t p_hash) const {
+		int idx = _small_find(p_key, p_hash);
+		return idx >= 0 ? _small.elements[idx] : nullptr;
+	}
+
+	Element *_small_insert(const TKey &p_key, const TValue &p_value, uint32_t p_hash, bool p_front_insert) {
+		// Same allocation as DefaultTypedAllocator, so the HashMap can free it after promotion.
+		Element *element = memnew(Element(p_key, p_value));
+		_small.elements[_small.size] = element;
+		_small.hashes[_small.size] = p_hash;
+		_small.size++;
+
+		if (_small.tail_element == nullptr) {
+			_small.head_element = element;
+			_small.tail_element = element;
+		} else if (p_front_insert) {
+			_small.head_element->prev = element;
+			element->next = _small.head_element;
+			_small.head_element = element;
+		} else {
+			_small.tail_element->next = element;
+			element->prev = _small.tail_element;
+			_small.tail_element = element;
+		}
+		return element;
+	}
+
+	void _small_clear() {
+		for (uint32_t i = 0; i < _small.size; i++) {
+			memdelete(_small.elements[i]);
+		}
+		_small_init();
+	}
+
+	void _promote(uint32_t p_capacity) {
+		Small small = _small;
+		memnew_placement(&_map, Map(MAX(p_capacity, SMALL_CAPACITY * 2)));
+		_map._adopt_elements(small.elements, small.hashes, small.size, small.head_element, small.tail_element);
+		_promoted = true;
+	}
+
+public:
+	_FORCE_INLINE_ bool is_promoted() const { return _promoted; }
+
+	_FORCE_INLINE_ uint32_t size() const {
+		return _promoted ? _map.size() : _small.size;
+	}
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return size() == 0;
+	}
+
+	void clear() {
+		if (_promoted) {
+			_map.~Map();
+			_promoted = false;
+			_small_init();
+		} else {
+			_small_clear();
+		}
+	}
+
+	void reserve(uint32_t p_new_capacity) {
+		if (_promoted) {
+			_map.reserve(p_new_capacity);
+		} else if (p_new_capacity > SMALL_CAPACITY) {
+			_promote(p_new_capacity);
+		}
+	}
+
+	template <typename C>
+	void sort_custom() {
+		if (_promoted) {
+			_map.template sort_custom<C>();
+			return;
+		}
+		if (_small.size < 2) {
+			return;
+		}
+		SortList<Element, KeyValue<TKey, TValue>, &Element::data, &Element::prev, &Element::next, C> sorter;
+		sorter.sort(_small.head_element, _small.tail_element);
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		if (_promoted) {
+			return _map.getptr(p_key);
+		}
+		const Element *E = _small_lookup(p_key, Map::_hash(p_key));
+		return E ? &E->data.value : nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		if (_promoted) {
+			return _map.getptr(p_key);
+		}
+		Element *E = _small_lookup(p_key, Map::_hash(p_key));
+		return E ? &E->data.value : nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return getptr(p_key) != nullptr;
+	}
+
+	bool erase(const TKey &p_key) {
+		if (_promoted) {
+			return _map.erase(p_key);
+		}
+
+		int idx = _small_find(p_key, Map::_hash(p_key));
+		if (idx < 0) {
+			return false;
+		}
+		Element *E = _small.elements[idx];
+
+		if (_small.head_element == E) {
+			_small.head_element = E->next;
+		}
+		if (_small.tail_element == E) {
+			_small.tail_element = E->prev;
+		}
+		if (E->prev) {
+			E->prev->next = E->next;
+		}
+		if (E->next) {
+			E->next->prev = E->prev;
+		}
+
+		_small.size--;
+		_small.elements[idx] = _small.elements[_small.size];
+		_small.hashes[idx] = _small.hashes[_small.size];
+		memdelete(E);
+		return true;
+	}
+
+	/* Iteration */
+
+	_FORCE_INLINE_ Iterator begin() {
+		return _promoted ? _map.begin() : Iterator(_small.head_element);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(nullptr);
+	}
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return _promoted ? _map.begin() : ConstIterator(_small.head_element);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(nullptr);
+	}
+
+	Iterator find(const TKey &p_key) {
+		if (_promoted) {
+			return _map.find(p_key);
+		}
+		return Iterator(_small_lookup(p_key, Map::_hash(p_key)));
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		if (_promoted) {
+			return _map.find(p_key);
+		}
+		return ConstIterator(_small_lookup(p_key, Map::_hash(p_key)));
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		const TValue *value = getptr(p_key);
+		CRASH_COND(!value);
+		return *value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		if (_promoted) {
+			return _map[p_key];
+		}
+		const uint32_t hash = Map::_hash(p_key);
+		Element *E = _small_lookup(p_key, hash);
+		if (E) {
+			return E->data.value;
+		}
+		if (_small.size == SMALL_CAPACITY) {
+			_promote(SMALL_CAPACITY + 1);
+			return _map[p_key];
+		}
+		return _small_insert(p_key, TValue(), hash, false)->data.value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value, bool p_front_insert = false) {
+		if (_promoted) {
+			return _map.insert(p_key, p_value, p_front_insert);
+		}
+		const uint32_t hash = Map::_hash(p_key);
+		Element *E = _small_lookup(p_key, hash);
+		if (E) {
+			E->data.value = p_value;
+			return Iterator(E);
+		}
+		if (_small.size == SMALL_CAPACITY) {
+			_promote(SMALL_CAPACITY + 1);
+			return _map.insert(p_key, p_value, p_front_insert);
+		}
+		return Iterator(_small_insert(p_key, p_value, hash, p_front_insert));
+	}
+
+	/* Constructors */
+
+	void operator=(const SmallHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+
+		if (p_other.size() > SMALL_CAPACITY) {
+			memnew_placement(&_map, Map(p_other._map));
+			_promoted = true;
+			return;
+		}
+
+		// A promoted map that shrank back down fits in the small list again.
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	explicit SmallHashMap(const SmallHashMap &p_other) {
+		_small_init();
+		operator=(p_other);
+	}
+
+	SmallHashMap(uint32_t p_initial_capacity) {
+		_small_init();
+		reserve(p_initial_capacity);
+	}
+
+	SmallHashMap() {
+		_small_init();
+	}
+
+	~SmallHashMap() {
+		if (_promoted) {
+			_map.~Map();
+		} else {
+			_small_clear();
+		}
+	}
+};
@@ -36,6 +36,7 @@ STATIC_ASSERT_INCOMPLETE_TYPE(class, String);
 
 #include "core/templates/hash_map.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/small_hash_map.h"
 #include "core/variant/container_type_validate.h"
 #include "core/variant/variant.h"
 // required in this order by VariantInternal, do not remove this comment.
@@ -47,7 +48,7 @@ STATIC_ASSERT_INCOMPLETE_TYPE(class, String);
 struct DictionaryPrivate {
 	SafeRefCount refcount;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
-	HashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator> variant_map;
+	SmallHashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator> variant_map;
 	ContainerTypeValidate typed_key;
 	ContainerTypeValidate typed_value;
 	Variant *typed_fallback = nullptr; // Allows a typed dictionary to return dummy values when attempting an invalid access.
@@ -444,7 +445,7 @@ void Dictionary::assign(const Dictionary &p_dictionary) {
 	}
 
 	int size = p_dictionary._p->variant_map.size();
-	HashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator> variant_map = HashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator>(size);
+	SmallHashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator> variant_map(size);
 
 	Vector<Variant> key_array;
 	key_array.resize(size);
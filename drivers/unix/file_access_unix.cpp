@@ -35,6 +35,7 @@
 #include "core/string/ustring.h"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #if !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__NetBSD__) && !defined(WEB_ENABLED)
@@ -198,11 +199,54 @@ Error FileAccessUnix::open_internal(const String &p_path, int p_mode_flags) {
 	return OK;
 }
 
+bool FileAccessUnix::_map() {
+	if (mapping) {
+		return true;
+	}
+	if (mapping_failed || flags != READ) {
+		return false;
+	}
+
+#ifdef WEB_ENABLED
+	// Emscripten emulates mmap by copying the file into the heap, which defeats the purpose.
+	return false;
+#else
+	// Mapping is only attempted once per open file, failures fall back to regular reads.
+	mapping_failed = true;
+
+	struct stat st = {};
+	int fd = fileno(f);
+	if (fd == -1 || fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+		return false;
+	}
+
+	void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (addr == MAP_FAILED) {
+		return false;
+	}
+
+	mapping = (uint8_t *)addr;
+	mapping_size = st.st_size;
+	mapping_failed = false;
+	return true;
+#endif
+}
+
+void FileAccessUnix::_unmap() {
+	if (mapping) {
+		munmap(mapping, mapping_size);
+		mapping = nullptr;
+		mapping_size = 0;
+	}
+	mapping_failed = false;
+}
+
 void FileAccessUnix::_close() {
 	if (!f) {
 		return;
 	}
 
+	_unmap();
 	fclose(f);
 	f = nullptr;
 
@@ -308,6 +352,15 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+Span<uint8_t> FileAccessUnix::map_contents() {
+	ERR_FAIL_NULL_V_MSG(f, Span<uint8_t>(), "File must be opened before use.");
+
+	if (!_map()) {
+		return Span<uint8_t>();
+	}
+	return Span<uint8_t>(mapping, mapping_size);
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -47,6 +47,13 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	// Read-only mapping of the whole file, created by map_contents().
+	uint8_t *mapping = nullptr;
+	uint64_t mapping_size = 0;
+	bool mapping_failed = false;
+
+	bool _map();
+	void _unmap();
 	void _close();
 
 #if defined(TOOLS_ENABLED)
@@ -71,6 +78,7 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> map_contents() override;
 
 	virtual Error get_error() const override; ///< get last error
 
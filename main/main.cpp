@@ -51,6 +51,8 @@
 #include "core/object/class_db.h"
 #include "core/object/message_queue.h"
 #include "core/object/script_language.h"
+#include "core/os/frame_arena.h"
+#include "core/os/heap_profiler.h"
 #include "core/os/os.h"
 #include "core/os/process_id.h"
 #include "core/os/time.h"
@@ -2870,6 +2872,17 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 
 	message_queue = memnew(MessageQueue);
 
+	if (GLOBAL_DEF_RST("memory/frame_arena/enabled", false)) {
+		FrameArena::setup(size_t(GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "memory/frame_arena/size_kb", PROPERTY_HINT_RANGE, "64,65536,1,or_greater"), 4096)) * 1024);
+		performance->add_custom_monitor("memory/frame_arena_allocations", callable_mp_static(&FrameArena::get_last_frame_allocations), Vector<Variant>());
+		performance->add_custom_monitor("memory/frame_arena_fallbacks", callable_mp_static(&FrameArena::get_last_frame_fallbacks), Vector<Variant>());
+		performance->add_custom_monitor("memory/frame_arena_pinned_chunks", callable_mp_static(&FrameArena::get_last_frame_pinned_chunks), Vector<Variant>());
+	}
+
+	if (GLOBAL_DEF("memory/heap_profiler/enabled", false)) {
+		performance->start_heap_profiling(int64_t(GLOBAL_DEF(PropertyInfo(Variant::INT, "memory/heap_profiler/sample_interval_kb", PROPERTY_HINT_RANGE, "1,65536,1,or_greater"), 512)) * 1024);
+	}
+
 	Thread::release_main_thread(); // If setup2() is called from another thread, that one will become main thread, so preventively release this one.
 	set_current_thread_safe_for_nodes(false);
 
@@ -4907,6 +4920,10 @@ bool Main::iteration() {
 
 	bool exit = false;
 
+	// Temporaries created by scripts and signals during processing are served by the
+	// frame arena (if enabled), the rendering and audio servers keep using malloc.
+	FrameArena::push_scope();
+
 	// process all our active interfaces
 #ifndef XR_DISABLED
 	GodotProfileZoneGrouped(_profile_zone, "xr_server->_process");
@@ -4916,6 +4933,7 @@ bool Main::iteration() {
 	GodotProfileZoneGrouped(_profile_zone, "physics");
 	for (int iters = 0; iters < advance.physics_steps; ++iters) {
 		GodotProfileZone("Physics Step");
+		HeapProfiler::Tag heap_tag("physics");
 		GodotProfileZoneGroupedFirst(_physics_zone, "setup");
 		if (Input::get_singleton()->is_agile_input_event_flushing()) {
 			Input::get_singleton()->flush_buffered_events();
@@ -5006,10 +5024,13 @@ bool Main::iteration() {
 	uint64_t process_begin = OS::get_singleton()->get_ticks_usec();
 
 	GodotProfileZoneGrouped(_profile_zone, "process");
-	if (OS::get_singleton()->get_main_loop()->process(process_step * time_scale)) {
-		exit = true;
+	{
+		HeapProfiler::Tag heap_tag("process");
+		if (OS::get_singleton()->get_main_loop()->process(process_step * time_scale)) {
+			exit = true;
+		}
+		message_queue->flush();
 	}
-	message_queue->flush();
 
 #ifndef NAVIGATION_2D_DISABLED
 	GodotProfileZoneGrouped(_profile_zone, "process 2D navigation");
@@ -5020,6 +5041,8 @@ bool Main::iteration() {
 	NavigationServer3D::get_singleton()->process(process_step * time_scale);
 #endif // NAVIGATION_3D_DISABLED
 
+	FrameArena::pop_scope();
+
 	GodotProfileZoneGrouped(_profile_zone, "RenderingServer::sync");
 	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
 
@@ -5030,6 +5053,7 @@ bool Main::iteration() {
 			RenderingServer::get_singleton()->is_render_loop_enabled();
 
 	if (wants_present || has_pending_resources_for_processing) {
+		HeapProfiler::Tag heap_tag("rendering");
 		wants_present |= force_redraw_requested;
 		if ((!force_redraw_requested) && OS::get_singleton()->is_in_low_processor_usage_mode()) {
 			if (RenderingServer::get_singleton()->has_changed()) {
@@ -5056,7 +5080,10 @@ bool Main::iteration() {
 	}
 
 	GodotProfileZoneGrouped(_profile_zone, "AudioServer::update");
-	AudioServer::get_singleton()->update();
+	{
+		HeapProfiler::Tag heap_tag("audio");
+		AudioServer::get_singleton()->update();
+	}
 
 	if (EngineDebugger::is_active()) {
 		EngineDebugger::get_singleton()->iteration(frame_time, process_ticks, physics_process_ticks, physics_step);
@@ -5065,6 +5092,10 @@ bool Main::iteration() {
 	frames++;
 	Engine::get_singleton()->_process_frames++;
 
+	if (FrameArena::is_enabled()) {
+		FrameArena::end_frame();
+	}
+
 	if (frame > 1000000) {
 		// Wait a few seconds before printing FPS, as FPS reporting just after the engine has started is inaccurate.
 		if (hide_print_fps_attempts == 0) {
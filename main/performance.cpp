@@ -32,7 +32,10 @@
 #include "performance.compat.inc"
 
 #include "core/config/engine.h"
+#include "core/io/file_access.h"
+#include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
+#include "core/os/heap_profiler.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
@@ -67,6 +70,11 @@ void Performance::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_monitor_modification_time"), &Performance::get_monitor_modification_time);
 	ClassDB::bind_method(D_METHOD("get_custom_monitor_names"), &Performance::get_custom_monitor_names);
 	ClassDB::bind_method(D_METHOD("get_custom_monitor_types"), &Performance::get_custom_monitor_types);
+	ClassDB::bind_method(D_METHOD("start_heap_profiling", "sample_interval"), &Performance::start_heap_profiling, DEFVAL(512 * 1024));
+	ClassDB::bind_method(D_METHOD("stop_heap_profiling"), &Performance::stop_heap_profiling);
+	ClassDB::bind_method(D_METHOD("is_heap_profiling"), &Performance::is_heap_profiling);
+	ClassDB::bind_method(D_METHOD("get_heap_profile"), &Performance::get_heap_profile);
+	ClassDB::bind_method(D_METHOD("dump_heap_profile", "path"), &Performance::dump_heap_profile);
 
 	BIND_ENUM_CONSTANT(TIME_FPS);
 	BIND_ENUM_CONSTANT(TIME_PROCESS);
@@ -603,6 +611,95 @@ uint64_t Performance::get_monitor_modification_time() {
 	return _monitor_modification_time;
 }
 
+static uint64_t _get_heap_profiler_live_bytes() {
+	return HeapProfiler::get_live_bytes();
+}
+
+void Performance::start_heap_profiling(int64_t p_sample_interval) {
+	ERR_FAIL_COND_MSG(p_sample_interval <= 0, "Heap profiling sample interval must be greater than zero.");
+	HeapProfiler::start(p_sample_interval);
+	if (!has_custom_monitor("memory/heap_profiler_live_bytes")) {
+		add_custom_monitor("memory/heap_profiler_live_bytes", callable_mp_static(&_get_heap_profiler_live_bytes), Vector<Variant>(), MONITOR_TYPE_MEMORY);
+	}
+}
+
+void Performance::stop_heap_profiling() {
+	HeapProfiler::stop();
+}
+
+bool Performance::is_heap_profiling() const {
+	return HeapProfiler::is_active();
+}
+
+struct _HeapProfileCallsiteSort {
+	_FORCE_INLINE_ bool operator()(const HeapProfiler::Callsite &p_a, const HeapProfiler::Callsite &p_b) const {
+		return p_a.live_bytes > p_b.live_bytes || (p_a.live_bytes == p_b.live_bytes && p_a.allocated_bytes > p_b.allocated_bytes);
+	}
+};
+
+static void _get_sorted_heap_callsites(LocalVector<HeapProfiler::Callsite> &r_callsites) {
+	HeapProfiler::get_callsites(r_callsites);
+	r_callsites.sort_custom<_HeapProfileCallsiteSort>();
+}
+
+TypedArray<Dictionary> Performance::get_heap_profile() const {
+	LocalVector<HeapProfiler::Callsite> callsites;
+	_get_sorted_heap_callsites(callsites);
+	const double time = MAX(HeapProfiler::get_profiling_time(), 0.001);
+
+	TypedArray<Dictionary> ret;
+	for (const HeapProfiler::Callsite &callsite : callsites) {
+		PackedStringArray callstack;
+		for (int i = 0; i < callsite.frame_count; i++) {
+			callstack.push_back(HeapProfiler::symbolize(callsite.frames[i]));
+		}
+
+		Dictionary entry;
+		entry["tag"] = callsite.tag ? String(callsite.tag) : String();
+		entry["callstack"] = callstack;
+		entry["live_bytes"] = callsite.live_bytes;
+		entry["allocated_bytes"] = callsite.allocated_bytes;
+		entry["allocation_rate"] = callsite.allocated_bytes / time;
+		ret.push_back(entry);
+	}
+	return ret;
+}
+
+Error Performance::dump_heap_profile(const String &p_path) const {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Cannot open file '%s' to write the heap profile.", p_path));
+
+	LocalVector<HeapProfiler::Callsite> callsites;
+	_get_sorted_heap_callsites(callsites);
+	const double time = MAX(HeapProfiler::get_profiling_time(), 0.001);
+
+	HashMap<String, Pair<uint64_t, uint64_t>> tags;
+	for (const HeapProfiler::Callsite &callsite : callsites) {
+		Pair<uint64_t, uint64_t> &totals = tags[callsite.tag ? String(callsite.tag) : String("untagged")];
+		totals.first += callsite.live_bytes;
+		totals.second += callsite.allocated_bytes;
+	}
+
+	f->store_line(vformat("# Heap profile: sample interval %d bytes, %s seconds, %d callsites.", (int64_t)HeapProfiler::get_sample_interval(), String::num(time, 2), callsites.size()));
+	f->store_line("# Byte counts are estimates extrapolated from sampled allocations.");
+	f->store_line("");
+	f->store_line("# Tag: live bytes, allocated bytes, allocation rate (bytes/s)");
+	for (const KeyValue<String, Pair<uint64_t, uint64_t>> &E : tags) {
+		f->store_line(vformat("%s: %d, %d, %d", E.key, (int64_t)E.value.first, (int64_t)E.value.second, (int64_t)(E.value.second / time)));
+	}
+
+	for (const HeapProfiler::Callsite &callsite : callsites) {
+		f->store_line("");
+		f->store_line(vformat("live %d, allocated %d, rate %d/s, tag %s", (int64_t)callsite.live_bytes, (int64_t)callsite.allocated_bytes, (int64_t)(callsite.allocated_bytes / time), callsite.tag ? callsite.tag : "untagged"));
+		for (int i = 0; i < callsite.frame_count; i++) {
+			f->store_line("\t" + HeapProfiler::symbolize(callsite.frames[i]));
+		}
+	}
+
+	return OK;
+}
+
 Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
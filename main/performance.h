@@ -150,6 +150,12 @@ public:
 
 	uint64_t get_monitor_modification_time();
 
+	void start_heap_profiling(int64_t p_sample_interval = 512 * 1024);
+	void stop_heap_profiling();
+	bool is_heap_profiling() const;
+	TypedArray<Dictionary> get_heap_profile() const;
+	Error dump_heap_profile(const String &p_path) const;
+
 	static Performance *get_singleton() { return singleton; }
 
 	Performance();
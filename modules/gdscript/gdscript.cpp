@@ -33,6 +33,7 @@
 #include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
@@ -594,6 +595,7 @@ bool GDScript::_update_exports(bool *r_err, bool p_recursive_call, PlaceHolderSc
 				}
 				valid = false; // to show error in the editor
 				base_cache->valid = false;
+				GDScriptInlineCache::invalidate();
 				base_cache->inheriters_cache.clear(); // to prevent future stackoverflows
 				base_cache.unref();
 				base.unref();
@@ -738,6 +740,75 @@ void GDScript::_restore_old_static_data() {
 
 #endif
 
+Error GDScript::_compile(bool p_keep_state, bool &r_can_run) {
+	GDScriptParser parser;
+	Error err;
+	if (!binary_tokens.is_empty()) {
+		err = parser.parse_binary(binary_tokens, path);
+	} else {
+		err = parser.parse(source, path, false);
+	}
+	if (err) {
+		if (EngineDebugger::is_active()) {
+			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().start_line, "Parser Error: " + parser.get_errors().front()->get().message);
+		}
+		// TODO: Show all error messages.
+		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser.get_errors().front()->get().start_line, ("Parse Error: " + parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+		return ERR_PARSE_ERROR;
+	}
+
+	GDScriptAnalyzer analyzer(&parser);
+	err = analyzer.analyze();
+
+	if (err) {
+		if (EngineDebugger::is_active()) {
+			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().start_line, "Parser Error: " + parser.get_errors().front()->get().message);
+		}
+
+		const List<GDScriptParser::ParserError>::Element *e = parser.get_errors().front();
+		while (e != nullptr) {
+			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().start_line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+			e = e->next();
+		}
+		return ERR_PARSE_ERROR;
+	}
+
+	r_can_run = ScriptServer::is_scripting_enabled() || parser.is_tool();
+
+	GDScriptCompiler compiler;
+	err = compiler.compile(&parser, this, p_keep_state);
+
+	if (err) {
+		// TODO: Provide the script function as the first argument.
+		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), compiler.get_error_line(), ("Compile Error: " + compiler.get_error()).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+		if (r_can_run) {
+			if (EngineDebugger::is_active()) {
+				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), compiler.get_error_line(), "Parser Error: " + compiler.get_error());
+			}
+			return ERR_COMPILATION_FAILED;
+		}
+		return err;
+	}
+
+#ifdef TOOLS_ENABLED
+	// Done after compilation because it needs the GDScript object's inner class GDScript objects,
+	// which are made by calling make_scripts() within compiler.compile() above.
+	GDScriptDocGen::generate_docs(this, parser.get_tree());
+#endif
+
+#ifdef DEBUG_ENABLED
+	for (const GDScriptWarning &warning : parser.get_warnings()) {
+		if (EngineDebugger::is_active()) {
+			Vector<ScriptLanguage::StackInfo> si;
+			// TODO: Provide the script function as the first argument.
+			EngineDebugger::get_script_debugger()->send_error("GDScript::reload", get_script_path(), warning.start_line, warning.get_name(), warning.get_message(), false, ERR_HANDLER_WARNING, si);
+		}
+	}
+#endif
+
+	return OK;
+}
+
 Error GDScript::reload(bool p_keep_state) {
 	if (reloading) {
 		return OK;
@@ -813,76 +884,31 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
-	GDScriptParser parser;
+	GDScriptInlineCache::invalidate();
 	Error err;
-	if (!binary_tokens.is_empty()) {
-		err = parser.parse_binary(binary_tokens, path);
-	} else {
-		err = parser.parse(source, path, false);
-	}
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().start_line, "Parser Error: " + parser.get_errors().front()->get().message);
-		}
-		// TODO: Show all error messages.
-		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser.get_errors().front()->get().start_line, ("Parse Error: " + parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-		reloading = false;
-		return ERR_PARSE_ERROR;
-	}
-
-	GDScriptAnalyzer analyzer(&parser);
-	err = analyzer.analyze();
 
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().start_line, "Parser Error: " + parser.get_errors().front()->get().message);
-		}
-
-		const List<GDScriptParser::ParserError>::Element *e = parser.get_errors().front();
-		while (e != nullptr) {
-			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().start_line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-			e = e->next();
+	// Exported scripts may come with their compiled bytecode, which can only replace a compilation without instances to keep.
+	bool compiled = false;
+	if (!bytecode_cache.is_empty() && !has_instances) {
+		err = GDScriptBytecodeCache::load(this);
+		if (err == OK) {
+			compiled = true;
+			can_run = ScriptServer::is_scripting_enabled() || tool;
+		} else {
+			print_verbose(vformat(R"(GDScript: Failed to load bytecode cache of "%s", compiling it instead.)", path));
 		}
-		reloading = false;
-		return ERR_PARSE_ERROR;
 	}
+	// Later reloads compile the script again.
+	bytecode_cache.clear();
 
-	can_run = ScriptServer::is_scripting_enabled() || parser.is_tool();
-
-	GDScriptCompiler compiler;
-	err = compiler.compile(&parser, this, p_keep_state);
-
-	if (err) {
-		// TODO: Provide the script function as the first argument.
-		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), compiler.get_error_line(), ("Compile Error: " + compiler.get_error()).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-		if (can_run) {
-			if (EngineDebugger::is_active()) {
-				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), compiler.get_error_line(), "Parser Error: " + compiler.get_error());
-			}
-			reloading = false;
-			return ERR_COMPILATION_FAILED;
-		} else {
+	if (!compiled) {
+		err = _compile(p_keep_state, can_run);
+		if (err) {
 			reloading = false;
 			return err;
 		}
 	}
 
-#ifdef TOOLS_ENABLED
-	// Done after compilation because it needs the GDScript object's inner class GDScript objects,
-	// which are made by calling make_scripts() within compiler.compile() above.
-	GDScriptDocGen::generate_docs(this, parser.get_tree());
-#endif
-
-#ifdef DEBUG_ENABLED
-	for (const GDScriptWarning &warning : parser.get_warnings()) {
-		if (EngineDebugger::is_active()) {
-			Vector<ScriptLanguage::StackInfo> si;
-			// TODO: Provide the script function as the first argument.
-			EngineDebugger::get_script_debugger()->send_error("GDScript::reload", get_script_path(), warning.start_line, warning.get_name(), warning.get_message(), false, ERR_HANDLER_WARNING, si);
-		}
-	}
-#endif
-
 	if (can_run) {
 		err = _static_init();
 		if (err) {
@@ -1168,6 +1194,14 @@ const Vector<uint8_t> &GDScript::get_binary_tokens_source() const {
 	return binary_tokens;
 }
 
+void GDScript::set_bytecode_cache(const Vector<uint8_t> &p_bytecode_cache) {
+	bytecode_cache = p_bytecode_cache;
+}
+
+const Vector<uint8_t> &GDScript::get_bytecode_cache() const {
+	return bytecode_cache;
+}
+
 Vector<uint8_t> GDScript::get_as_binary_tokens() const {
 	GDScriptTokenizerBuffer tokenizer;
 	return tokenizer.parse_code_string(source, GDScriptTokenizerBuffer::COMPRESS_NONE);
@@ -1429,6 +1463,9 @@ void GDScript::clear() {
 	}
 	clearing = true;
 
+	// Inline caches may point to the functions and members released here.
+	GDScriptInlineCache::invalidate();
+
 	RBSet<GDScriptFunction *> functions_to_clear;
 
 	{
@@ -2104,6 +2141,9 @@ void GDScriptLanguage::remove_named_global_constant(const StringName &p_name) {
 }
 
 void GDScriptLanguage::init() {
+	// Project settings may be loaded after the language was created.
+	optimize_bytecode = GLOBAL_GET("debug/settings/gdscript/optimize_bytecode");
+
 	//populate global constants
 	int gcc = CoreConstants::get_global_constant_count();
 	for (int i = 0; i < gcc; i++) {
@@ -2831,6 +2871,7 @@ GDScriptLanguage::GDScriptLanguage() {
 	_debug_max_call_stack = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "debug/settings/gdscript/max_call_stack", PROPERTY_HINT_RANGE, "512," + itos(GDScriptFunction::MAX_CALL_DEPTH - 1) + ",1"), 1024);
 	track_call_stack = GLOBAL_DEF_RST("debug/settings/gdscript/always_track_call_stacks", false);
 	track_locals = GLOBAL_DEF_RST("debug/settings/gdscript/always_track_local_variables", false);
+	optimize_bytecode = GLOBAL_DEF_RST("debug/settings/gdscript/optimize_bytecode", false);
 
 #ifdef DEBUG_ENABLED
 	track_call_stack = true;
@@ -89,6 +89,7 @@ class GDScript : public Script {
 	friend class GDScriptLambdaCallable;
 	friend class GDScriptLambdaSelfCallable;
 	friend class GDScriptLanguage;
+	friend class GDScriptBytecodeCache;
 	friend struct GDScriptUtilityFunctionsDefinitions;
 
 	Ref<GDScriptNativeClass> native;
@@ -171,6 +172,7 @@ private:
 	GDScriptFunction *implicit_ready = nullptr; // `@implicit_ready()` special function.
 	GDScriptFunction *static_initializer = nullptr; // `@static_initializer()` special function.
 
+	Error _compile(bool p_keep_state, bool &r_can_run); // Parses, analyzes and compiles the source or binary tokens.
 	Error _static_init();
 	void _static_default_init(); // Initialize static variables with default values based on their types.
 
@@ -180,6 +182,7 @@ private:
 	//exported members
 	String source;
 	Vector<uint8_t> binary_tokens;
+	Vector<uint8_t> bytecode_cache;
 	String path;
 	bool path_valid = false; // False if using default path.
 	StringName local_name; // Inner class identifier or `class_name`.
@@ -309,6 +312,8 @@ public:
 
 	void set_binary_tokens_source(const Vector<uint8_t> &p_binary_tokens);
 	const Vector<uint8_t> &get_binary_tokens_source() const;
+	void set_bytecode_cache(const Vector<uint8_t> &p_bytecode_cache);
+	const Vector<uint8_t> &get_bytecode_cache() const;
 	Vector<uint8_t> get_as_binary_tokens() const;
 
 	bool get_property_default_value(const StringName &p_property, Variant &r_value) const override;
@@ -438,6 +443,7 @@ class GDScriptLanguage : public ScriptLanguage {
 
 	bool track_call_stack = false;
 	bool track_locals = false;
+	bool optimize_bytecode = false;
 
 	static CallLevel *_get_stack_level(uint32_t p_level);
 
@@ -570,6 +576,7 @@ public:
 
 	_FORCE_INLINE_ bool should_track_call_stack() const { return track_call_stack; }
 	_FORCE_INLINE_ bool should_track_locals() const { return track_locals; }
+	_FORCE_INLINE_ bool should_optimize_bytecode() const { return optimize_bytecode; }
 	_FORCE_INLINE_ int get_global_array_size() const { return global_array.size(); }
 	_FORCE_INLINE_ Variant *get_global_array() { return _global_array; }
 	_FORCE_INLINE_ const HashMap<StringName, int> &get_global_map() const { return globals; }
@@ -136,7 +136,17 @@ uint32_t GDScriptByteCodeGenerator::add_temporary(const GDScriptDataType &p_type
 void GDScriptByteCodeGenerator::pop_temporary() {
 	ERR_FAIL_COND(used_temporaries.is_empty());
 	int slot_idx = used_temporaries.back()->get();
-	if (temporaries[slot_idx].can_contain_object) {
+	bool needs_clear = true;
+	if (forwarded_result.result.temporary.mode == Address::TEMPORARY && forwarded_result.result.temporary.address == (uint32_t)slot_idx) {
+		if (forwarded_result.assign_end == opcodes.size()) {
+			// The temporary isn't read after the assignment, so the result can be written directly to its target.
+			forward_result();
+			// If nothing else used it in this statement, it holds no value and clearing it would be dead code.
+			needs_clear = is_temporary_used_since(slot_idx, temporaries_cleared_at);
+		}
+		forwarded_result = ForwardedResult();
+	}
+	if (temporaries[slot_idx].can_contain_object && needs_clear) {
 		// Avoid keeping in the stack long-lived references to objects,
 		// which may prevent `RefCounted` objects from being freed.
 		// However, the cleanup will be performed an the end of the
@@ -151,6 +161,7 @@ void GDScriptByteCodeGenerator::start_parameters() {
 	if (function->_default_arg_count > 0) {
 		append(GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT);
 		function->default_arguments.push_back(opcodes.size());
+		mark_jump_target();
 	}
 }
 
@@ -174,6 +185,8 @@ void GDScriptByteCodeGenerator::write_start(GDScript *p_script, const StringName
 	function->return_type = p_return_type;
 	function->rpc_config = p_rpc_config;
 	function->_argument_count = 0;
+
+	optimize = GDScriptLanguage::get_singleton()->should_optimize_bytecode();
 }
 
 GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
@@ -401,6 +414,8 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 	}
 	function->_stack_size = GDScriptFunction::FIXED_ADDRESSES_MAX + max_locals + temporaries.size();
 	function->_instruction_args_size = instr_args_max;
+	function->_inline_caches_count = inline_cache_count;
+	function->_inline_caches_ptr = inline_cache_count ? memnew_arr(GDScriptInlineCache, inline_cache_count) : nullptr;
 
 #ifdef DEBUG_ENABLED
 	function->operator_names = operator_names;
@@ -426,6 +441,240 @@ void GDScriptByteCodeGenerator::set_initial_line(int p_line) {
 	function->_initial_line = p_line;
 }
 
+void GDScriptByteCodeGenerator::set_last_result(int p_start, int p_result_offset, const Address &p_target) {
+	if (!optimize || p_target.mode != Address::TEMPORARY) {
+		last_result = TemporaryResult();
+		return;
+	}
+	last_result.start = p_start;
+	last_result.end = opcodes.size();
+	last_result.result_index = p_start + p_result_offset;
+	last_result.temporary = p_target;
+}
+
+bool GDScriptByteCodeGenerator::is_last_result(const Address &p_temporary) const {
+	if (!optimize || p_temporary.mode != Address::TEMPORARY) {
+		return false;
+	}
+	// Nothing may have been written after the instruction, and no jump may land right after it.
+	return last_result.end == opcodes.size() && last_result.temporary.address == p_temporary.address && last_jump_target <= last_result.start;
+}
+
+bool GDScriptByteCodeGenerator::can_forward_to(const Address &p_target) {
+	switch (p_target.mode) {
+		case Address::MEMBER:
+		case Address::LOCAL_VARIABLE:
+		case Address::FUNCTION_PARAMETER:
+			break;
+		default:
+			return false;
+	}
+
+	// The instruction must not read the target, since it may be written before being read.
+	// All the inputs come before the result, except for assignments.
+	const int target = address_of(p_target);
+	const int inputs_end = opcodes[last_result.start] == GDScriptFunction::OPCODE_ASSIGN ? last_result.start + 3 : last_result.result_index;
+	for (int i = last_result.start + 1; i < inputs_end; i++) {
+		if (i != last_result.result_index && opcodes[i] == target) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void GDScriptByteCodeGenerator::forward_result() {
+	const ForwardedResult &forward = forwarded_result;
+
+	// Remove the assignment, and make the instruction write to its target instead.
+	Vector<int> &indices = temporaries.write[forward.result.temporary.address].bytecode_indices;
+	indices.erase(forward.assign_start + 2);
+	indices.erase(forward.result.result_index);
+
+	opcodes.resize(forward.assign_start);
+	opcodes.write[forward.result.result_index] = address_of(forward.target);
+
+	last_result = TemporaryResult();
+}
+
+bool GDScriptByteCodeGenerator::write_folded_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
+	if (!optimize || p_left_operand.mode != Address::CONSTANT || (p_right_operand.mode != Address::CONSTANT && p_right_operand.mode != Address::NIL)) {
+		return false;
+	}
+
+	Variant left;
+	Variant right;
+	for (const KeyValue<Variant, int> &E : constant_map) {
+		if (E.value == (int)p_left_operand.address) {
+			left = E.key;
+		}
+		if (p_right_operand.mode == Address::CONSTANT && E.value == (int)p_right_operand.address) {
+			right = E.key;
+		}
+	}
+
+	Variant result;
+	bool valid = false;
+	Variant::evaluate(p_operator, left, right, result, valid);
+	// Errors are left to be reported when running, and shared values must be created every time.
+	if (!valid || Variant::is_type_shared(result.get_type())) {
+		return false;
+	}
+
+	GDScriptDataType result_type;
+	result_type.kind = GDScriptDataType::BUILTIN;
+	result_type.builtin_type = result.get_type();
+
+	const int start = opcodes.size();
+	append_opcode(GDScriptFunction::OPCODE_ASSIGN);
+	append(p_target);
+	append(Address(Address::CONSTANT, get_constant_pos(result), result_type));
+	set_last_result(start, 1, p_target);
+	return true;
+}
+
+bool GDScriptByteCodeGenerator::write_fused_jump_if_not(const Address &p_condition) {
+	if (!is_last_result(p_condition)) {
+		return false;
+	}
+
+	GDScriptFunction::Opcode fused_opcode;
+	switch (opcodes[last_result.start]) {
+		case GDScriptFunction::OPCODE_OPERATOR_VALIDATED:
+			fused_opcode = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+			break;
+		case GDScriptFunction::OPCODE_OPERATOR_INT:
+			fused_opcode = GDScriptFunction::OPCODE_OPERATOR_INT_JUMP_IF_NOT;
+			break;
+		case GDScriptFunction::OPCODE_OPERATOR_FLOAT:
+			fused_opcode = GDScriptFunction::OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT;
+			break;
+		default:
+			return false;
+	}
+
+	if (fused_member_get >= 0 && fused_member_get + 3 == last_result.start) {
+		// The member get fusion expects a plain validated operator, keep the jump fusion instead.
+		opcodes.write[fused_member_get] = GDScriptFunction::OPCODE_GET_MEMBER;
+		fused_member_get = -1;
+	}
+
+	// The jump target follows the operator arguments, to be patched like a regular jump.
+	opcodes.write[last_result.start] = fused_opcode;
+	last_result = TemporaryResult();
+	return true;
+}
+
+void GDScriptByteCodeGenerator::fuse_member_get(const Address &p_left_operand, const Address &p_right_operand) {
+	// Must be called right before the validated operator is appended.
+	if (!(is_last_result(p_left_operand) || is_last_result(p_right_operand)) || opcodes[last_result.start] != GDScriptFunction::OPCODE_GET_MEMBER) {
+		return;
+	}
+	// The member is still written to its temporary, so the operator can be reached by a jump as well.
+	opcodes.write[last_result.start] = GDScriptFunction::OPCODE_GET_MEMBER_OPERATOR_VALIDATED;
+	fused_member_get = last_result.start;
+}
+
+bool GDScriptByteCodeGenerator::is_temporary_used_since(int p_slot, int p_position) const {
+	for (int index : temporaries[p_slot].bytecode_indices) {
+		if (index >= p_position) {
+			return true;
+		}
+	}
+	return false;
+}
+
+GDScriptFunction::Opcode GDScriptByteCodeGenerator::get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) {
+	switch (p_left_type) {
+		case Variant::INT:
+			if (p_right_type == Variant::NIL) {
+				if (p_operator == Variant::OP_NEGATE || p_operator == Variant::OP_BIT_NEGATE) {
+					return GDScriptFunction::OPCODE_OPERATOR_INT;
+				}
+				break;
+			}
+			if (p_right_type != Variant::INT) {
+				break;
+			}
+			switch (p_operator) {
+				case Variant::OP_ADD:
+				case Variant::OP_SUBTRACT:
+				case Variant::OP_MULTIPLY:
+				case Variant::OP_BIT_AND:
+				case Variant::OP_BIT_OR:
+				case Variant::OP_BIT_XOR:
+				case Variant::OP_EQUAL:
+				case Variant::OP_NOT_EQUAL:
+				case Variant::OP_LESS:
+				case Variant::OP_LESS_EQUAL:
+				case Variant::OP_GREATER:
+				case Variant::OP_GREATER_EQUAL:
+					return GDScriptFunction::OPCODE_OPERATOR_INT;
+				default:
+					break;
+			}
+			break;
+		case Variant::FLOAT:
+			if (p_right_type == Variant::NIL) {
+				if (p_operator == Variant::OP_NEGATE) {
+					return GDScriptFunction::OPCODE_OPERATOR_FLOAT;
+				}
+				break;
+			}
+			if (p_right_type != Variant::FLOAT) {
+				break;
+			}
+			switch (p_operator) {
+				case Variant::OP_ADD:
+				case Variant::OP_SUBTRACT:
+				case Variant::OP_MULTIPLY:
+				case Variant::OP_DIVIDE:
+				case Variant::OP_EQUAL:
+				case Variant::OP_NOT_EQUAL:
+				case Variant::OP_LESS:
+				case Variant::OP_LESS_EQUAL:
+				case Variant::OP_GREATER:
+				case Variant::OP_GREATER_EQUAL:
+					return GDScriptFunction::OPCODE_OPERATOR_FLOAT;
+				default:
+					break;
+			}
+			break;
+		case Variant::VECTOR2:
+		case Variant::VECTOR3: {
+			const GDScriptFunction::Opcode opcode = p_left_type == Variant::VECTOR2 ? GDScriptFunction::OPCODE_OPERATOR_VECTOR2 : GDScriptFunction::OPCODE_OPERATOR_VECTOR3;
+			if (p_right_type == Variant::NIL) {
+				if (p_operator == Variant::OP_NEGATE) {
+					return opcode;
+				}
+				break;
+			}
+			if (p_right_type == Variant::FLOAT) {
+				if (p_operator == Variant::OP_MULTIPLY || p_operator == Variant::OP_DIVIDE) {
+					return opcode;
+				}
+				break;
+			}
+			if (p_right_type != p_left_type) {
+				break;
+			}
+			switch (p_operator) {
+				case Variant::OP_ADD:
+				case Variant::OP_SUBTRACT:
+				case Variant::OP_MULTIPLY:
+				case Variant::OP_DIVIDE:
+				case Variant::OP_EQUAL:
+				case Variant::OP_NOT_EQUAL:
+					return opcode;
+				default:
+					break;
+			}
+		} break;
+		default:
+			break;
+	}
+	return GDScriptFunction::OPCODE_END;
+}
+
 #define HAS_BUILTIN_TYPE(m_var) \
 	(m_var.type.kind == GDScriptDataType::BUILTIN)
 
@@ -556,7 +805,24 @@ void GDScriptByteCodeGenerator::write_type_adjust(const Address &p_target, Varia
 }
 
 void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand) {
+	if (write_folded_operator(p_target, p_operator, p_left_operand, Address())) {
+		return;
+	}
+
+	const int start = opcodes.size();
+
 	if (HAS_BUILTIN_TYPE(p_left_operand)) {
+		const GDScriptFunction::Opcode typed_opcode = get_typed_operator_opcode(p_operator, p_left_operand.type.builtin_type, Variant::NIL);
+		if (typed_opcode != GDScriptFunction::OPCODE_END) {
+			append_opcode(typed_opcode);
+			append(p_left_operand);
+			append(Address());
+			append(p_target);
+			append(p_operator);
+			set_last_result(start, 3, p_target);
+			return;
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, Variant::NIL);
 
@@ -568,6 +834,7 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
+		set_last_result(start, 3, p_target);
 		return;
 	}
 
@@ -577,15 +844,23 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	append(Address());
 	append(p_target);
 	append(p_operator);
+#ifdef TOOLS_ENABLED
+	function->operator_cache_positions.push_back(opcodes.size());
+#endif
 	append(0); // Signature storage.
 	append(0); // Return type storage.
 	constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*(opcodes.ptr()));
 	for (int i = 0; i < _pointer_size; i++) {
 		append(0); // Space for function pointer.
 	}
+	set_last_result(start, 3, p_target);
 }
 
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
+	if (write_folded_operator(p_target, p_operator, p_left_operand, p_right_operand)) {
+		return;
+	}
+
 	bool valid = HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand);
 
 	// Avoid validated evaluator for modulo and division when operands are int or integer vector, since there's no check for division by zero.
@@ -614,9 +889,24 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 			}
 		}
 
+		const int start = opcodes.size();
+
+		// Statically typed numeric and vector operands work on their unboxed values.
+		const GDScriptFunction::Opcode typed_opcode = get_typed_operator_opcode(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		if (typed_opcode != GDScriptFunction::OPCODE_END) {
+			append_opcode(typed_opcode);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			append(p_operator);
+			set_last_result(start, 3, p_target);
+			return;
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		fuse_member_get(p_left_operand, p_right_operand);
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -625,21 +915,27 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
+		set_last_result(start, 3, p_target);
 		return;
 	}
 
 	// No specific types, perform variant evaluation.
+	const int start = opcodes.size();
 	append_opcode(GDScriptFunction::OPCODE_OPERATOR);
 	append(p_left_operand);
 	append(p_right_operand);
 	append(p_target);
 	append(p_operator);
+#ifdef TOOLS_ENABLED
+	function->operator_cache_positions.push_back(opcodes.size());
+#endif
 	append(0); // Signature storage.
 	append(0); // Return type storage.
 	constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*(opcodes.ptr()));
 	for (int i = 0; i < _pointer_size; i++) {
 		append(0); // Space for function pointer.
 	}
+	set_last_result(start, 3, p_target);
 }
 
 void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const Address &p_source, const GDScriptDataType &p_type) {
@@ -722,6 +1018,7 @@ void GDScriptByteCodeGenerator::write_end_and(const Address &p_target) {
 	logic_op_jump_pos2.pop_back();
 	append_opcode(GDScriptFunction::OPCODE_ASSIGN_FALSE);
 	append(p_target);
+	mark_jump_target();
 }
 
 void GDScriptByteCodeGenerator::write_or_left_operand(const Address &p_left_operand) {
@@ -752,6 +1049,7 @@ void GDScriptByteCodeGenerator::write_end_or(const Address &p_target) {
 	logic_op_jump_pos2.pop_back();
 	append_opcode(GDScriptFunction::OPCODE_ASSIGN_TRUE);
 	append(p_target);
+	mark_jump_target();
 }
 
 void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
@@ -820,6 +1118,7 @@ void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address
 }
 
 void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address &p_index, const Address &p_source) {
+	const int start = opcodes.size();
 	if (HAS_BUILTIN_TYPE(p_source)) {
 		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_getter(p_source.type.builtin_type)) {
 			// Use indexed getter instead.
@@ -829,6 +1128,7 @@ void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address
 			append(p_index);
 			append(p_target);
 			append(getter);
+			set_last_result(start, 3, p_target);
 			return;
 		} else if (Variant::get_member_validated_keyed_getter(p_source.type.builtin_type)) {
 			Variant::ValidatedKeyedGetter getter = Variant::get_member_validated_keyed_getter(p_source.type.builtin_type);
@@ -837,6 +1137,7 @@ void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address
 			append(p_index);
 			append(p_target);
 			append(getter);
+			set_last_result(start, 3, p_target);
 			return;
 		}
 	}
@@ -844,6 +1145,7 @@ void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address
 	append(p_source);
 	append(p_index);
 	append(p_target);
+	set_last_result(start, 3, p_target);
 }
 
 void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -863,9 +1165,11 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
+	const int start = opcodes.size();
 	if (HAS_BUILTIN_TYPE(p_source) && Variant::get_member_validated_getter(p_source.type.builtin_type, p_name)) {
 		Variant::ValidatedGetter getter = Variant::get_member_validated_getter(p_source.type.builtin_type, p_name);
 		append_opcode(GDScriptFunction::OPCODE_GET_NAMED_VALIDATED);
@@ -875,12 +1179,15 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 #ifdef DEBUG_ENABLED
 		add_debug_name(getter_names, get_getter_pos(getter), p_name);
 #endif
+		set_last_result(start, 2, p_target);
 		return;
 	}
 	append_opcode(GDScriptFunction::OPCODE_GET_NAMED);
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append_inline_cache();
+	set_last_result(start, 2, p_target);
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -890,9 +1197,11 @@ void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const S
 }
 
 void GDScriptByteCodeGenerator::write_get_member(const Address &p_target, const StringName &p_name) {
+	const int start = opcodes.size();
 	append_opcode(GDScriptFunction::OPCODE_GET_MEMBER);
 	append(p_target);
 	append(p_name);
+	set_last_result(start, 1, p_target);
 }
 
 void GDScriptByteCodeGenerator::write_set_static_variable(const Address &p_value, const Address &p_class, int p_index) {
@@ -997,9 +1306,21 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_source);
 		append(p_target.type.builtin_type);
 	} else {
+		const int start = opcodes.size();
+		const TemporaryResult source_result = last_result;
+		const bool forward = is_last_result(p_source) && can_forward_to(p_target);
+
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN);
 		append(p_target);
 		append(p_source);
+
+		if (forward) {
+			forwarded_result.result = source_result;
+			forwarded_result.assign_start = start;
+			forwarded_result.assign_end = opcodes.size();
+			forwarded_result.target = p_target;
+		}
+		set_last_result(start, 1, p_target);
 	}
 }
 
@@ -1025,11 +1346,15 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 		write_assign(p_dst, p_src);
 	}
 	function->default_arguments.push_back(opcodes.size());
+	mark_jump_target();
 }
 
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
 	append_opcode(GDScriptFunction::OPCODE_STORE_GLOBAL);
 	append(p_dst);
+#ifdef TOOLS_ENABLED
+	function->global_index_positions.push_back(opcodes.size());
+#endif
 	append(p_global_index);
 }
 
@@ -1094,6 +1419,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1119,6 +1445,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1353,6 +1680,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1366,6 +1694,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1379,6 +1708,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1513,8 +1843,10 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!write_fused_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1728,6 +2060,7 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 	append(0); // End of loop address, will be patched.
 	append_opcode(GDScriptFunction::OPCODE_JUMP);
 	append(opcodes.size() + (p_is_range ? 7 : 6)); // Skip over 'continue' code.
+	mark_jump_target();
 
 	// Next iteration.
 	int continue_addr = opcodes.size();
@@ -1743,6 +2076,7 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 	append(p_use_conversion ? temp : p_variable);
 	for_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
+	mark_jump_target();
 
 	if (p_use_conversion) {
 		write_assign_with_conversion(p_variable, temp);
@@ -1784,12 +2118,15 @@ void GDScriptByteCodeGenerator::write_endfor(bool p_is_range) {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	mark_jump_target();
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!write_fused_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -1954,6 +2291,7 @@ void GDScriptByteCodeGenerator::clear_temporaries() {
 		}
 	}
 	temporaries_pending_clear.clear();
+	temporaries_cleared_at = opcodes.size();
 }
 
 void GDScriptByteCodeGenerator::clear_address(const Address &p_address) {
@@ -99,6 +99,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int max_locals = 0;
 	int current_line = 0;
 	int instr_args_max = 0;
+	int inline_cache_count = 0;
 
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
@@ -162,6 +163,46 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	List<List<int>> current_breaks_to_patch;
 
+	// Peephole optimizations, enabled with `debug/settings/gdscript/optimize_bytecode`.
+	bool optimize = false;
+	// Last position that code can jump to. Instructions can't be merged across it.
+	int last_jump_target = 0;
+
+	// Last instruction that wrote its result to a temporary.
+	struct TemporaryResult {
+		int start = -1;
+		int end = -1;
+		int result_index = -1;
+		Address temporary;
+	} last_result;
+
+	// Assignment of `last_result` to a local or member, removed when the temporary is popped.
+	struct ForwardedResult {
+		TemporaryResult result;
+		int assign_start = -1;
+		int assign_end = -1;
+		Address target;
+	} forwarded_result;
+
+	// `OPCODE_GET_MEMBER` fused with the validated operator that follows it, or -1.
+	int fused_member_get = -1;
+	// Position after the last cleanup of temporaries, where the current statement starts.
+	int temporaries_cleared_at = 0;
+
+	void mark_jump_target() {
+		last_jump_target = opcodes.size();
+	}
+
+	void set_last_result(int p_start, int p_result_offset, const Address &p_target);
+	bool is_last_result(const Address &p_temporary) const;
+	bool can_forward_to(const Address &p_target);
+	void forward_result();
+	bool write_folded_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand);
+	bool write_fused_jump_if_not(const Address &p_condition);
+	void fuse_member_get(const Address &p_left_operand, const Address &p_right_operand);
+	bool is_temporary_used_since(int p_slot, int p_position) const;
+	static GDScriptFunction::Opcode get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type);
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -451,8 +492,13 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.push_back(get_lambda_function_pos(p_lambda_function));
 	}
 
+	void append_inline_cache() {
+		opcodes.push_back(inline_cache_count++);
+	}
+
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		mark_jump_target();
 	}
 
 public:
@@ -0,0 +1,1480 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_bytecode_cache.h"
+
+#include "gdscript_cache.h"
+#include "gdscript_utility_functions.h"
+
+#include "core/io/file_access.h"
+#include "core/io/marshalls.h"
+#include "core/io/resource_loader.h"
+#include "core/object/class_db.h"
+#include "core/templates/rb_map.h"
+#include "core/version.h"
+
+#ifdef TOOLS_ENABLED
+#include "gdscript_analyzer.h"
+#include "gdscript_compiler.h"
+#include "gdscript_parser.h"
+#endif
+
+// Identifies an engine binding (operator, member accessor, method...) stored by a function,
+// so it can be looked up again in the running engine.
+struct GDScriptBindingInfo {
+	int type = 0; // Variant type, or operator.
+	int type_b = 0; // Operand types, or constructor index.
+	int type_c = 0;
+	StringName name;
+};
+
+class GDScriptBytecodeCache::Writer {
+public:
+	Vector<uint8_t> buffer;
+	const GDScript *root = nullptr;
+	bool debug = false;
+	RBSet<String> dependencies;
+	HashMap<int, StringName> global_names;
+	String error;
+
+	_FORCE_INLINE_ bool has_failed() const { return !error.is_empty(); }
+
+	void fail(const String &p_error) {
+		if (error.is_empty()) {
+			error = p_error;
+		}
+	}
+
+	void put_data(const uint8_t *p_data, int p_size) {
+		int pos = buffer.size();
+		buffer.resize(pos + p_size);
+		memcpy(buffer.ptrw() + pos, p_data, p_size);
+	}
+
+	void put_32(uint32_t p_value) {
+		int pos = buffer.size();
+		buffer.resize(pos + 4);
+		encode_uint32(p_value, buffer.ptrw() + pos);
+	}
+
+	void put_bool(bool p_value) {
+		put_32(p_value ? 1 : 0);
+	}
+
+	void put_string(const String &p_string) {
+		CharString utf8 = p_string.utf8();
+		put_32(utf8.length());
+		put_data(reinterpret_cast<const uint8_t *>(utf8.get_data()), utf8.length());
+	}
+
+	void put_variant(const Variant &p_value) {
+		int len = 0;
+		Error err = encode_variant(p_value, nullptr, len, false);
+		if (err != OK) {
+			fail(vformat(R"(Can't encode constant of type "%s".)", Variant::get_type_name(p_value.get_type())));
+			return;
+		}
+		put_32(len);
+		int pos = buffer.size();
+		buffer.resize(pos + len);
+		encode_variant(p_value, buffer.ptrw() + pos, len, false);
+	}
+
+	template <typename T>
+	void put_bindings(const Vector<T> &p_pointers, const RBMap<T, GDScriptBindingInfo> &p_infos, const char *p_kind) {
+		put_32(p_pointers.size());
+		for (const T &pointer : p_pointers) {
+			const typename RBMap<T, GDScriptBindingInfo>::Element *E = p_infos.find(pointer);
+			if (E == nullptr) {
+				fail(vformat("Unknown %s binding.", p_kind));
+				return;
+			}
+			const GDScriptBindingInfo &info = E->value();
+			put_32(info.type);
+			put_32(info.type_b);
+			put_32(info.type_c);
+			put_string(info.name);
+		}
+	}
+
+	void put_names(const Vector<String> &p_names) {
+		put_32(p_names.size());
+		for (const String &name : p_names) {
+			put_string(name);
+		}
+	}
+
+	Writer(const GDScript *p_root, bool p_debug) :
+			root(p_root), debug(p_debug) {
+		for (const KeyValue<StringName, int> &E : GDScriptLanguage::get_singleton()->get_global_map()) {
+			global_names[E.value] = E.key;
+		}
+	}
+};
+
+class GDScriptBytecodeCache::Reader {
+public:
+	const uint8_t *data = nullptr;
+	int size = 0;
+	int pos = 0;
+	bool failed = false;
+	GDScript *root = nullptr;
+
+	uint32_t get_32() {
+		if (failed || pos + 4 > size) {
+			failed = true;
+			return 0;
+		}
+		uint32_t value = decode_uint32(data + pos);
+		pos += 4;
+		return value;
+	}
+
+	_FORCE_INLINE_ int get_int() { return (int32_t)get_32(); }
+	_FORCE_INLINE_ bool get_bool() { return get_32() != 0; }
+
+	// Reads an element count, rejecting counts that can't fit in the remaining data.
+	int get_count() {
+		uint32_t count = get_32();
+		if (count > (uint32_t)(size - pos)) {
+			failed = true;
+			return 0;
+		}
+		return count;
+	}
+
+	String get_string() {
+		int len = get_count();
+		if (failed) {
+			return String();
+		}
+		String string;
+		if (string.append_utf8(reinterpret_cast<const char *>(data + pos), len) != OK) {
+			failed = true;
+		}
+		pos += len;
+		return string;
+	}
+
+	_FORCE_INLINE_ StringName get_name() { return StringName(get_string()); }
+
+	Variant get_variant() {
+		int len = get_count();
+		if (failed) {
+			return Variant();
+		}
+		Variant value;
+		int read = 0;
+		if (decode_variant(value, data + pos, len, &read, false) != OK || read != len) {
+			failed = true;
+			return Variant();
+		}
+		pos += len;
+		return value;
+	}
+
+	template <typename T>
+	void get_bindings(Vector<T> &r_pointers, T (*p_resolve)(const GDScriptBindingInfo &)) {
+		int count = get_count();
+		r_pointers.resize(count);
+		for (int i = 0; i < count && !failed; i++) {
+			GDScriptBindingInfo info;
+			info.type = get_int();
+			info.type_b = get_int();
+			info.type_c = get_int();
+			info.name = get_name();
+			if (failed) {
+				break;
+			}
+			T pointer = p_resolve(info);
+			if (pointer == nullptr) {
+				failed = true;
+				break;
+			}
+			r_pointers.write[i] = pointer;
+		}
+	}
+
+	void get_names(Vector<String> &r_names) {
+		int count = get_count();
+		r_names.resize(count);
+		for (int i = 0; i < count && !failed; i++) {
+			r_names.write[i] = get_string();
+		}
+	}
+
+	Reader(const Vector<uint8_t> &p_buffer, GDScript *p_root) :
+			data(p_buffer.ptr()), size(p_buffer.size()), root(p_root) {}
+};
+
+static bool _is_valid_type(int p_type) {
+	return p_type >= 0 && p_type < Variant::VARIANT_MAX;
+}
+
+static Variant::ValidatedOperatorEvaluator _resolve_operator(const GDScriptBindingInfo &p_info) {
+	if (p_info.type < 0 || p_info.type >= Variant::OP_MAX || !_is_valid_type(p_info.type_b) || !_is_valid_type(p_info.type_c)) {
+		return nullptr;
+	}
+	return Variant::get_validated_operator_evaluator((Variant::Operator)p_info.type, (Variant::Type)p_info.type_b, (Variant::Type)p_info.type_c);
+}
+
+static Variant::ValidatedSetter _resolve_setter(const GDScriptBindingInfo &p_info) {
+	return _is_valid_type(p_info.type) ? Variant::get_member_validated_setter((Variant::Type)p_info.type, p_info.name) : nullptr;
+}
+
+static Variant::ValidatedGetter _resolve_getter(const GDScriptBindingInfo &p_info) {
+	return _is_valid_type(p_info.type) ? Variant::get_member_validated_getter((Variant::Type)p_info.type, p_info.name) : nullptr;
+}
+
+static Variant::ValidatedKeyedSetter _resolve_keyed_setter(const GDScriptBindingInfo &p_info) {
+	return _is_valid_type(p_info.type) ? Variant::get_member_validated_keyed_setter((Variant::Type)p_info.type) : nullptr;
+}
+
+static Variant::ValidatedKeyedGetter _resolve_keyed_getter(const GDScriptBindingInfo &p_info) {
+	return _is_valid_type(p_info.type) ? Variant::get_member_validated_keyed_getter((Variant::Type)p_info.type) : nullptr;
+}
+
+static Variant::ValidatedIndexedSetter _resolve_indexed_setter(const GDScriptBindingInfo &p_info) {
+	return _is_valid_type(p_info.type) ? Variant::get_member_validated_indexed_setter((Variant::Type)p_info.type) : nullptr;
+}
+
+static Variant::ValidatedIndexedGetter _resolve_indexed_getter(const GDScriptBindingInfo &p_info) {
+	return _is_valid_type(p_info.type) ? Variant::get_member_validated_indexed_getter((Variant::Type)p_info.type) : nullptr;
+}
+
+static Variant::ValidatedBuiltInMethod _resolve_builtin_method(const GDScriptBindingInfo &p_info) {
+	return _is_valid_type(p_info.type) ? Variant::get_validated_builtin_method((Variant::Type)p_info.type, p_info.name) : nullptr;
+}
+
+static Variant::ValidatedConstructor _resolve_constructor(const GDScriptBindingInfo &p_info) {
+	if (!_is_valid_type(p_info.type) || p_info.type_b < 0 || p_info.type_b >= Variant::get_constructor_count((Variant::Type)p_info.type)) {
+		return nullptr;
+	}
+	return Variant::get_validated_constructor((Variant::Type)p_info.type, p_info.type_b);
+}
+
+static Variant::ValidatedUtilityFunction _resolve_utility(const GDScriptBindingInfo &p_info) {
+	return Variant::get_validated_utility_function(p_info.name);
+}
+
+static GDScriptUtilityFunctions::FunctionPtr _resolve_gds_utility(const GDScriptBindingInfo &p_info) {
+	return GDScriptUtilityFunctions::get_function(p_info.name);
+}
+
+template <typename T>
+static void _bind_table(const Vector<T> &p_table, const T *&r_ptr, int &r_count) {
+	r_count = p_table.size();
+	r_ptr = p_table.is_empty() ? nullptr : p_table.ptr();
+}
+
+template <typename T>
+static void _bind_table(Vector<T> &p_table, T *&r_ptr, int &r_count) {
+	r_count = p_table.size();
+	r_ptr = p_table.is_empty() ? nullptr : p_table.ptrw();
+}
+
+#ifdef TOOLS_ENABLED
+// Reverse lookups of the engine bindings, to store them by name.
+
+static const RBMap<Variant::ValidatedOperatorEvaluator, GDScriptBindingInfo> &_get_operator_bindings() {
+	static const RBMap<Variant::ValidatedOperatorEvaluator, GDScriptBindingInfo> bindings = []() {
+		RBMap<Variant::ValidatedOperatorEvaluator, GDScriptBindingInfo> result;
+		for (int op = 0; op < Variant::OP_MAX; op++) {
+			for (int a = 0; a < Variant::VARIANT_MAX; a++) {
+				for (int b = 0; b < Variant::VARIANT_MAX; b++) {
+					Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator((Variant::Operator)op, (Variant::Type)a, (Variant::Type)b);
+					if (evaluator && !result.has(evaluator)) {
+						result[evaluator] = { op, a, b, StringName() };
+					}
+				}
+			}
+		}
+		return result;
+	}();
+	return bindings;
+}
+
+template <typename T>
+static RBMap<T, GDScriptBindingInfo> _make_member_bindings(T (*p_get)(Variant::Type, const StringName &)) {
+	RBMap<T, GDScriptBindingInfo> result;
+	for (int type = 0; type < Variant::VARIANT_MAX; type++) {
+		List<StringName> members;
+		Variant::get_member_list((Variant::Type)type, &members);
+		for (const StringName &member : members) {
+			T pointer = p_get((Variant::Type)type, member);
+			if (pointer && !result.has(pointer)) {
+				result[pointer] = { type, 0, 0, member };
+			}
+		}
+	}
+	return result;
+}
+
+template <typename T>
+static RBMap<T, GDScriptBindingInfo> _make_type_bindings(T (*p_get)(Variant::Type)) {
+	RBMap<T, GDScriptBindingInfo> result;
+	for (int type = 0; type < Variant::VARIANT_MAX; type++) {
+		T pointer = p_get((Variant::Type)type);
+		if (pointer && !result.has(pointer)) {
+			result[pointer] = { type, 0, 0, StringName() };
+		}
+	}
+	return result;
+}
+
+static const RBMap<Variant::ValidatedSetter, GDScriptBindingInfo> &_get_setter_bindings() {
+	static const RBMap<Variant::ValidatedSetter, GDScriptBindingInfo> bindings = _make_member_bindings(&Variant::get_member_validated_setter);
+	return bindings;
+}
+
+static const RBMap<Variant::ValidatedGetter, GDScriptBindingInfo> &_get_getter_bindings() {
+	static const RBMap<Variant::ValidatedGetter, GDScriptBindingInfo> bindings = _make_member_bindings(&Variant::get_member_validated_getter);
+	return bindings;
+}
+
+static const RBMap<Variant::ValidatedKeyedSetter, GDScriptBindingInfo> &_get_keyed_setter_bindings() {
+	static const RBMap<Variant::ValidatedKeyedSetter, GDScriptBindingInfo> bindings = _make_type_bindings(&Variant::get_member_validated_keyed_setter);
+	return bindings;
+}
+
+static const RBMap<Variant::ValidatedKeyedGetter, GDScriptBindingInfo> &_get_keyed_getter_bindings() {
+	static const RBMap<Variant::ValidatedKeyedGetter, GDScriptBindingInfo> bindings = _make_type_bindings(&Variant::get_member_validated_keyed_getter);
+	return bindings;
+}
+
+static const RBMap<Variant::ValidatedIndexedSetter, GDScriptBindingInfo> &_get_indexed_setter_bindings() {
+	static const RBMap<Variant::ValidatedIndexedSetter, GDScriptBindingInfo> bindings = _make_type_bindings(&Variant::get_member_validated_indexed_setter);
+	return bindings;
+}
+
+static const RBMap<Variant::ValidatedIndexedGetter, GDScriptBindingInfo> &_get_indexed_getter_bindings() {
+	static const RBMap<Variant::ValidatedIndexedGetter, GDScriptBindingInfo> bindings = _make_type_bindings(&Variant::get_member_validated_indexed_getter);
+	return bindings;
+}
+
+static const RBMap<Variant::ValidatedBuiltInMethod, GDScriptBindingInfo> &_get_builtin_method_bindings() {
+	static const RBMap<Variant::ValidatedBuiltInMethod, GDScriptBindingInfo> bindings = []() {
+		RBMap<Variant::ValidatedBuiltInMethod, GDScriptBindingInfo> result;
+		for (int type = 0; type < Variant::VARIANT_MAX; type++) {
+			List<StringName> methods;
+			Variant::get_builtin_method_list((Variant::Type)type, &methods);
+			for (const StringName &method : methods) {
+				Variant::ValidatedBuiltInMethod pointer = Variant::get_validated_builtin_method((Variant::Type)type, method);
+				if (pointer && !result.has(pointer)) {
+					result[pointer] = { type, 0, 0, method };
+				}
+			}
+		}
+		return result;
+	}();
+	return bindings;
+}
+
+static const RBMap<Variant::ValidatedConstructor, GDScriptBindingInfo> &_get_constructor_bindings() {
+	static const RBMap<Variant::ValidatedConstructor, GDScriptBindingInfo> bindings = []() {
+		RBMap<Variant::ValidatedConstructor, GDScriptBindingInfo> result;
+		for (int type = 0; type < Variant::VARIANT_MAX; type++) {
+			for (int i = 0; i < Variant::get_constructor_count((Variant::Type)type); i++) {
+				Variant::ValidatedConstructor pointer = Variant::get_validated_constructor((Variant::Type)type, i);
+				if (pointer && !result.has(pointer)) {
+					result[pointer] = { type, i, 0, StringName() };
+				}
+			}
+		}
+		return result;
+	}();
+	return bindings;
+}
+
+static const RBMap<Variant::ValidatedUtilityFunction, GDScriptBindingInfo> &_get_utility_bindings() {
+	static const RBMap<Variant::ValidatedUtilityFunction, GDScriptBindingInfo> bindings = []() {
+		RBMap<Variant::ValidatedUtilityFunction, GDScriptBindingInfo> result;
+		List<StringName> functions;
+		Variant::get_utility_function_list(&functions);
+		for (const StringName &function : functions) {
+			Variant::ValidatedUtilityFunction pointer = Variant::get_validated_utility_function(function);
+			if (pointer && !result.has(pointer)) {
+				result[pointer] = { 0, 0, 0, function };
+			}
+		}
+		return result;
+	}();
+	return bindings;
+}
+
+static const RBMap<GDScriptUtilityFunctions::FunctionPtr, GDScriptBindingInfo> &_get_gds_utility_bindings() {
+	static const RBMap<GDScriptUtilityFunctions::FunctionPtr, GDScriptBindingInfo> bindings = []() {
+		RBMap<GDScriptUtilityFunctions::FunctionPtr, GDScriptBindingInfo> result;
+		List<StringName> functions;
+		GDScriptUtilityFunctions::get_function_list(&functions);
+		for (const StringName &function : functions) {
+			GDScriptUtilityFunctions::FunctionPtr pointer = GDScriptUtilityFunctions::get_function(function);
+			if (pointer && !result.has(pointer)) {
+				result[pointer] = { 0, 0, 0, function };
+			}
+		}
+		return result;
+	}();
+	return bindings;
+}
+
+static bool _has_static_data(const GDScriptParser::ClassNode *p_class) {
+	if (p_class->has_static_data) {
+		return true;
+	}
+	for (const GDScriptParser::ClassNode::Member &member : p_class->members) {
+		if (member.type == GDScriptParser::ClassNode::Member::CLASS && _has_static_data(member.m_class)) {
+			return true;
+		}
+	}
+	return false;
+}
+#endif // TOOLS_ENABLED
+
+uint32_t GDScriptBytecodeCache::_get_build_flags() {
+	uint32_t flags = sizeof(void *) << BUILD_POINTER_SIZE_SHIFT;
+#ifdef DEBUG_ENABLED
+	flags |= BUILD_DEBUG;
+#endif
+#ifdef REAL_T_IS_DOUBLE
+	flags |= BUILD_REAL_T_IS_DOUBLE;
+#endif
+	return flags;
+}
+
+String GDScriptBytecodeCache::_get_engine_build() {
+	return String(GODOT_VERSION_FULL_BUILD) + "." + GODOT_VERSION_HASH;
+}
+
+bool GDScriptBytecodeCache::_read_header(Reader &p_reader, bool p_verify, uint32_t p_tokens_hash) {
+	if (p_reader.size < 4 || memcmp(p_reader.data, "GDBC", 4) != 0) {
+		return false;
+	}
+	p_reader.pos = 4;
+
+	if (p_reader.get_32() != FORMAT_VERSION || p_reader.get_32() != _get_build_flags()) {
+		return false;
+	}
+	uint32_t tokens_hash = p_reader.get_32();
+	if (p_reader.get_string() != _get_engine_build()) {
+		return false;
+	}
+	if (p_verify && tokens_hash != p_tokens_hash) {
+		return false;
+	}
+
+	// Scripts the compiled code depends on, which must be exported the same as when it was compiled.
+	int dependency_count = p_reader.get_count();
+	for (int i = 0; i < dependency_count && !p_reader.failed; i++) {
+		String path = p_reader.get_string();
+		uint32_t hash = p_reader.get_32();
+		if (!p_verify || p_reader.failed) {
+			continue;
+		}
+		String remapped_path = ResourceLoader::path_remap(path);
+		if (!remapped_path.has_extension("gdc")) {
+			return false;
+		}
+		// Dependencies are shared by many scripts, their tokens are only read and hashed once.
+		uint32_t tokens_hash = 0;
+		if (!GDScriptCache::get_binary_tokens_hash(remapped_path, tokens_hash) || tokens_hash != hash) {
+			return false;
+		}
+	}
+
+	return !p_reader.failed;
+}
+
+String GDScriptBytecodeCache::get_cache_path(const String &p_binary_tokens_path) {
+	return p_binary_tokens_path.get_basename() + ".gdbc";
+}
+
+Vector<uint8_t> GDScriptBytecodeCache::load_cache(const String &p_binary_tokens_path, const Vector<uint8_t> &p_binary_tokens) {
+	// The debugger needs the local variables info, which isn't cached.
+	if (p_binary_tokens.is_empty() || GDScriptLanguage::get_singleton()->should_track_locals()) {
+		return Vector<uint8_t>();
+	}
+
+	const String cache_path = get_cache_path(p_binary_tokens_path);
+	if (!FileAccess::exists(cache_path)) {
+		return Vector<uint8_t>();
+	}
+
+	// The tokens were just read through `GDScriptCache::get_binary_tokens()`, which hashed them.
+	uint32_t tokens_hash = 0;
+	if (!GDScriptCache::get_binary_tokens_hash(p_binary_tokens_path, tokens_hash)) {
+		tokens_hash = hash_djb2_buffer(p_binary_tokens.ptr(), p_binary_tokens.size());
+	}
+
+	Vector<uint8_t> cache = FileAccess::get_file_as_bytes(cache_path);
+	Reader reader(cache, nullptr);
+	if (!_read_header(reader, true, tokens_hash)) {
+		print_verbose(vformat(R"(GDScript: Ignoring outdated bytecode cache "%s".)", cache_path));
+		return Vector<uint8_t>();
+	}
+	return cache;
+}
+
+PropertyInfo GDScriptBytecodeCache::_load_property_info(Reader &p_reader) {
+	PropertyInfo info;
+	info.type = (Variant::Type)p_reader.get_int();
+	info.name = p_reader.get_string();
+	info.class_name = p_reader.get_name();
+	info.hint = (PropertyHint)p_reader.get_int();
+	info.hint_string = p_reader.get_string();
+	info.usage = p_reader.get_32();
+	if (!_is_valid_type(info.type)) {
+		p_reader.failed = true;
+	}
+	return info;
+}
+
+MethodInfo GDScriptBytecodeCache::_load_method_info(Reader &p_reader) {
+	MethodInfo info;
+	info.name = p_reader.get_string();
+	info.return_val = _load_property_info(p_reader);
+	info.flags = p_reader.get_32();
+	info.id = p_reader.get_int();
+	int argument_count = p_reader.get_count();
+	for (int i = 0; i < argument_count && !p_reader.failed; i++) {
+		info.arguments.push_back(_load_property_info(p_reader));
+	}
+	int default_count = p_reader.get_count();
+	for (int i = 0; i < default_count && !p_reader.failed; i++) {
+		info.default_arguments.push_back(_load_value(p_reader));
+	}
+	info.return_val_metadata = p_reader.get_int();
+	int metadata_count = p_reader.get_count();
+	for (int i = 0; i < metadata_count && !p_reader.failed; i++) {
+		info.arguments_metadata.push_back(p_reader.get_int());
+	}
+	return info;
+}
+
+Variant GDScriptBytecodeCache::_load_value(Reader &p_reader) {
+	ValueTag tag = (ValueTag)p_reader.get_32();
+	if (p_reader.failed) {
+		return Variant();
+	}
+
+	switch (tag) {
+		case VALUE_VARIANT:
+			return p_reader.get_variant();
+		case VALUE_NULL_OBJECT:
+			return Variant((Object *)nullptr);
+		case VALUE_ARRAY: {
+			Array array;
+			uint32_t typed_builtin = p_reader.get_32();
+			StringName typed_class_name = p_reader.get_name();
+			Variant typed_script = _load_value(p_reader);
+			bool read_only = p_reader.get_bool();
+			if (typed_builtin != Variant::NIL) {
+				array.set_typed(typed_builtin, typed_class_name, typed_script);
+			}
+			int size = p_reader.get_count();
+			for (int i = 0; i < size && !p_reader.failed; i++) {
+				array.push_back(_load_value(p_reader));
+			}
+			if (read_only) {
+				array.make_read_only();
+			}
+			return array;
+		}
+		case VALUE_DICTIONARY: {
+			Dictionary dictionary;
+			uint32_t key_builtin = p_reader.get_32();
+			StringName key_class_name = p_reader.get_name();
+			Variant key_script = _load_value(p_reader);
+			uint32_t value_builtin = p_reader.get_32();
+			StringName value_class_name = p_reader.get_name();
+			Variant value_script = _load_value(p_reader);
+			bool read_only = p_reader.get_bool();
+			if (key_builtin != Variant::NIL || value_builtin != Variant::NIL) {
+				dictionary.set_typed(key_builtin, key_class_name, key_script, value_builtin, value_class_name, value_script);
+			}
+			int size = p_reader.get_count();
+			for (int i = 0; i < size && !p_reader.failed; i++) {
+				Variant key = _load_value(p_reader);
+				dictionary[key] = _load_value(p_reader);
+			}
+			if (read_only) {
+				dictionary.make_read_only();
+			}
+			return dictionary;
+		}
+		case VALUE_LOCAL_CLASS: {
+			String fqcn = p_reader.get_string();
+			GDScript *found = p_reader.failed ? nullptr : p_reader.root->find_class(p_reader.root->fully_qualified_name + fqcn);
+			if (found == nullptr) {
+				p_reader.failed = true;
+				return Variant();
+			}
+			return Ref<GDScript>(found);
+		}
+		case VALUE_SCRIPT: {
+			String path = p_reader.get_string();
+			String fqcn = p_reader.get_string();
+			if (p_reader.failed) {
+				return Variant();
+			}
+			Error err = OK;
+			Ref<GDScript> script = GDScriptCache::get_shallow_script(path, err, p_reader.root->path);
+			GDScript *found = (err == OK && script.is_valid()) ? script->find_class(fqcn) : nullptr;
+			if (found == nullptr) {
+				p_reader.failed = true;
+				return Variant();
+			}
+			return Ref<GDScript>(found);
+		}
+		case VALUE_NATIVE_CLASS: {
+			StringName name = p_reader.get_name();
+			const HashMap<StringName, int>::ConstIterator E = GDScriptLanguage::get_singleton()->get_global_map().find(name);
+			if (!E) {
+				p_reader.failed = true;
+				return Variant();
+			}
+			return GDScriptLanguage::get_singleton()->get_global_array()[E->value];
+		}
+		case VALUE_RESOURCE: {
+			String path = p_reader.get_string();
+			Ref<Resource> resource = p_reader.failed ? Ref<Resource>() : ResourceLoader::load(path);
+			if (resource.is_null()) {
+				p_reader.failed = true;
+				return Variant();
+			}
+			return resource;
+		}
+	}
+
+	p_reader.failed = true;
+	return Variant();
+}
+
+GDScriptDataType GDScriptBytecodeCache::_load_data_type(Reader &p_reader) {
+	GDScriptDataType type;
+	type.kind = (GDScriptDataType::Kind)p_reader.get_int();
+	type.builtin_type = (Variant::Type)p_reader.get_int();
+	type.native_type = p_reader.get_name();
+
+	Ref<Script> script = _load_value(p_reader);
+	type.script_type = script.ptr();
+	// Like the compiler, only hold a strong reference to classes from other files, to avoid cyclic references.
+	GDScript *gdscript = Object::cast_to<GDScript>(script.ptr());
+	if (type.kind != GDScriptDataType::GDSCRIPT || gdscript == nullptr || gdscript->get_root_script() != p_reader.root) {
+		type.script_type_ref = script;
+	}
+
+	int element_count = p_reader.get_count();
+	for (int i = 0; i < element_count && !p_reader.failed; i++) {
+		type.container_element_types.push_back(_load_data_type(p_reader));
+	}
+
+	if (type.kind > GDScriptDataType::GDSCRIPT || !_is_valid_type(type.builtin_type)) {
+		p_reader.failed = true;
+	}
+	return type;
+}
+
+GDScript::MemberInfo GDScriptBytecodeCache::_load_member_info(Reader &p_reader) {
+	GDScript::MemberInfo info;
+	info.index = p_reader.get_int();
+	info.setter = p_reader.get_name();
+	info.getter = p_reader.get_name();
+	info.data_type = _load_data_type(p_reader);
+	info.property_info = _load_property_info(p_reader);
+	return info;
+}
+
+GDScriptFunction *GDScriptBytecodeCache::_load_function(Reader &p_reader, GDScript *p_script) {
+	GDScriptFunction *function = memnew(GDScriptFunction);
+	function->_script = p_script;
+	function->source = p_script->get_script_path();
+	function->name = p_reader.get_name();
+
+#ifdef DEBUG_ENABLED
+	function->func_cname = (String(function->source) + " - " + String(function->name)).utf8();
+	function->_func_cname = function->func_cname.get_data();
+#endif
+
+	function->_static = p_reader.get_bool();
+	function->_initial_line = p_reader.get_int();
+	function->_argument_count = p_reader.get_int();
+	function->_vararg_index = p_reader.get_int();
+	function->_stack_size = p_reader.get_int();
+	function->_instruction_args_size = p_reader.get_int();
+
+	int argument_count = p_reader.get_count();
+	for (int i = 0; i < argument_count && !p_reader.failed; i++) {
+		function->argument_types.push_back(_load_data_type(p_reader));
+	}
+	function->return_type = _load_data_type(p_reader);
+	function->method_info = _load_method_info(p_reader);
+	function->rpc_config = _load_value(p_reader);
+
+	int temporary_count = p_reader.get_count();
+	for (int i = 0; i < temporary_count && !p_reader.failed; i++) {
+		int slot = p_reader.get_int();
+		function->temporary_slots[slot] = (Variant::Type)p_reader.get_int();
+	}
+
+	int code_size = p_reader.get_count();
+	function->code.resize(code_size);
+	for (int i = 0; i < code_size && !p_reader.failed; i++) {
+		function->code.write[i] = p_reader.get_int();
+	}
+	int inline_cache_count = p_reader.get_count();
+
+	// Global indices depend on the globals registered in this run.
+	int global_count = p_reader.get_count();
+	for (int i = 0; i < global_count && !p_reader.failed; i++) {
+		int position = p_reader.get_int();
+		StringName global = p_reader.get_name();
+		const HashMap<StringName, int>::ConstIterator E = GDScriptLanguage::get_singleton()->get_global_map().find(global);
+		if (!E || position < 0 || position >= code_size) {
+			p_reader.failed = true;
+			break;
+		}
+		function->code.write[position] = E->value;
+	}
+
+	int default_count = p_reader.get_count();
+	for (int i = 0; i < default_count && !p_reader.failed; i++) {
+		function->default_arguments.push_back(p_reader.get_int());
+	}
+
+	int constant_count = p_reader.get_count();
+	for (int i = 0; i < constant_count && !p_reader.failed; i++) {
+		function->constants.push_back(_load_value(p_reader));
+	}
+	int constant_map_count = p_reader.get_count();
+	for (int i = 0; i < constant_map_count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_name();
+		function->constant_map[name] = _load_value(p_reader);
+	}
+
+	int name_count = p_reader.get_count();
+	for (int i = 0; i < name_count && !p_reader.failed; i++) {
+		function->global_names.push_back(p_reader.get_name());
+	}
+
+	p_reader.get_bindings(function->operator_funcs, _resolve_operator);
+	p_reader.get_bindings(function->setters, _resolve_setter);
+	p_reader.get_bindings(function->getters, _resolve_getter);
+	p_reader.get_bindings(function->keyed_setters, _resolve_keyed_setter);
+	p_reader.get_bindings(function->keyed_getters, _resolve_keyed_getter);
+	p_reader.get_bindings(function->indexed_setters, _resolve_indexed_setter);
+	p_reader.get_bindings(function->indexed_getters, _resolve_indexed_getter);
+	p_reader.get_bindings(function->builtin_methods, _resolve_builtin_method);
+	p_reader.get_bindings(function->constructors, _resolve_constructor);
+	p_reader.get_bindings(function->utilities, _resolve_utility);
+	p_reader.get_bindings(function->gds_utilities, _resolve_gds_utility);
+
+	int method_count = p_reader.get_count();
+	for (int i = 0; i < method_count && !p_reader.failed; i++) {
+		StringName class_name = p_reader.get_name();
+		StringName method_name = p_reader.get_name();
+		MethodBind *method = p_reader.failed ? nullptr : ClassDB::get_method(class_name, method_name);
+		if (method == nullptr) {
+			p_reader.failed = true;
+			break;
+		}
+		function->methods.push_back(method);
+	}
+
+	int lambda_count = p_reader.get_count();
+	for (int i = 0; i < lambda_count && !p_reader.failed; i++) {
+		GDScript::LambdaInfo info;
+		info.capture_count = p_reader.get_int();
+		info.use_self = p_reader.get_bool();
+		GDScriptFunction *lambda = _load_function(p_reader, p_script);
+		if (lambda == nullptr) {
+			p_reader.failed = true;
+			break;
+		}
+		function->lambdas.push_back(lambda);
+		p_script->lambda_info.insert(lambda, info);
+	}
+
+#ifdef DEBUG_ENABLED
+	p_reader.get_names(function->operator_names);
+	p_reader.get_names(function->setter_names);
+	p_reader.get_names(function->getter_names);
+	p_reader.get_names(function->builtin_methods_names);
+	p_reader.get_names(function->constructors_names);
+	p_reader.get_names(function->utilities_names);
+	p_reader.get_names(function->gds_utilities_names);
+#endif
+
+	if (p_reader.failed) {
+		memdelete(function);
+		return nullptr;
+	}
+
+	_bind_table(function->code, function->_code_ptr, function->_code_size);
+	_bind_table(function->constants, function->_constants_ptr, function->_constant_count);
+	_bind_table(function->global_names, function->_global_names_ptr, function->_global_names_count);
+	_bind_table(function->operator_funcs, function->_operator_funcs_ptr, function->_operator_funcs_count);
+	_bind_table(function->setters, function->_setters_ptr, function->_setters_count);
+	_bind_table(function->getters, function->_getters_ptr, function->_getters_count);
+	_bind_table(function->keyed_setters, function->_keyed_setters_ptr, function->_keyed_setters_count);
+	_bind_table(function->keyed_getters, function->_keyed_getters_ptr, function->_keyed_getters_count);
+	_bind_table(function->indexed_setters, function->_indexed_setters_ptr, function->_indexed_setters_count);
+	_bind_table(function->indexed_getters, function->_indexed_getters_ptr, function->_indexed_getters_count);
+	_bind_table(function->builtin_methods, function->_builtin_methods_ptr, function->_builtin_methods_count);
+	_bind_table(function->constructors, function->_constructors_ptr, function->_constructors_count);
+	_bind_table(function->utilities, function->_utilities_ptr, function->_utilities_count);
+	_bind_table(function->gds_utilities, function->_gds_utilities_ptr, function->_gds_utilities_count);
+	_bind_table(function->methods, function->_methods_ptr, function->_methods_count);
+	_bind_table(function->lambdas, function->_lambdas_ptr, function->_lambdas_count);
+
+	function->_inline_caches_count = inline_cache_count;
+	function->_inline_caches_ptr = inline_cache_count ? memnew_arr(GDScriptInlineCache, inline_cache_count) : nullptr;
+
+	if (function->default_arguments.size()) {
+		function->_default_arg_count = function->default_arguments.size() - 1;
+		function->_default_arg_ptr = function->default_arguments.ptr();
+	} else {
+		function->_default_arg_count = 0;
+		function->_default_arg_ptr = nullptr;
+	}
+
+	return function;
+}
+
+Error GDScriptBytecodeCache::_make_scripts(Reader &p_reader, GDScript *p_script) {
+	p_script->fully_qualified_name = p_reader.get_string();
+	p_script->local_name = p_reader.get_name();
+	p_script->global_name = p_reader.get_name();
+	p_script->simplified_icon_path = p_reader.get_string();
+
+	HashMap<StringName, Ref<GDScript>> old_subclasses;
+	old_subclasses = p_script->subclasses;
+	p_script->subclasses.clear();
+
+	int subclass_count = p_reader.get_count();
+	for (int i = 0; i < subclass_count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_name();
+		String fqcn = p_reader.get_string();
+
+		Ref<GDScript> subclass;
+		if (old_subclasses.has(name)) {
+			subclass = old_subclasses[name];
+		} else {
+			subclass = GDScriptLanguage::get_singleton()->get_orphan_subclass(fqcn);
+		}
+		if (subclass.is_null()) {
+			subclass.instantiate();
+		}
+
+		subclass->_owner = p_script;
+		subclass->path = p_script->path;
+		p_script->subclasses.insert(name, subclass);
+
+		Error err = _make_scripts(p_reader, subclass.ptr());
+		if (err) {
+			return err;
+		}
+	}
+
+	return p_reader.failed ? ERR_FILE_CORRUPT : OK;
+}
+
+void GDScriptBytecodeCache::_reset_class(GDScript *p_script) {
+	// Same as `GDScriptCompiler::_prepare_compilation()`, the script has no instances at this point.
+	p_script->clearing = true;
+
+	p_script->cancel_pending_functions(true);
+
+	p_script->native = Ref<GDScriptNativeClass>();
+	p_script->base = Ref<GDScript>();
+	p_script->members.clear();
+
+	// This makes possible to clear script constants and member_functions without heap-use-after-free errors.
+	HashMap<StringName, Variant> constants;
+	constants = p_script->constants;
+	p_script->constants.clear();
+	constants.clear();
+
+	HashMap<StringName, GDScriptFunction *> member_functions;
+	member_functions = p_script->member_functions;
+	p_script->member_functions.clear();
+	for (const KeyValue<StringName, GDScriptFunction *> &E : member_functions) {
+		memdelete(E.value);
+	}
+
+	if (p_script->implicit_initializer) {
+		memdelete(p_script->implicit_initializer);
+	}
+	if (p_script->implicit_ready) {
+		memdelete(p_script->implicit_ready);
+	}
+	if (p_script->static_initializer) {
+		memdelete(p_script->static_initializer);
+	}
+
+	p_script->member_functions.clear();
+	p_script->member_indices.clear();
+	p_script->static_variables_indices.clear();
+	p_script->static_variables.clear();
+	p_script->_signals.clear();
+	p_script->initializer = nullptr;
+	p_script->implicit_initializer = nullptr;
+	p_script->implicit_ready = nullptr;
+	p_script->static_initializer = nullptr;
+	p_script->rpc_config.clear();
+	p_script->lambda_info.clear();
+
+	p_script->clearing = false;
+}
+
+Error GDScriptBytecodeCache::_load_class(Reader &p_reader, GDScript *p_script) {
+	_reset_class(p_script);
+
+	p_script->tool = p_reader.get_bool();
+	p_script->_is_abstract = p_reader.get_bool();
+
+	StringName native_name = p_reader.get_name();
+	const HashMap<StringName, int>::ConstIterator native = GDScriptLanguage::get_singleton()->get_global_map().find(native_name);
+	if (p_reader.failed || !native) {
+		return ERR_FILE_CORRUPT;
+	}
+	p_script->native = GDScriptLanguage::get_singleton()->get_global_array()[native->value];
+	p_script->base = Ref<GDScript>(_load_value(p_reader));
+	if (p_script->native.is_null()) {
+		return ERR_FILE_CORRUPT;
+	}
+
+	int member_count = p_reader.get_count();
+	for (int i = 0; i < member_count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_name();
+		p_script->member_indices[name] = _load_member_info(p_reader);
+	}
+	int own_member_count = p_reader.get_count();
+	for (int i = 0; i < own_member_count && !p_reader.failed; i++) {
+		p_script->members.insert(p_reader.get_name());
+	}
+	int static_count = p_reader.get_count();
+	for (int i = 0; i < static_count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_name();
+		p_script->static_variables_indices[name] = _load_member_info(p_reader);
+	}
+	p_script->static_variables.resize(p_script->static_variables_indices.size());
+
+	int constant_count = p_reader.get_count();
+	for (int i = 0; i < constant_count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_name();
+		p_script->constants.insert(name, _load_value(p_reader));
+	}
+	int signal_count = p_reader.get_count();
+	for (int i = 0; i < signal_count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_name();
+		p_script->_signals[name] = _load_method_info(p_reader);
+	}
+	p_script->rpc_config = _load_value(p_reader);
+
+	if (p_reader.failed) {
+		return ERR_FILE_CORRUPT;
+	}
+
+	int function_count = p_reader.get_count();
+	for (int i = 0; i < function_count && !p_reader.failed; i++) {
+		GDScriptFunction *function = _load_function(p_reader, p_script);
+		if (function == nullptr) {
+			return ERR_FILE_CORRUPT;
+		}
+		p_script->member_functions[function->name] = function;
+		if (function->name == GDScriptLanguage::get_singleton()->strings._init) {
+			p_script->initializer = function;
+		}
+	}
+
+	GDScriptFunction **special_functions[] = { &p_script->implicit_initializer, &p_script->implicit_ready, &p_script->static_initializer };
+	for (GDScriptFunction **special_function : special_functions) {
+		if (p_reader.get_bool()) {
+			*special_function = _load_function(p_reader, p_script);
+			if (*special_function == nullptr) {
+				return ERR_FILE_CORRUPT;
+			}
+		}
+	}
+
+	int subclass_count = p_reader.get_count();
+	for (int i = 0; i < subclass_count && !p_reader.failed; i++) {
+		HashMap<StringName, Ref<GDScript>>::Iterator E = p_script->subclasses.find(p_reader.get_name());
+		if (!E) {
+			return ERR_FILE_CORRUPT;
+		}
+		Error err = _load_class(p_reader, E->value.ptr());
+		if (err) {
+			return err;
+		}
+	}
+
+	if (p_reader.failed) {
+		return ERR_FILE_CORRUPT;
+	}
+
+	p_script->_static_default_init();
+
+	p_script->valid = true;
+	GDScriptInlineCache::invalidate();
+	return OK;
+}
+
+Error GDScriptBytecodeCache::make_scripts(GDScript *p_script) {
+	Reader reader(p_script->bytecode_cache, p_script);
+	if (!_read_header(reader, false, 0)) {
+		return ERR_FILE_CORRUPT;
+	}
+	reader.get_bool(); // Static data.
+	return _make_scripts(reader, p_script);
+}
+
+Error GDScriptBytecodeCache::load(GDScript *p_script) {
+	Reader reader(p_script->bytecode_cache, p_script);
+	if (!_read_header(reader, false, 0)) {
+		return ERR_FILE_CORRUPT;
+	}
+	bool keep_static = reader.get_bool();
+
+	Error err = _make_scripts(reader, p_script);
+	if (err) {
+		return err;
+	}
+	p_script->_owner = nullptr;
+
+	err = _load_class(reader, p_script);
+	if (err) {
+		return err;
+	}
+
+	// No instance survived, so lambdas from the previous version can't be replaced.
+	p_script->_recurse_replace_function_ptrs(HashMap<GDScriptFunction *, GDScriptFunction *>());
+
+	if (keep_static) {
+		GDScriptCache::add_static_script(p_script);
+	}
+
+	return GDScriptCache::finish_compiling(p_script->path);
+}
+
+#ifdef TOOLS_ENABLED
+void GDScriptBytecodeCache::_write_property_info(Writer &p_writer, const PropertyInfo &p_info) {
+	p_writer.put_32(p_info.type);
+	p_writer.put_string(p_info.name);
+	p_writer.put_string(p_info.class_name);
+	p_writer.put_32(p_info.hint);
+	p_writer.put_string(p_info.hint_string);
+	p_writer.put_32(p_info.usage);
+}
+
+void GDScriptBytecodeCache::_write_method_info(Writer &p_writer, const MethodInfo &p_info) {
+	p_writer.put_string(p_info.name);
+	_write_property_info(p_writer, p_info.return_val);
+	p_writer.put_32(p_info.flags);
+	p_writer.put_32(p_info.id);
+	p_writer.put_32(p_info.arguments.size());
+	for (const PropertyInfo &argument : p_info.arguments) {
+		_write_property_info(p_writer, argument);
+	}
+	p_writer.put_32(p_info.default_arguments.size());
+	for (const Variant &value : p_info.default_arguments) {
+		_write_value(p_writer, value);
+	}
+	p_writer.put_32(p_info.return_val_metadata);
+	p_writer.put_32(p_info.arguments_metadata.size());
+	for (int metadata : p_info.arguments_metadata) {
+		p_writer.put_32(metadata);
+	}
+}
+
+void GDScriptBytecodeCache::_write_script(Writer &p_writer, const Script *p_script) {
+	const GDScript *gdscript = Object::cast_to<GDScript>(p_script);
+	if (gdscript == nullptr) {
+		const String &path = p_script->get_path();
+		if (!path.is_resource_file()) {
+			p_writer.fail(vformat(R"(Script "%s" is not a file.)", path));
+			return;
+		}
+		p_writer.put_32(VALUE_RESOURCE);
+		p_writer.put_string(path);
+		return;
+	}
+
+	if (gdscript->path == p_writer.root->path) {
+		p_writer.put_32(VALUE_LOCAL_CLASS);
+		p_writer.put_string(gdscript->fully_qualified_name.trim_prefix(p_writer.root->fully_qualified_name));
+		return;
+	}
+
+	if (!gdscript->path.is_resource_file()) {
+		p_writer.fail(vformat(R"(Class "%s" is not in a script file.)", gdscript->fully_qualified_name));
+		return;
+	}
+	p_writer.dependencies.insert(gdscript->path);
+	p_writer.put_32(VALUE_SCRIPT);
+	p_writer.put_string(gdscript->path);
+	p_writer.put_string(gdscript->fully_qualified_name);
+}
+
+void GDScriptBytecodeCache::_write_value(Writer &p_writer, const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			Object *object = p_value.get_validated_object();
+			if (object == nullptr) {
+				p_writer.put_32(VALUE_NULL_OBJECT);
+			} else if (GDScriptNativeClass *native = Object::cast_to<GDScriptNativeClass>(object)) {
+				p_writer.put_32(VALUE_NATIVE_CLASS);
+				p_writer.put_string(native->get_name());
+			} else if (Script *script = Object::cast_to<Script>(object)) {
+				_write_script(p_writer, script);
+			} else if (Resource *resource = Object::cast_to<Resource>(object)) {
+				if (!resource->get_path().is_resource_file()) {
+					p_writer.fail(vformat(R"(Constant resource "%s" is not a file.)", resource->get_path()));
+					return;
+				}
+				p_writer.put_32(VALUE_RESOURCE);
+				p_writer.put_string(resource->get_path());
+			} else {
+				p_writer.fail(vformat(R"(Can't store constant object of class "%s".)", object->get_class()));
+			}
+		} break;
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			p_writer.put_32(VALUE_ARRAY);
+			p_writer.put_32(array.get_typed_builtin());
+			p_writer.put_string(array.get_typed_class_name());
+			_write_value(p_writer, array.get_typed_script());
+			p_writer.put_bool(array.is_read_only());
+			p_writer.put_32(array.size());
+			for (const Variant &element : array) {
+				_write_value(p_writer, element);
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary dictionary = p_value;
+			p_writer.put_32(VALUE_DICTIONARY);
+			p_writer.put_32(dictionary.get_typed_key_builtin());
+			p_writer.put_string(dictionary.get_typed_key_class_name());
+			_write_value(p_writer, dictionary.get_typed_key_script());
+			p_writer.put_32(dictionary.get_typed_value_builtin());
+			p_writer.put_string(dictionary.get_typed_value_class_name());
+			_write_value(p_writer, dictionary.get_typed_value_script());
+			p_writer.put_bool(dictionary.is_read_only());
+			p_writer.put_32(dictionary.size());
+			for (const KeyValue<Variant, Variant> &kv : dictionary) {
+				_write_value(p_writer, kv.key);
+				_write_value(p_writer, kv.value);
+			}
+		} break;
+		case Variant::CALLABLE:
+		case Variant::SIGNAL:
+		case Variant::RID: {
+			p_writer.fail(vformat(R"(Can't store constant of type "%s".)", Variant::get_type_name(p_value.get_type())));
+		} break;
+		default: {
+			p_writer.put_32(VALUE_VARIANT);
+			p_writer.put_variant(p_value);
+		} break;
+	}
+}
+
+void GDScriptBytecodeCache::_write_data_type(Writer &p_writer, const GDScriptDataType &p_type) {
+	p_writer.put_32(p_type.kind);
+	p_writer.put_32(p_type.builtin_type);
+	p_writer.put_string(p_type.native_type);
+	if (p_type.script_type != nullptr) {
+		_write_script(p_writer, p_type.script_type);
+	} else {
+		_write_value(p_writer, Variant());
+	}
+	p_writer.put_32(p_type.container_element_types.size());
+	for (const GDScriptDataType &element_type : p_type.container_element_types) {
+		_write_data_type(p_writer, element_type);
+	}
+}
+
+void GDScriptBytecodeCache::_write_member_info(Writer &p_writer, const GDScript::MemberInfo &p_info) {
+	p_writer.put_32(p_info.index);
+	p_writer.put_string(p_info.setter);
+	p_writer.put_string(p_info.getter);
+	_write_data_type(p_writer, p_info.data_type);
+	_write_property_info(p_writer, p_info.property_info);
+}
+
+void GDScriptBytecodeCache::_write_function(Writer &p_writer, const GDScriptFunction *p_function) {
+	p_writer.put_string(p_function->name);
+	p_writer.put_bool(p_function->_static);
+	p_writer.put_32(p_function->_initial_line);
+	p_writer.put_32(p_function->_argument_count);
+	p_writer.put_32(p_function->_vararg_index);
+	p_writer.put_32(p_function->_stack_size);
+	p_writer.put_32(p_function->_instruction_args_size);
+
+	p_writer.put_32(p_function->argument_types.size());
+	for (const GDScriptDataType &type : p_function->argument_types) {
+		_write_data_type(p_writer, type);
+	}
+	_write_data_type(p_writer, p_function->return_type);
+	_write_method_info(p_writer, p_function->method_info);
+	_write_value(p_writer, p_function->rpc_config);
+
+	p_writer.put_32(p_function->temporary_slots.size());
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		p_writer.put_32(E.key);
+		p_writer.put_32(E.value);
+	}
+
+	// Clear the operator caches, which hold types and function pointers of this run.
+	Vector<int> code = p_function->code;
+	constexpr int pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(int);
+	for (int position : p_function->operator_cache_positions) {
+		for (int i = 0; i < 2 + pointer_size; i++) {
+			code.write[position + i] = 0;
+		}
+	}
+	p_writer.put_32(code.size());
+	for (int value : code) {
+		p_writer.put_32(value);
+	}
+	p_writer.put_32(p_function->_inline_caches_count);
+
+	p_writer.put_32(p_function->global_index_positions.size());
+	for (int position : p_function->global_index_positions) {
+		const StringName *global = p_writer.global_names.getptr(code[position]);
+		if (global == nullptr) {
+			p_writer.fail("Unknown global.");
+			return;
+		}
+		p_writer.put_32(position);
+		p_writer.put_string(*global);
+	}
+
+	p_writer.put_32(p_function->default_arguments.size());
+	for (int position : p_function->default_arguments) {
+		p_writer.put_32(position);
+	}
+
+	p_writer.put_32(p_function->constants.size());
+	for (const Variant &constant : p_function->constants) {
+		_write_value(p_writer, constant);
+	}
+	p_writer.put_32(p_function->constant_map.size());
+	for (const KeyValue<StringName, Variant> &E : p_function->constant_map) {
+		p_writer.put_string(E.key);
+		_write_value(p_writer, E.value);
+	}
+
+	p_writer.put_32(p_function->global_names.size());
+	for (const StringName &name : p_function->global_names) {
+		p_writer.put_string(name);
+	}
+
+	p_writer.put_bindings(p_function->operator_funcs, _get_operator_bindings(), "operator");
+	p_writer.put_bindings(p_function->setters, _get_setter_bindings(), "setter");
+	p_writer.put_bindings(p_function->getters, _get_getter_bindings(), "getter");
+	p_writer.put_bindings(p_function->keyed_setters, _get_keyed_setter_bindings(), "keyed setter");
+	p_writer.put_bindings(p_function->keyed_getters, _get_keyed_getter_bindings(), "keyed getter");
+	p_writer.put_bindings(p_function->indexed_setters, _get_indexed_setter_bindings(), "indexed setter");
+	p_writer.put_bindings(p_function->indexed_getters, _get_indexed_getter_bindings(), "indexed getter");
+	p_writer.put_bindings(p_function->builtin_methods, _get_builtin_method_bindings(), "builtin method");
+	p_writer.put_bindings(p_function->constructors, _get_constructor_bindings(), "constructor");
+	p_writer.put_bindings(p_function->utilities, _get_utility_bindings(), "utility function");
+	p_writer.put_bindings(p_function->gds_utilities, _get_gds_utility_bindings(), "GDScript utility function");
+
+	p_writer.put_32(p_function->methods.size());
+	for (const MethodBind *method : p_function->methods) {
+		p_writer.put_string(method->get_instance_class());
+		p_writer.put_string(method->get_name());
+	}
+
+	p_writer.put_32(p_function->lambdas.size());
+	for (const GDScriptFunction *lambda : p_function->lambdas) {
+		const GDScript::LambdaInfo *info = lambda->_script->lambda_info.getptr(const_cast<GDScriptFunction *>(lambda));
+		p_writer.put_32(info ? info->capture_count : 0);
+		p_writer.put_bool(info ? info->use_self : false);
+		_write_function(p_writer, lambda);
+	}
+
+	if (p_writer.debug) {
+		p_writer.put_names(p_function->operator_names);
+		p_writer.put_names(p_function->setter_names);
+		p_writer.put_names(p_function->getter_names);
+		p_writer.put_names(p_function->builtin_methods_names);
+		p_writer.put_names(p_function->constructors_names);
+		p_writer.put_names(p_function->utilities_names);
+		p_writer.put_names(p_function->gds_utilities_names);
+	}
+}
+
+void GDScriptBytecodeCache::_write_scripts(Writer &p_writer, const GDScript *p_script) {
+	p_writer.put_string(p_script->fully_qualified_name);
+	p_writer.put_string(p_script->local_name);
+	p_writer.put_string(p_script->global_name);
+	p_writer.put_string(p_script->simplified_icon_path);
+
+	p_writer.put_32(p_script->subclasses.size());
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		p_writer.put_string(E.key);
+		p_writer.put_string(E.value->fully_qualified_name);
+		_write_scripts(p_writer, E.value.ptr());
+	}
+}
+
+void GDScriptBytecodeCache::_write_class(Writer &p_writer, const GDScript *p_script) {
+	p_writer.put_bool(p_script->tool);
+	p_writer.put_bool(p_script->_is_abstract);
+	p_writer.put_string(p_script->native.is_valid() ? p_script->native->get_name() : StringName());
+	_write_value(p_writer, p_script->base);
+
+	// Member indices include the ones of the base classes, which must not change either.
+	for (const GDScript *base = p_script->base.ptr(); base != nullptr; base = base->base.ptr()) {
+		if (base->path != p_writer.root->path) {
+			p_writer.dependencies.insert(base->path);
+		}
+	}
+
+	p_writer.put_32(p_script->member_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->member_indices) {
+		p_writer.put_string(E.key);
+		_write_member_info(p_writer, E.value);
+	}
+	p_writer.put_32(p_script->members.size());
+	for (const StringName &member : p_script->members) {
+		p_writer.put_string(member);
+	}
+	p_writer.put_32(p_script->static_variables_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->static_variables_indices) {
+		p_writer.put_string(E.key);
+		_write_member_info(p_writer, E.value);
+	}
+
+	p_writer.put_32(p_script->constants.size());
+	for (const KeyValue<StringName, Variant> &E : p_script->constants) {
+		p_writer.put_string(E.key);
+		_write_value(p_writer, E.value);
+	}
+	p_writer.put_32(p_script->_signals.size());
+	for (const KeyValue<StringName, MethodInfo> &E : p_script->_signals) {
+		p_writer.put_string(E.key);
+		_write_method_info(p_writer, E.value);
+	}
+	_write_value(p_writer, p_script->rpc_config);
+
+	p_writer.put_32(p_script->member_functions.size());
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+		_write_function(p_writer, E.value);
+	}
+
+	const GDScriptFunction *special_functions[] = { p_script->implicit_initializer, p_script->implicit_ready, p_script->static_initializer };
+	for (const GDScriptFunction *special_function : special_functions) {
+		p_writer.put_bool(special_function != nullptr);
+		if (special_function != nullptr) {
+			_write_function(p_writer, special_function);
+		}
+	}
+
+	p_writer.put_32(p_script->subclasses.size());
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		p_writer.put_string(E.key);
+		_write_class(p_writer, E.value.ptr());
+	}
+}
+
+void GDScriptBytecodeCache::_clear_detached(GDScript *p_script) {
+	// Release everything referencing the inner classes first, so they are freed instead of
+	// being kept as orphans when the root script is cleared.
+	for (KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		_clear_detached(E.value.ptr());
+	}
+	_reset_class(p_script);
+	if (p_script->is_root_script()) {
+		p_script->clear();
+	}
+}
+
+Vector<uint8_t> GDScriptBytecodeCache::compile(const String &p_path, const String &p_source, const Vector<uint8_t> &p_binary_tokens, GDScriptTokenizerBuffer::CompressMode p_compress_mode, bool p_debug) {
+	GDScriptParser parser;
+	Error err = parser.parse(p_source, p_path, false);
+	if (err == OK) {
+		GDScriptAnalyzer analyzer(&parser);
+		err = analyzer.analyze();
+	}
+	if (err) {
+		print_verbose(vformat(R"(GDScript: Can't compile "%s" to bytecode, it has errors.)", p_path));
+		return Vector<uint8_t>();
+	}
+
+	Ref<GDScript> script;
+	script.instantiate();
+	script->path = p_path;
+	script->path_valid = true;
+
+	GDScriptCompiler compiler;
+	err = compiler.compile_detached(&parser, script.ptr(), p_debug);
+
+	Writer body(script.ptr(), p_debug);
+	if (err) {
+		body.fail(compiler.get_error());
+	} else {
+		body.put_bool(_has_static_data(parser.get_tree()) && !parser.get_tree()->annotated_static_unload);
+		_write_scripts(body, script.ptr());
+		_write_class(body, script.ptr());
+	}
+
+	_clear_detached(script.ptr());
+
+	Writer writer(nullptr, p_debug);
+	writer.put_data(reinterpret_cast<const uint8_t *>("GDBC"), 4);
+	writer.put_32(FORMAT_VERSION);
+	writer.put_32((sizeof(void *) << BUILD_POINTER_SIZE_SHIFT) | (p_debug ? BUILD_DEBUG : 0) | (_get_build_flags() & BUILD_REAL_T_IS_DOUBLE));
+	writer.put_32(hash_djb2_buffer(p_binary_tokens.ptr(), p_binary_tokens.size()));
+	writer.put_string(_get_engine_build());
+
+	writer.put_32(body.dependencies.size());
+	for (const String &dependency : body.dependencies) {
+		Vector<uint8_t> tokens = GDScriptTokenizerBuffer::parse_code_string(FileAccess::get_file_as_string(dependency), p_compress_mode);
+		if (tokens.is_empty()) {
+			body.fail(vformat(R"(Can't read dependency "%s".)", dependency));
+			break;
+		}
+		writer.put_string(dependency);
+		writer.put_32(hash_djb2_buffer(tokens.ptr(), tokens.size()));
+	}
+
+	if (body.has_failed()) {
+		print_verbose(vformat(R"(GDScript: Can't compile "%s" to bytecode: %s)", p_path, body.error));
+		return Vector<uint8_t>();
+	}
+
+	writer.put_data(body.buffer.ptr(), body.buffer.size());
+	return writer.buffer;
+}
+#endif // TOOLS_ENABLED
@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "gdscript.h"
+#include "gdscript_tokenizer_buffer.h"
+
+// Compiled bytecode of a script and its inner classes.
+//
+// Exported projects can ship it next to the binary tokens of each script (as `.gdbc`),
+// so loading the script restores its members and functions directly instead of going
+// through the parser, analyzer and compiler. A cache made by another engine build, for
+// different tokens, or against a base class that changed since, is ignored, and the
+// script is compiled from its tokens as usual.
+class GDScriptBytecodeCache {
+	class Writer;
+	class Reader;
+
+	enum ValueTag {
+		VALUE_VARIANT,
+		VALUE_NULL_OBJECT,
+		VALUE_ARRAY,
+		VALUE_DICTIONARY,
+		VALUE_LOCAL_CLASS, // Class in the same file as the cached script.
+		VALUE_SCRIPT, // Class in another GDScript file.
+		VALUE_NATIVE_CLASS,
+		VALUE_RESOURCE,
+	};
+
+	enum BuildFlags {
+		BUILD_DEBUG = 1 << 0,
+		BUILD_REAL_T_IS_DOUBLE = 1 << 1,
+		BUILD_POINTER_SIZE_SHIFT = 8,
+	};
+
+	static uint32_t _get_build_flags();
+	static String _get_engine_build();
+	static bool _read_header(Reader &p_reader, bool p_verify, uint32_t p_tokens_hash);
+
+	static PropertyInfo _load_property_info(Reader &p_reader);
+	static MethodInfo _load_method_info(Reader &p_reader);
+	static Variant _load_value(Reader &p_reader);
+	static GDScriptDataType _load_data_type(Reader &p_reader);
+	static GDScript::MemberInfo _load_member_info(Reader &p_reader);
+	static GDScriptFunction *_load_function(Reader &p_reader, GDScript *p_script);
+	static Error _make_scripts(Reader &p_reader, GDScript *p_script);
+	static void _reset_class(GDScript *p_script);
+	static Error _load_class(Reader &p_reader, GDScript *p_script);
+
+#ifdef TOOLS_ENABLED
+	static void _write_property_info(Writer &p_writer, const PropertyInfo &p_info);
+	static void _write_method_info(Writer &p_writer, const MethodInfo &p_info);
+	static void _write_script(Writer &p_writer, const Script *p_script);
+	static void _write_value(Writer &p_writer, const Variant &p_value);
+	static void _write_data_type(Writer &p_writer, const GDScriptDataType &p_type);
+	static void _write_member_info(Writer &p_writer, const GDScript::MemberInfo &p_info);
+	static void _write_function(Writer &p_writer, const GDScriptFunction *p_function);
+	static void _write_scripts(Writer &p_writer, const GDScript *p_script);
+	static void _write_class(Writer &p_writer, const GDScript *p_script);
+	static void _clear_detached(GDScript *p_script);
+#endif
+
+public:
+	static constexpr uint32_t FORMAT_VERSION = 3;
+
+	static String get_cache_path(const String &p_binary_tokens_path);
+	// Returns the cache stored next to the binary tokens of a script, or an empty buffer if there is none or it can't be used.
+	static Vector<uint8_t> load_cache(const String &p_binary_tokens_path, const Vector<uint8_t> &p_binary_tokens);
+
+	// Creates the inner class scripts of a script with a cache, like `GDScriptCompiler::make_scripts()`.
+	static Error make_scripts(GDScript *p_script);
+	// Restores the compiled script from its cache, in place of `GDScriptCompiler::compile()`.
+	static Error load(GDScript *p_script);
+
+#ifdef TOOLS_ENABLED
+	// Compiles a script without registering it in the script cache, and returns its serialized bytecode.
+	// Returns an empty buffer if the script can't be compiled or holds constants that can't be stored.
+	static Vector<uint8_t> compile(const String &p_path, const String &p_source, const Vector<uint8_t> &p_binary_tokens, GDScriptTokenizerBuffer::CompressMode p_compress_mode, bool p_debug);
+#endif
+};
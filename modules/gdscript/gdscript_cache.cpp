@@ -32,6 +32,7 @@
 
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 
@@ -296,9 +297,26 @@ Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
 	uint64_t read = f->get_buffer(buffer.ptrw(), buffer.size());
 	ERR_FAIL_COND_V_MSG(read != len, Vector<uint8_t>(), "Failed to read binary GDScript file '" + p_path + "'.");
 
+	MutexLock lock(singleton->mutex);
+	singleton->binary_tokens_hashes[p_path] = hash_djb2_buffer(buffer.ptr(), buffer.size());
+
 	return buffer;
 }
 
+bool GDScriptCache::get_binary_tokens_hash(const String &p_path, uint32_t &r_hash) {
+	MutexLock lock(singleton->mutex);
+
+	HashMap<String, uint32_t>::ConstIterator E = singleton->binary_tokens_hashes.find(p_path);
+	if (!E) {
+		if (get_binary_tokens(p_path).is_empty()) {
+			return false;
+		}
+		E = singleton->binary_tokens_hashes.find(p_path);
+	}
+	r_hash = E->value;
+	return true;
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
 	MutexLock lock(singleton->mutex);
 
@@ -324,6 +342,7 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 			r_error = ERR_FILE_CANT_READ;
 		}
 		script->set_binary_tokens_source(buffer);
+		script->set_bytecode_cache(GDScriptBytecodeCache::load_cache(remapped_path, buffer));
 	} else {
 		r_error = script->load_source_code(remapped_path);
 	}
@@ -332,9 +351,15 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 		return Ref<GDScript>(); // Returns null and does not cache when the script fails to load.
 	}
 
-	Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
-	if (r_error == OK) {
-		GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
+	if (!script->get_bytecode_cache().is_empty() && GDScriptBytecodeCache::make_scripts(script.ptr()) != OK) {
+		script->set_bytecode_cache(Vector<uint8_t>());
+	}
+
+	if (script->get_bytecode_cache().is_empty()) {
+		Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
+		if (r_error == OK) {
+			GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
+		}
 	}
 
 	singleton->shallow_gdscript_cache[p_path] = script;
@@ -376,6 +401,7 @@ Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_erro
 				goto finish;
 			}
 			script->set_binary_tokens_source(buffer);
+			script->set_bytecode_cache(GDScriptBytecodeCache::load_cache(remapped_path, buffer));
 		} else {
 			r_error = script->load_source_code(remapped_path);
 			if (r_error) {
@@ -468,6 +494,7 @@ void GDScriptCache::clear() {
 	singleton->cleared = true;
 
 	singleton->parser_inverse_dependencies.clear();
+	singleton->binary_tokens_hashes.clear();
 
 	for (const KeyValue<String, Vector<ObjectID>> &KV : singleton->abandoned_parser_map) {
 		for (ObjectID parser_ref_id : KV.value) {
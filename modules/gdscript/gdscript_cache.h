@@ -91,6 +91,8 @@ class GDScriptCache {
 	HashMap<String, Ref<GDScript>> static_gdscript_cache;
 	HashMap<String, HashSet<String>> dependencies;
 	HashMap<String, HashSet<String>> parser_inverse_dependencies;
+	// Hashes of the binary token files read so far, used to validate bytecode caches.
+	HashMap<String, uint32_t> binary_tokens_hashes;
 
 	friend class GDScript;
 	friend class GDScriptParserRef;
@@ -116,6 +118,8 @@ public:
 	static void remove_parser(const String &p_path);
 	static String get_source_code(const String &p_path);
 	static Vector<uint8_t> get_binary_tokens(const String &p_path);
+	// Returns the hash of a binary token file, reading it only if it wasn't read before.
+	static bool get_binary_tokens_hash(const String &p_path, uint32_t &r_hash);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	/**
 	 * Returns a fully loaded GDScript using an already cached script if one exists.
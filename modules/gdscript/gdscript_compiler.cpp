@@ -2181,6 +2181,10 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::ASSERT: {
 #ifdef DEBUG_ENABLED
+				if (!debug_code) {
+					break;
+				}
+
 				const GDScriptParser::AssertNode *as = static_cast<const GDScriptParser::AssertNode *>(s);
 
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, as->condition);
@@ -2208,7 +2212,9 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::BREAKPOINT: {
 #ifdef DEBUG_ENABLED
-				gen->write_breakpoint();
+				if (debug_code) {
+					gen->write_breakpoint();
+				}
 #endif
 			} break;
 			case GDScriptParser::Node::VARIABLE: {
@@ -3137,6 +3143,7 @@ Error GDScriptCompiler::_compile_class(GDScript *p_script, const GDScriptParser:
 	p_script->_static_default_init();
 
 	p_script->valid = true;
+	GDScriptInlineCache::invalidate();
 	return OK;
 }
 
@@ -3154,7 +3161,7 @@ void GDScriptCompiler::convert_to_initializer_type(Variant &p_variant, const GDS
 	}
 }
 
-void GDScriptCompiler::make_scripts(GDScript *p_script, const GDScriptParser::ClassNode *p_class, bool p_keep_state) {
+void GDScriptCompiler::make_scripts(GDScript *p_script, const GDScriptParser::ClassNode *p_class, bool p_keep_state, bool p_reuse_orphans) {
 	p_script->fully_qualified_name = p_class->fqcn;
 	p_script->local_name = p_class->identifier ? p_class->identifier->name : StringName();
 	p_script->global_name = p_class->get_global_name();
@@ -3179,7 +3186,7 @@ void GDScriptCompiler::make_scripts(GDScript *p_script, const GDScriptParser::Cl
 
 		if (old_subclasses.has(name)) {
 			subclass = old_subclasses[name];
-		} else {
+		} else if (p_reuse_orphans) {
 			subclass = GDScriptLanguage::get_singleton()->get_orphan_subclass(inner_class->fqcn);
 		}
 
@@ -3191,7 +3198,7 @@ void GDScriptCompiler::make_scripts(GDScript *p_script, const GDScriptParser::Cl
 		subclass->path = p_script->path;
 		p_script->subclasses.insert(name, subclass);
 
-		make_scripts(subclass.ptr(), inner_class, p_keep_state);
+		make_scripts(subclass.ptr(), inner_class, p_keep_state, p_reuse_orphans);
 	}
 }
 
@@ -3334,7 +3341,7 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	ScriptLambdaInfo old_lambda_info = _get_script_lambda_replacement_info(p_script);
 
 	// Create scripts for subclasses beforehand so they can be referenced
-	make_scripts(p_script, root, p_keep_state);
+	make_scripts(p_script, root, p_keep_state, !detached);
 
 	main_script->_owner = nullptr;
 	Error err = _prepare_compilation(main_script, parser->get_tree(), p_keep_state);
@@ -3354,6 +3361,10 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	_get_function_ptr_replacements(func_ptr_replacements, old_lambda_info, &new_lambda_info);
 	main_script->_recurse_replace_function_ptrs(func_ptr_replacements);
 
+	if (detached) {
+		return OK;
+	}
+
 	if (has_static_data && !root->annotated_static_unload) {
 		GDScriptCache::add_static_script(p_script);
 	}
@@ -3365,6 +3376,12 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	return err;
 }
 
+Error GDScriptCompiler::compile_detached(const GDScriptParser *p_parser, GDScript *p_script, bool p_debug) {
+	detached = true;
+	debug_code = p_debug;
+	return compile(p_parser, p_script);
+}
+
 String GDScriptCompiler::get_error() const {
 	return error;
 }
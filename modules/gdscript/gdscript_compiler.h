@@ -172,11 +172,16 @@ class GDScriptCompiler {
 	String error;
 	GDScriptParser::ExpressionNode *awaited_node = nullptr;
 	bool has_static_data = false;
+	bool detached = false; // Compiling a standalone copy, which isn't registered in the script cache.
+	bool debug_code = true; // Assertions and breakpoints, only generated in debug builds.
 
 public:
 	static void convert_to_initializer_type(Variant &p_variant, const GDScriptParser::VariableNode *p_node);
-	static void make_scripts(GDScript *p_script, const GDScriptParser::ClassNode *p_class, bool p_keep_state);
+	static void make_scripts(GDScript *p_script, const GDScriptParser::ClassNode *p_class, bool p_keep_state, bool p_reuse_orphans = true);
 	Error compile(const GDScriptParser *p_parser, GDScript *p_script, bool p_keep_state = false);
+	// Compiles a standalone copy of a script, used to build bytecode caches on export.
+	// Debug-only code is left out when `p_debug` is `false`, as release builds would do.
+	Error compile_detached(const GDScriptParser *p_parser, GDScript *p_script, bool p_debug);
 
 	String get_error() const;
 	int get_error_line() const;
@@ -142,6 +142,53 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			case OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT: {
+				text += "validated operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 4]];
+				text += " ";
+				text += DADDR(2);
+				text += ", jump-if-not to ";
+				text += itos(_code_ptr[ip + 5]);
+
+				incr += 6;
+			} break;
+			case OPCODE_OPERATOR_INT:
+			case OPCODE_OPERATOR_FLOAT:
+			case OPCODE_OPERATOR_VECTOR2:
+			case OPCODE_OPERATOR_VECTOR3: {
+				text += "typed operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += Variant::get_operator_name(Variant::Operator(_code_ptr[ip + 4]));
+				text += " ";
+				text += DADDR(2);
+
+				incr += 5;
+			} break;
+			case OPCODE_OPERATOR_INT_JUMP_IF_NOT:
+			case OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT: {
+				text += "typed operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += Variant::get_operator_name(Variant::Operator(_code_ptr[ip + 4]));
+				text += " ";
+				text += DADDR(2);
+				text += ", jump-if-not to ";
+				text += itos(_code_ptr[ip + 5]);
+
+				incr += 6;
+			} break;
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -309,7 +356,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
@@ -330,7 +377,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -352,13 +399,17 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 3;
 			} break;
-			case OPCODE_GET_MEMBER: {
+			case OPCODE_GET_MEMBER:
+			case OPCODE_GET_MEMBER_OPERATOR_VALIDATED: {
 				text += "get_member ";
 				text += DADDR(1);
 				text += " = ";
 				text += "[\"";
 				text += _global_names_ptr[_code_ptr[ip + 2]];
 				text += "\"]";
+				if (opcode == OPCODE_GET_MEMBER_OPERATOR_VALIDATED) {
+					text += ", fused with the next operator";
+				}
 
 				incr += 3;
 			} break;
@@ -709,7 +760,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
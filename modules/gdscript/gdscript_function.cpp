@@ -34,6 +34,8 @@
 
 #include "core/object/class_db.h"
 
+SafeNumeric<uint32_t> GDScriptInlineCache::epoch(1);
+
 bool GDScriptDataType::is_type(const Variant &p_variant, bool p_allow_implicit_conversion) const {
 	switch (kind) {
 		case VARIANT: {
@@ -240,6 +242,10 @@ GDScriptFunction::~GDScriptFunction() {
 		memdelete(lambdas[i]);
 	}
 
+	if (_inline_caches_ptr) {
+		memdelete_arr(_inline_caches_ptr);
+	}
+
 	for (int i = 0; i < argument_types.size(); i++) {
 		argument_types.write[i].script_type_ref = Ref<Script>();
 	}
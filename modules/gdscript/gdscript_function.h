@@ -42,6 +42,7 @@
 
 class GDScriptInstance;
 class GDScript;
+class GDScriptFunction;
 
 class GDScriptDataType {
 public:
@@ -147,11 +148,105 @@ public:
 	~GDScriptDataType() {}
 };
 
+// Per-instruction cache for named access and method calls on untyped values,
+// keyed on the receiver's script and native type.
+// Any script reload or release starts a new epoch, which outdates every slot.
+// Slots are only rewritten once outdated, under a lock. The VM reads them without
+// locking, as a seqlock: it copies a slot and drops the copy if the slot was
+// rewritten meanwhile, so it never combines the fields of two different fills.
+struct GDScriptInlineCache {
+	enum Kind {
+		KIND_GENERIC, // Not cacheable, always take the regular path.
+		KIND_MEMBER, // Script member without getter or setter.
+		KIND_FUNCTION, // Script function, found in the receiver's script or its bases.
+		KIND_METHOD_BIND, // Native method not overridden by the receiver's script.
+	};
+
+	struct Entry {
+		Kind kind = KIND_GENERIC;
+		int member_index = -1;
+		const GDScriptDataType *member_type = nullptr;
+		GDScriptFunction *function = nullptr;
+		MethodBind *method = nullptr;
+	};
+
+	struct Slot {
+		std::atomic<uint32_t> epoch = 0; // 0 while the slot is being written.
+		std::atomic<const void *> script = nullptr;
+		std::atomic<const void *> native = nullptr;
+		std::atomic<Kind> kind = KIND_GENERIC;
+		std::atomic<int> member_index = -1;
+		std::atomic<const GDScriptDataType *> member_type = nullptr;
+		std::atomic<GDScriptFunction *> function = nullptr;
+		std::atomic<MethodBind *> method = nullptr;
+
+		void write(uint32_t p_epoch, const void *p_script, const void *p_native, const Entry &p_entry) {
+			epoch.store(0, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			script.store(p_script, std::memory_order_relaxed);
+			native.store(p_native, std::memory_order_relaxed);
+			kind.store(p_entry.kind, std::memory_order_relaxed);
+			member_index.store(p_entry.member_index, std::memory_order_relaxed);
+			member_type.store(p_entry.member_type, std::memory_order_relaxed);
+			function.store(p_entry.function, std::memory_order_relaxed);
+			method.store(p_entry.method, std::memory_order_relaxed);
+			epoch.store(p_epoch, std::memory_order_release);
+		}
+
+		// Fails if the slot doesn't match, or was rewritten while being copied.
+		_FORCE_INLINE_ bool read(uint32_t p_epoch, const void *p_script, const void *p_native, Entry &r_entry) const {
+			if (epoch.load(std::memory_order_acquire) != p_epoch || script.load(std::memory_order_relaxed) != p_script || native.load(std::memory_order_relaxed) != p_native) {
+				return false;
+			}
+			r_entry.kind = kind.load(std::memory_order_relaxed);
+			r_entry.member_index = member_index.load(std::memory_order_relaxed);
+			r_entry.member_type = member_type.load(std::memory_order_relaxed);
+			r_entry.function = function.load(std::memory_order_relaxed);
+			r_entry.method = method.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return epoch.load(std::memory_order_relaxed) == p_epoch;
+		}
+	};
+
+	enum Access {
+		ACCESS_GET,
+		ACCESS_SET,
+		ACCESS_CALL,
+	};
+
+	static constexpr int MAX_ENTRIES = 4;
+	Slot slots[MAX_ENTRIES];
+
+	static SafeNumeric<uint32_t> epoch;
+	static void invalidate() {
+		if (unlikely(epoch.increment() == 0)) {
+			epoch.increment(); // 0 marks slots being written.
+		}
+	}
+
+	_FORCE_INLINE_ bool find(const void *p_script, const void *p_native, Entry &r_entry) const {
+		const uint32_t current = epoch.get();
+		for (int i = 0; i < MAX_ENTRIES; i++) {
+			if (slots[i].read(current, p_script, p_native, r_entry)) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
 class GDScriptFunction {
 public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
+		OPCODE_OPERATOR_INT,
+		OPCODE_OPERATOR_INT_JUMP_IF_NOT,
+		OPCODE_OPERATOR_FLOAT,
+		OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT,
+		OPCODE_OPERATOR_VECTOR2,
+		OPCODE_OPERATOR_VECTOR3,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -169,6 +264,7 @@ public:
 		OPCODE_GET_NAMED_VALIDATED,
 		OPCODE_SET_MEMBER,
 		OPCODE_GET_MEMBER,
+		OPCODE_GET_MEMBER_OPERATOR_VALIDATED, // `OPCODE_GET_MEMBER` and the `OPCODE_OPERATOR_VALIDATED` after it.
 		OPCODE_SET_STATIC_VARIABLE, // Only for GDScript.
 		OPCODE_GET_STATIC_VARIABLE, // Only for GDScript.
 		OPCODE_ASSIGN,
@@ -342,6 +438,7 @@ private:
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
+	friend class GDScriptBytecodeCache;
 
 	StringName name;
 	StringName source;
@@ -417,6 +514,15 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	GDScriptInlineCache *_inline_caches_ptr = nullptr;
+	int _inline_caches_count = 0;
+
+#ifdef TOOLS_ENABLED
+	// Code positions holding values that are only valid in the running engine,
+	// which `GDScriptBytecodeCache` rewrites when serializing the function.
+	Vector<int> global_index_positions;
+	Vector<int> operator_cache_positions;
+#endif
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
@@ -455,6 +561,12 @@ private:
 	String _get_callable_call_error(const String &p_where, const Callable &p_callable, const Variant **p_argptrs, int p_argcount, const Variant &p_ret, const Callable::CallError &p_err) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
+	// Inline cache paths, which return `false` when the regular path must be taken.
+	static bool _inline_cache_fill(GDScriptInlineCache &p_cache, Object *p_object, GDScriptInstance *p_instance, const StringName &p_name, GDScriptInlineCache::Access p_access, GDScriptInlineCache::Entry &r_entry);
+	static bool _inline_cache_get(GDScriptInlineCache &p_cache, Object *p_object, const StringName &p_name, Variant &r_ret);
+	static bool _inline_cache_set(GDScriptInlineCache &p_cache, Object *p_object, const StringName &p_name, const Variant &p_value);
+	static bool _inline_cache_call(GDScriptInlineCache &p_cache, Object *p_object, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
 
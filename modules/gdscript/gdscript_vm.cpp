@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/profiling/profiling.h"
+#include "scene/scene_string_names.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -209,6 +210,327 @@ String GDScriptFunction::_get_callable_call_error(const String &p_where, const C
 	}
 }
 
+// Typed operator opcodes work on the unboxed payloads of operands whose types
+// are known at compile time, so the result is written in place without
+// constructing or destroying an intermediate Variant.
+
+template <typename T>
+static _FORCE_INLINE_ void _set_typed_operator_result(Variant *r_dst, const T &p_value) {
+	VariantTypeChanger<T>::change(r_dst);
+	VariantInternalAccessor<T>::set(r_dst, p_value);
+}
+
+static _FORCE_INLINE_ void _evaluate_operator_int(int p_operator, const Variant *p_a, const Variant *p_b, Variant *r_dst) {
+	const int64_t a = *VariantInternal::get_int(p_a);
+	switch (p_operator) {
+		case Variant::OP_NEGATE:
+			_set_typed_operator_result<int64_t>(r_dst, -a);
+			return;
+		case Variant::OP_BIT_NEGATE:
+			_set_typed_operator_result<int64_t>(r_dst, ~a);
+			return;
+		default:
+			break;
+	}
+
+	const int64_t b = *VariantInternal::get_int(p_b);
+	switch (p_operator) {
+		case Variant::OP_ADD:
+			_set_typed_operator_result<int64_t>(r_dst, a + b);
+			break;
+		case Variant::OP_SUBTRACT:
+			_set_typed_operator_result<int64_t>(r_dst, a - b);
+			break;
+		case Variant::OP_MULTIPLY:
+			_set_typed_operator_result<int64_t>(r_dst, a * b);
+			break;
+		case Variant::OP_BIT_AND:
+			_set_typed_operator_result<int64_t>(r_dst, a & b);
+			break;
+		case Variant::OP_BIT_OR:
+			_set_typed_operator_result<int64_t>(r_dst, a | b);
+			break;
+		case Variant::OP_BIT_XOR:
+			_set_typed_operator_result<int64_t>(r_dst, a ^ b);
+			break;
+		case Variant::OP_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a == b);
+			break;
+		case Variant::OP_NOT_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a != b);
+			break;
+		case Variant::OP_LESS:
+			_set_typed_operator_result<bool>(r_dst, a < b);
+			break;
+		case Variant::OP_LESS_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a <= b);
+			break;
+		case Variant::OP_GREATER:
+			_set_typed_operator_result<bool>(r_dst, a > b);
+			break;
+		case Variant::OP_GREATER_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a >= b);
+			break;
+		default:
+			break;
+	}
+}
+
+static _FORCE_INLINE_ void _evaluate_operator_float(int p_operator, const Variant *p_a, const Variant *p_b, Variant *r_dst) {
+	const double a = *VariantInternal::get_float(p_a);
+	if (p_operator == Variant::OP_NEGATE) {
+		_set_typed_operator_result<double>(r_dst, -a);
+		return;
+	}
+
+	const double b = *VariantInternal::get_float(p_b);
+	switch (p_operator) {
+		case Variant::OP_ADD:
+			_set_typed_operator_result<double>(r_dst, a + b);
+			break;
+		case Variant::OP_SUBTRACT:
+			_set_typed_operator_result<double>(r_dst, a - b);
+			break;
+		case Variant::OP_MULTIPLY:
+			_set_typed_operator_result<double>(r_dst, a * b);
+			break;
+		case Variant::OP_DIVIDE:
+			_set_typed_operator_result<double>(r_dst, a / b);
+			break;
+		case Variant::OP_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a == b);
+			break;
+		case Variant::OP_NOT_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a != b);
+			break;
+		case Variant::OP_LESS:
+			_set_typed_operator_result<bool>(r_dst, a < b);
+			break;
+		case Variant::OP_LESS_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a <= b);
+			break;
+		case Variant::OP_GREATER:
+			_set_typed_operator_result<bool>(r_dst, a > b);
+			break;
+		case Variant::OP_GREATER_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a >= b);
+			break;
+		default:
+			break;
+	}
+}
+
+// The right operand is either a vector of the same type or a float (scaling).
+template <typename T>
+static _FORCE_INLINE_ void _evaluate_operator_vector(int p_operator, const Variant *p_a, const Variant *p_b, Variant *r_dst) {
+	const T a = VariantInternalAccessor<T>::get(p_a);
+	if (p_operator == Variant::OP_NEGATE) {
+		_set_typed_operator_result<T>(r_dst, -a);
+		return;
+	}
+
+	if (p_b->get_type() == Variant::FLOAT) {
+		const double b = *VariantInternal::get_float(p_b);
+		switch (p_operator) {
+			case Variant::OP_MULTIPLY:
+				_set_typed_operator_result<T>(r_dst, a * b);
+				break;
+			case Variant::OP_DIVIDE:
+				_set_typed_operator_result<T>(r_dst, a / b);
+				break;
+			default:
+				break;
+		}
+		return;
+	}
+
+	const T b = VariantInternalAccessor<T>::get(p_b);
+	switch (p_operator) {
+		case Variant::OP_ADD:
+			_set_typed_operator_result<T>(r_dst, a + b);
+			break;
+		case Variant::OP_SUBTRACT:
+			_set_typed_operator_result<T>(r_dst, a - b);
+			break;
+		case Variant::OP_MULTIPLY:
+			_set_typed_operator_result<T>(r_dst, a * b);
+			break;
+		case Variant::OP_DIVIDE:
+			_set_typed_operator_result<T>(r_dst, a / b);
+			break;
+		case Variant::OP_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a == b);
+			break;
+		case Variant::OP_NOT_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a != b);
+			break;
+		default:
+			break;
+	}
+}
+
+// Inline caches are keyed on the receiver's script, so only objects with a GDScript instance use them.
+// Other script instances may resolve names in any way.
+static _FORCE_INLINE_ GDScriptInstance *_get_inline_cache_instance(Object *p_object) {
+	ScriptInstance *script_instance = p_object->get_script_instance();
+	if (!script_instance || script_instance->is_placeholder() || script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+		return nullptr;
+	}
+	return static_cast<GDScriptInstance *>(script_instance);
+}
+
+bool GDScriptFunction::_inline_cache_fill(GDScriptInlineCache &p_cache, Object *p_object, GDScriptInstance *p_instance, const StringName &p_name, GDScriptInlineCache::Access p_access, GDScriptInlineCache::Entry &r_entry) {
+	static BinaryMutex inline_cache_mutex;
+	MutexLock lock(inline_cache_mutex);
+
+	const GDScript *script = p_instance->script.ptr();
+	const void *native = p_access == GDScriptInlineCache::ACCESS_CALL ? &p_object->get_gdtype() : nullptr;
+	const uint32_t current = GDScriptInlineCache::epoch.get();
+
+	// Slots of the current epoch may be read concurrently, so only outdated ones are rewritten.
+	GDScriptInlineCache::Slot *slot = nullptr;
+	for (int i = 0; i < GDScriptInlineCache::MAX_ENTRIES; i++) {
+		GDScriptInlineCache::Slot &S = p_cache.slots[i];
+		if (S.epoch.load(std::memory_order_relaxed) != current) {
+			if (!slot) {
+				slot = &S;
+			}
+		} else if (S.read(current, script, native, r_entry)) {
+			return true; // Filled by another thread.
+		}
+	}
+	if (!slot) {
+		return false; // Megamorphic, use the regular path.
+	}
+
+	r_entry = GDScriptInlineCache::Entry();
+
+	switch (p_access) {
+		case GDScriptInlineCache::ACCESS_GET:
+		case GDScriptInlineCache::ACCESS_SET: {
+			// Same lookup as `GDScriptInstance::get()` and `GDScriptInstance::set()`, which check members first.
+			HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(p_name);
+			if (E) {
+				const StringName &accessor = p_access == GDScriptInlineCache::ACCESS_GET ? E->value.getter : E->value.setter;
+				if (!script->valid || accessor == StringName()) {
+					r_entry.kind = GDScriptInlineCache::KIND_MEMBER;
+					r_entry.member_index = E->value.index;
+					r_entry.member_type = &E->value.data_type;
+				}
+			}
+		} break;
+		case GDScriptInlineCache::ACCESS_CALL: {
+			// `free()` and `_ready()` are handled specially by `Object::callp()` and `GDScriptInstance::callp()`.
+			if (p_name == CoreStringName(free_) || p_name == SceneStringName(_ready)) {
+				break;
+			}
+			for (const GDScript *sptr = script; sptr; sptr = sptr->base.ptr()) {
+				if (likely(sptr->valid)) {
+					HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(p_name);
+					if (E) {
+						r_entry.kind = GDScriptInlineCache::KIND_FUNCTION;
+						r_entry.function = E->value;
+						break;
+					}
+				}
+			}
+			if (r_entry.kind != GDScriptInlineCache::KIND_GENERIC || p_object->is_class_ptr(Script::get_class_ptr_static())) {
+				break; // Scripts override `Object::callp()`.
+			}
+			// Extension method binds may be unregistered on reload, so they are not cached.
+			const StringName &class_name = p_object->get_class_name();
+			const ClassDB::APIType api = ClassDB::get_api_type(class_name);
+			if (api != ClassDB::API_EXTENSION && api != ClassDB::API_EDITOR_EXTENSION) {
+				MethodBind *method = ClassDB::get_method(class_name, p_name);
+				if (method) {
+					r_entry.kind = GDScriptInlineCache::KIND_METHOD_BIND;
+					r_entry.method = method;
+				}
+			}
+		} break;
+	}
+
+	slot->write(current, script, native, r_entry);
+	return true;
+}
+
+bool GDScriptFunction::_inline_cache_get(GDScriptInlineCache &p_cache, Object *p_object, const StringName &p_name, Variant &r_ret) {
+	GDScriptInstance *instance = _get_inline_cache_instance(p_object);
+	if (!instance) {
+		return false;
+	}
+
+	GDScriptInlineCache::Entry entry;
+	if (unlikely(!p_cache.find(instance->script.ptr(), nullptr, entry)) && !_inline_cache_fill(p_cache, p_object, instance, p_name, GDScriptInlineCache::ACCESS_GET, entry)) {
+		return false;
+	}
+	if (entry.kind != GDScriptInlineCache::KIND_MEMBER || unlikely(entry.member_index >= instance->members.size())) {
+		return false;
+	}
+
+	r_ret = instance->members[entry.member_index];
+	return true;
+}
+
+bool GDScriptFunction::_inline_cache_set(GDScriptInlineCache &p_cache, Object *p_object, const StringName &p_name, const Variant &p_value) {
+	GDScriptInstance *instance = _get_inline_cache_instance(p_object);
+	if (!instance) {
+		return false;
+	}
+
+	GDScriptInlineCache::Entry entry;
+	if (unlikely(!p_cache.find(instance->script.ptr(), nullptr, entry)) && !_inline_cache_fill(p_cache, p_object, instance, p_name, GDScriptInlineCache::ACCESS_SET, entry)) {
+		return false;
+	}
+	// Values needing a conversion go through `GDScriptInstance::set()`.
+	if (entry.kind != GDScriptInlineCache::KIND_MEMBER || unlikely(entry.member_index >= instance->members.size()) || !entry.member_type->is_type(p_value)) {
+		return false;
+	}
+
+#ifdef TOOLS_ENABLED
+	if (!p_object->is_edited()) {
+		p_object->set_edited(true);
+	}
+#endif
+	instance->members.write[entry.member_index] = p_value;
+	return true;
+}
+
+bool GDScriptFunction::_inline_cache_call(GDScriptInlineCache &p_cache, Object *p_object, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	GDScriptInstance *instance = _get_inline_cache_instance(p_object);
+	if (!instance) {
+		return false;
+	}
+
+	GDScriptInlineCache::Entry entry;
+	if (unlikely(!p_cache.find(instance->script.ptr(), &p_object->get_gdtype(), entry)) && !_inline_cache_fill(p_cache, p_object, instance, p_method, GDScriptInlineCache::ACCESS_CALL, entry)) {
+		return false;
+	}
+
+	switch (entry.kind) {
+		case GDScriptInlineCache::KIND_FUNCTION: {
+#ifdef DEBUG_ENABLED
+			// Same lock as `Object::callp()`, so the callee can't free its own receiver.
+			_ObjectDebugLock debug_lock(p_object);
+#endif
+			r_err.error = Callable::CallError::CALL_OK;
+			r_ret = entry.function->call(instance, p_args, p_argcount, r_err);
+			return true;
+		}
+		case GDScriptInlineCache::KIND_METHOD_BIND: {
+#ifdef DEBUG_ENABLED
+			_ObjectDebugLock debug_lock(p_object);
+#endif
+			r_err.error = Callable::CallError::CALL_OK;
+			r_ret = entry.method->call(p_object, p_args, p_argcount, r_err);
+			return true;
+		}
+		default: {
+			return false;
+		}
+	}
+}
+
 void (*type_init_function_table[])(Variant *) = {
 	nullptr, // NIL (shouldn't be called).
 	&VariantInitializer<bool>::init, // BOOL.
@@ -256,6 +578,13 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = { \
 		&&OPCODE_OPERATOR, \
 		&&OPCODE_OPERATOR_VALIDATED, \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT, \
+		&&OPCODE_OPERATOR_INT, \
+		&&OPCODE_OPERATOR_INT_JUMP_IF_NOT, \
+		&&OPCODE_OPERATOR_FLOAT, \
+		&&OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT, \
+		&&OPCODE_OPERATOR_VECTOR2, \
+		&&OPCODE_OPERATOR_VECTOR3, \
 		&&OPCODE_TYPE_TEST_BUILTIN, \
 		&&OPCODE_TYPE_TEST_ARRAY, \
 		&&OPCODE_TYPE_TEST_DICTIONARY, \
@@ -273,6 +602,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_GET_NAMED_VALIDATED, \
 		&&OPCODE_SET_MEMBER, \
 		&&OPCODE_GET_MEMBER, \
+		&&OPCODE_GET_MEMBER_OPERATOR_VALIDATED, \
 		&&OPCODE_SET_STATIC_VARIABLE, \
 		&&OPCODE_GET_STATIC_VARIABLE, \
 		&&OPCODE_ASSIGN, \
@@ -853,6 +1183,119 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				if (!dst->booleanize()) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_INT) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_operator_int(_code_ptr[ip + 4], a, b, dst);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_INT_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_operator_int(_code_ptr[ip + 4], a, b, dst);
+
+				if (!dst->booleanize()) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_FLOAT) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_operator_float(_code_ptr[ip + 4], a, b, dst);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_operator_float(_code_ptr[ip + 4], a, b, dst);
+
+				if (!dst->booleanize()) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_VECTOR2) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_operator_vector<Vector2>(_code_ptr[ip + 4], a, b, dst);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_VECTOR3) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_operator_vector<Vector3>(_code_ptr[ip + 4], a, b, dst);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1197,7 +1640,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(4);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1207,8 +1650,17 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-				dst->set_named(*index, *value, valid);
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
+
+				bool valid = false;
+				if (dst->get_type() == Variant::OBJECT) {
+					Object *obj = dst->get_validated_object();
+					valid = obj && _inline_cache_set(_inline_caches_ptr[cache_index], obj, *index, *value);
+				}
+				if (!valid) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1229,7 +1681,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1249,7 +1701,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1259,6 +1711,17 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
+
+				if (src->get_type() == Variant::OBJECT) {
+					Object *obj = src->get_validated_object();
+					if (obj && _inline_cache_get(_inline_caches_ptr[cache_index], obj, *index, *dst)) {
+						ip += 5;
+						DISPATCH_OPCODE;
+					}
+				}
+
 				bool valid;
 #ifdef DEBUG_ENABLED
 				//allow better error message in cases where src and dst are the same stack position
@@ -1274,7 +1737,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 				*dst = ret;
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1336,6 +1799,40 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_GET_MEMBER_OPERATOR_VALIDATED) {
+				CHECK_SPACE(8);
+				{
+					GET_VARIANT_PTR(member, 0);
+					int indexname = _code_ptr[ip + 2];
+					GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
+					const StringName *index = &_global_names_ptr[indexname];
+#ifndef DEBUG_ENABLED
+					ClassDB::get_property(p_instance->owner, *index, *member);
+#else
+					bool ok = ClassDB::get_property(p_instance->owner, *index, *member);
+					if (!ok) {
+						err_text = "Internal error getting property: " + String(*index);
+						OPCODE_BREAK;
+					}
+#endif
+				}
+				ip += 3;
+
+				// Same as `OPCODE_OPERATOR_VALIDATED`, without dispatching again.
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_SET_STATIC_VARIABLE) {
 				CHECK_SPACE(4);
 
@@ -1897,7 +2394,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1908,6 +2405,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_index = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
+
 				GodotProfileZoneScriptSystemCall(methodname, source, name, *methodname, line);
 
 				GET_INSTRUCTION_ARG(base, argc);
@@ -1926,9 +2426,17 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				Variant temp_ret;
 				Callable::CallError err;
+				bool cached = false;
+				if (base->get_type() == Variant::OBJECT) {
+					Object *obj = base->get_validated_object();
+					cached = obj && _inline_cache_call(_inline_caches_ptr[cache_index], obj, *methodname, (const Variant **)argptrs, argc, temp_ret, err);
+				}
+				if (!cached) {
+					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+				}
+
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1957,8 +2465,6 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 #endif
-				} else {
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 				}
 #ifdef DEBUG_ENABLED
 
@@ -2013,7 +2519,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif // DEBUG_ENABLED
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
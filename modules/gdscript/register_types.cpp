@@ -31,6 +31,7 @@
 #include "register_types.h"
 
 #include "gdscript.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_parser.h"
 #include "gdscript_tokenizer_buffer.h"
@@ -82,10 +83,12 @@ class EditorExportGDScript : public EditorExportPlugin {
 
 	static constexpr EditorExportPreset::ScriptExportMode DEFAULT_SCRIPT_MODE = EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED;
 	EditorExportPreset::ScriptExportMode script_mode = DEFAULT_SCRIPT_MODE;
+	bool debug = false;
 
 protected:
 	virtual void _export_begin(const HashSet<String> &p_features, bool p_debug, const String &p_path, int p_flags) override {
 		script_mode = DEFAULT_SCRIPT_MODE;
+		debug = p_debug;
 
 		const Ref<EditorExportPreset> &preset = get_export_preset();
 		if (preset.is_valid()) {
@@ -104,13 +107,21 @@ protected:
 		}
 
 		String source = String::utf8(reinterpret_cast<const char *>(file.ptr()), file.size());
-		GDScriptTokenizerBuffer::CompressMode compress_mode = script_mode == EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED ? GDScriptTokenizerBuffer::COMPRESS_ZSTD : GDScriptTokenizerBuffer::COMPRESS_NONE;
+		GDScriptTokenizerBuffer::CompressMode compress_mode = script_mode == EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS ? GDScriptTokenizerBuffer::COMPRESS_NONE : GDScriptTokenizerBuffer::COMPRESS_ZSTD;
 		file = GDScriptTokenizerBuffer::parse_code_string(source, compress_mode);
 		if (file.is_empty()) {
 			return;
 		}
 
 		add_file(p_path.get_basename() + ".gdc", file, true);
+
+		if (script_mode == EditorExportPreset::MODE_SCRIPT_BYTECODE) {
+			// Scripts that can't be compiled ahead of time are still loaded from their tokens.
+			Vector<uint8_t> bytecode = GDScriptBytecodeCache::compile(p_path, source, file, compress_mode, debug);
+			if (!bytecode.is_empty()) {
+				add_file(GDScriptBytecodeCache::get_cache_path(p_path), bytecode, false);
+			}
+		}
 	}
 
 public:
@@ -132,17 +132,22 @@ void finish_language() {
 
 StringName GDScriptTestRunner::test_function_name;
 
-GDScriptTestRunner::GDScriptTestRunner(const String &p_source_dir, bool p_init_language, bool p_print_filenames, bool p_use_binary_tokens) {
+GDScriptTestRunner::GDScriptTestRunner(const String &p_source_dir, bool p_init_language, bool p_print_filenames, bool p_use_binary_tokens, bool p_optimize_bytecode) {
 	test_function_name = StringName("test");
 	do_init_languages = p_init_language;
 	print_filenames = p_print_filenames;
 	binary_tokens = p_use_binary_tokens;
+	optimize_bytecode = p_optimize_bytecode;
 
 	source_dir = p_source_dir;
 	if (!source_dir.ends_with("/")) {
 		source_dir += "/";
 	}
 
+	// Read by the language when it is initialized, and not set by the test project.
+	previous_optimize_bytecode = GLOBAL_GET("debug/settings/gdscript/optimize_bytecode");
+	ProjectSettings::get_singleton()->set_setting("debug/settings/gdscript/optimize_bytecode", optimize_bytecode);
+
 	if (do_init_languages) {
 		init_language(p_source_dir);
 	}
@@ -174,6 +179,7 @@ GDScriptTestRunner::~GDScriptTestRunner() {
 	if (do_init_languages) {
 		finish_language();
 	}
+	ProjectSettings::get_singleton()->set_setting("debug/settings/gdscript/optimize_bytecode", previous_optimize_bytecode);
 }
 
 #ifndef DEBUG_ENABLED
@@ -118,6 +118,8 @@ class GDScriptTestRunner {
 	bool do_init_languages = false;
 	bool print_filenames; // Whether filenames should be printed when generated/running tests
 	bool binary_tokens; // Test with buffer tokenizer.
+	bool optimize_bytecode; // Test with the bytecode optimizer enabled.
+	Variant previous_optimize_bytecode;
 
 	bool make_tests();
 	bool make_tests_for_dir(const String &p_dir);
@@ -130,7 +132,7 @@ public:
 	int run_tests();
 	bool generate_outputs();
 
-	GDScriptTestRunner(const String &p_source_dir, bool p_init_language, bool p_print_filenames = false, bool p_use_binary_tokens = false);
+	GDScriptTestRunner(const String &p_source_dir, bool p_init_language, bool p_print_filenames = false, bool p_use_binary_tokens = false, bool p_optimize_bytecode = false);
 	~GDScriptTestRunner();
 };
 
@@ -32,16 +32,15 @@
 
 #include "gdscript_test_runner.h"
 
+#include "../gdscript_bytecode_cache.h"
 #include "../gdscript_cache.h"
 
+#include "core/config/project_settings.h"
 #include "core/io/file_access.h"
+#include "core/os/os.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
-#ifdef TOOLS_ENABLED
-#include "core/os/os.h"
-#endif
-
 namespace GDScriptTests {
 
 class TestGDScriptCacheAccessor {
@@ -66,6 +65,16 @@ TEST_SUITE("[Modules][GDScript]") {
 		INFO("Make sure `*.out` files have expected results.");
 		REQUIRE_MESSAGE(fail_count == 0, "All GDScript tests should pass.");
 	}
+
+	// The optimizer must not change what any script does, so the same outputs are expected.
+	TEST_CASE("Script compilation and runtime with optimized bytecode") {
+		bool print_filenames = OS::get_singleton()->get_cmdline_args().find("--print-filenames") != nullptr;
+		bool use_binary_tokens = OS::get_singleton()->get_cmdline_args().find("--use-binary-tokens") != nullptr;
+		GDScriptTestRunner runner("modules/gdscript/tests/scripts", true, print_filenames, use_binary_tokens, true);
+		int fail_count = runner.run_tests();
+		INFO("Make sure `*.out` files have expected results.");
+		REQUIRE_MESSAGE(fail_count == 0, "All GDScript tests should pass with optimized bytecode.");
+	}
 }
 #endif // TOOLS_ENABLED
 
@@ -91,6 +100,126 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+struct InlineCacheThreadData {
+	Ref<RefCounted> receiver;
+	SafeFlag *done = nullptr;
+	SafeNumeric<uint32_t> *failures = nullptr;
+};
+
+TEST_CASE("[Modules][GDScript] Inline caches stay consistent while invalidated from another thread") {
+	GDScriptLanguage::get_singleton()->init();
+	Ref<GDScript> gdscript = memnew(GDScript);
+	// Both classes reach the same call site, with `a` at a different member index in each.
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+class Small:
+	var a := 1
+	func get_value():
+		return 10
+
+class Big:
+	var b0 := 0
+	var b1 := 0
+	var b2 := 0
+	var b3 := 0
+	var b4 := 0
+	var b5 := 0
+	var b6 := 0
+	var a := 2
+	func get_value():
+		return 20
+
+func run(count: int) -> int:
+	var receivers: Array = [Small.new(), Big.new()]
+	var total := 0
+	for i in count:
+		var receiver = receivers[i % 2]
+		total += receiver.a + receiver.get_value()
+	return total
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE(error == OK);
+
+	constexpr int RUNNERS = 3;
+	constexpr int ITERATIONS = 10000;
+	constexpr int64_t EXPECTED = (ITERATIONS / 2) * (1 + 10 + 2 + 20);
+
+	SafeFlag done;
+	SafeNumeric<uint32_t> failures;
+	InlineCacheThreadData data[RUNNERS];
+	Thread runners[RUNNERS];
+	for (int i = 0; i < RUNNERS; i++) {
+		data[i].receiver = Ref<RefCounted>(memnew(RefCounted));
+		data[i].receiver->set_script(gdscript);
+		data[i].done = &done;
+		data[i].failures = &failures;
+		runners[i].start([](void *p_data) {
+			InlineCacheThreadData *thread_data = (InlineCacheThreadData *)p_data;
+			while (!thread_data->done->is_set()) {
+				if (int64_t(thread_data->receiver->call("run", ITERATIONS)) != EXPECTED) {
+					thread_data->failures->increment();
+				}
+			}
+		},
+				&data[i]);
+	}
+
+	// Every invalidation makes the next lookups refill the slots the runners are reading.
+	const uint64_t until = OS::get_singleton()->get_ticks_msec() + 500;
+	while (OS::get_singleton()->get_ticks_msec() < until) {
+		GDScriptInlineCache::invalidate();
+	}
+	done.set();
+	for (int i = 0; i < RUNNERS; i++) {
+		runners[i].wait_to_finish();
+	}
+
+	CHECK_MESSAGE(failures.get() == 0, "Cached member reads and calls should stay correct while the cache is invalidated.");
+}
+
+#ifdef TOOLS_ENABLED
+TEST_CASE("[Modules][GDScript] Load compiled bytecode cache and run it") {
+	GDScriptLanguage::get_singleton()->init();
+	const String path = "res://bytecode_cache_test.gd";
+	const String source = R"(
+extends RefCounted
+
+class Inner:
+	var values := [1, 2, 3]
+
+	func sum() -> int:
+		var total := 0
+		for value in values:
+			total += value
+		return total
+
+const OFFSET = 36
+
+func _init():
+	var add := func(a: int, b: int) -> int: return a + b
+	set_meta("result", add.call(Inner.new().sum(), OFFSET))
+)";
+	const Vector<uint8_t> tokens = GDScriptTokenizerBuffer::parse_code_string(source, GDScriptTokenizerBuffer::COMPRESS_NONE);
+	const Vector<uint8_t> bytecode = GDScriptBytecodeCache::compile(path, source, tokens, GDScriptTokenizerBuffer::COMPRESS_NONE, true);
+	REQUIRE_MESSAGE(!bytecode.is_empty(), "The script should compile to bytecode.");
+
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_path_cache(path);
+	gdscript->set_binary_tokens_source(tokens);
+	gdscript->set_bytecode_cache(bytecode);
+	CHECK(GDScriptBytecodeCache::make_scripts(gdscript.ptr()) == OK);
+	CHECK_MESSAGE(GDScriptBytecodeCache::load(gdscript.ptr()) == OK, "The script should load from its bytecode cache.");
+	REQUIRE(gdscript->is_valid());
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The cached bytecode should run like the compiled script.");
+}
+#endif // TOOLS_ENABLED
+
 TEST_CASE("[Modules][GDScript] Loading keeps ResourceCache and GDScriptCache in sync") {
 	const String path = TestUtils::get_temp_path("gdscript_load_test.gd");
 
@@ -141,4 +270,106 @@ TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	}
 }
 
+// Skipped by default; run it with:
+//   godot --test --no-skip --test-case="*[Benchmark]*" [--benchmark-gdscript-file <path>]
+// Results are printed as JSON, and also written to <path> if given.
+TEST_CASE("[Modules][GDScript][Benchmark] Bytecode optimization CPU time" * doctest::skip()) {
+	// Each case stresses code that one of the peephole passes rewrites. `run()` returns a checksum,
+	// which has to be the same with and without optimization.
+	struct BenchmarkCase {
+		const char *name;
+		const char *source;
+	};
+	const BenchmarkCase cases[] = {
+		{ "untyped_operators", R"(
+extends RefCounted
+
+var offset := 3
+
+func run() -> int:
+	var total := 0
+	for i in 1000000:
+		var value = i * 2 + offset
+		if value % 3 == 0:
+			total += value
+	return total
+)" },
+		{ "member_operators", R"(
+extends RefCounted
+
+var a = 1
+var b = 2
+
+func run() -> int:
+	var total = 0
+	for i in 1000000:
+		total += a + b
+		if total > b:
+			total -= a
+	return total
+)" },
+		{ "assign_chains", R"(
+extends RefCounted
+
+func run() -> int:
+	var total := 0
+	for i in 1000000:
+		var a = i
+		var b = a
+		var c = b
+		total += c
+	return total
+)" },
+		{ "compare_and_jump", R"(
+extends RefCounted
+
+func run() -> int:
+	var i = 0
+	var hits = 0
+	while i < 1000000:
+		if i < 500000:
+			hits += 1
+		i += 1
+	return hits
+)" },
+	};
+
+	const String setting = "debug/settings/gdscript/optimize_bytecode";
+	const Variant previous_optimize = GLOBAL_GET(setting);
+
+	Array results;
+	for (const BenchmarkCase &benchmark_case : cases) {
+		Dictionary result;
+		result["name"] = benchmark_case.name;
+		int64_t totals[2] = {};
+		for (const bool optimize : { false, true }) {
+			ProjectSettings::get_singleton()->set_setting(setting, optimize);
+			GDScriptLanguage::get_singleton()->init();
+
+			Ref<GDScript> gdscript = memnew(GDScript);
+			gdscript->set_source_code(benchmark_case.source);
+			ERR_PRINT_OFF;
+			const Error error = gdscript->reload();
+			ERR_PRINT_ON;
+			REQUIRE(error == OK);
+
+			Ref<RefCounted> ref_counted = memnew(RefCounted);
+			ref_counted->set_script(gdscript);
+			const uint64_t from = OS::get_singleton()->get_ticks_usec();
+			totals[optimize] = ref_counted->call("run");
+			result[optimize ? "optimized_msec" : "unoptimized_msec"] = double(OS::get_singleton()->get_ticks_usec() - from) / 1000.0;
+		}
+		CHECK_MESSAGE(totals[0] == totals[1], vformat("Optimized bytecode should compute the same result in \"%s\".", benchmark_case.name));
+		results.push_back(result);
+	}
+
+	ProjectSettings::get_singleton()->set_setting(setting, previous_optimize);
+	GDScriptLanguage::get_singleton()->init();
+
+	Dictionary report;
+	report["benchmark"] = "gdscript";
+	report["results"] = results;
+	REQUIRE_MESSAGE(TestUtils::write_benchmark_report("gdscript", report), "Couldn't write the benchmark results file.");
+}
+
 } // namespace GDScriptTests
@@ -0,0 +1,16 @@
+#debug-only
+# Calls through the inline cache must lock the receiver like `Object.call()` does.
+
+class Freeable extends Object:
+	func die():
+		free()
+
+func call_die(obj):
+	obj.die()
+
+func test():
+	var obj = Freeable.new()
+	for _i in 2:
+		call_die(obj)
+	print(is_instance_valid(obj))
+	obj.free()
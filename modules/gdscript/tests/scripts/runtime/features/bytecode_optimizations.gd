@@ -0,0 +1,106 @@
+# Results written directly to their target must behave as if they were assigned after the operation.
+
+var member := 1
+var untyped_member = 1
+
+class Rotated extends Node2D:
+	func get_scaled_rotation() -> float:
+		# Native member read, fused with the operator using it.
+		return rotation * 2
+
+	func is_rotated() -> bool:
+		if rotation * 1 > 0.5:
+			return true
+		return false
+
+class Tracked:
+	func _notification(what):
+		if what == NOTIFICATION_PREDELETE:
+			print("freed")
+
+func add_to_parameter(value: int) -> int:
+	value = value + 10
+	return value
+
+func test():
+	var a := 1
+	var b := 2
+	var c := a + b
+	print(c)
+
+	# Operands that are also the target.
+	a = a + b
+	print(a)
+	a = b - a
+	print(a)
+	a += a
+	print(a)
+
+	var v := Vector2(1, 2)
+	v = Vector2(v.y, v.x) * 2.0
+	print(v)
+	var x := v.x
+	print(x)
+
+	var untyped = 5
+	untyped = untyped * 1.5
+	print(untyped)
+
+	member = member + c
+	print(member)
+	untyped_member = untyped_member + untyped
+	print(untyped_member)
+	print(add_to_parameter(b))
+
+	var arr := [1, 2, 3]
+	var first = arr[0]
+	arr[0] = arr[1] + arr[2]
+	print(first, " ", arr)
+
+	var text := "a"
+	text = text + "b" + text
+	print(text)
+
+	# Comparisons followed by jumps.
+	var count := 0
+	while count < 5:
+		count += 1
+	print(count)
+	if count == 5:
+		print("equal")
+	if count > 5:
+		print("greater")
+	else:
+		print("not greater")
+	if not count != 5:
+		print("not different")
+
+	# Short-circuit and ternary results jumped to.
+	var t := true if count > 2 and count < 10 else false
+	print(t)
+	var f := count > 10 or count < 0
+	print(f)
+	var y := count * 2 if count > 2 else count
+	print(y)
+
+	# Constant operands.
+	const LIMIT = 4
+	var folded := LIMIT * 2 + 1
+	print(folded)
+	var negated := -LIMIT
+	print(negated)
+
+	# Member reads used by operators.
+	var rotated := Rotated.new()
+	rotated.rotation = 1.5
+	print(rotated.get_scaled_rotation())
+	print(rotated.is_rotated())
+	rotated.free()
+
+	# Temporaries written directly to their target release objects with the target.
+	var holder := [Tracked.new()]
+	var tracked = holder[0]
+	holder.clear()
+	print("cleared")
+	tracked = null
+	print("done")
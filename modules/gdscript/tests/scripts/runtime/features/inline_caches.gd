@@ -0,0 +1,99 @@
+# Named access and calls on untyped values go through per-instruction caches,
+# which must behave like the regular lookup for every kind of receiver.
+
+class A:
+	var value = 1
+	var typed: int = 0
+	var with_setter = 0:
+		set(v):
+			with_setter = v * 10
+	var with_getter = 5:
+		get:
+			return with_getter + 100
+
+	func label():
+		return "A"
+
+	func shared():
+		return "A.shared"
+
+class B extends A:
+	func label():
+		return "B"
+
+class C:
+	var value = "c"
+
+	func label():
+		return "C"
+
+	func _get(property):
+		if property == &"dynamic":
+			return "C.dynamic"
+		return null
+
+class D extends C:
+	func label():
+		return "D"
+
+class N extends Node:
+	var value = "n"
+
+	func label():
+		return "N"
+
+func read_value(obj):
+	return obj.value
+
+func write_value(obj, v):
+	obj.value = v
+
+func call_label(obj):
+	return obj.label()
+
+func test():
+	var receivers = [A.new(), B.new(), C.new(), A.new(), C.new(), B.new()]
+
+	# Polymorphic sites, hit repeatedly with the same receivers.
+	for _i in 2:
+		for obj in receivers:
+			write_value(obj, read_value(obj))
+			print(call_label(obj), " ", read_value(obj))
+
+	# Inherited function, found in the base script.
+	var b = B.new()
+	for _i in 2:
+		print(b.shared())
+
+	# Typed members convert through the regular path.
+	var a = A.new()
+	for v in [2, 3.0, 4.7]:
+		a.typed = v
+		print(a.typed, " ", typeof(a.typed) == TYPE_INT)
+
+	# Accessors are not bypassed.
+	for i in 2:
+		a.with_setter = i + 1
+		print(a.with_setter)
+		print(a.with_getter)
+
+	# Names that are not members fall back to `_get()`.
+	var c = C.new()
+	for _i in 2:
+		print(c.dynamic)
+
+	# Native methods and properties on scripted and plain objects.
+	var n = N.new()
+	var nodes = [n, Node.new()]
+	for node in nodes:
+		node.name = "Named"
+		print(node.name, " ", node.get_child_count())
+	print(n.label(), " ", n.value)
+	for node in nodes:
+		node.free()
+
+	# Megamorphic sites keep working once all cache entries are used.
+	var many = [A.new(), B.new(), C.new(), D.new(), N.new()]
+	for obj in many:
+		print(call_label(obj))
+	many[4].free()
@@ -0,0 +1,73 @@
+# Operators on statically typed int, float and vector operands use specialized opcodes.
+
+func test():
+	var i := 7
+	var j := 3
+	print(i + j)
+	print(i - j)
+	print(i * j)
+	print(i & j)
+	print(i | j)
+	print(i ^ j)
+	print(-i)
+	print(~i)
+	print(i < j, " ", i <= j, " ", i > j, " ", i >= j, " ", i == j, " ", i != j)
+
+	# Integer overflow wraps around like regular operators.
+	var big := 9223372036854775807
+	print(big + 1 == -9223372036854775807 - 1)
+
+	var f := 2.5
+	var g := 0.5
+	print(f + g)
+	print(f - g)
+	print(f * g)
+	print(f / g)
+	print(-f)
+	print(f < g, " ", f <= g, " ", f > g, " ", f >= g, " ", f == g, " ", f != g)
+
+	var v2 := Vector2(1, 2)
+	var w2 := Vector2(3, 4)
+	print(v2 + w2)
+	print(v2 - w2)
+	print(v2 * w2)
+	print(w2 / v2)
+	print(v2 * 2.0)
+	print(w2 / 2.0)
+	print(-v2)
+	print(v2 == w2, " ", v2 != w2)
+
+	var v3 := Vector3(1, 2, 3)
+	var w3 := Vector3(2, 2, 2)
+	print(v3 + w3)
+	print(v3 * w3)
+	print(v3 * 0.5)
+	print(-v3)
+	print(v3 == w3, " ", v3 != w3)
+
+	# Results stored in untyped variables take the result type.
+	var untyped = "text"
+	untyped = i + j
+	print(typeof(untyped) == TYPE_INT, " ", untyped)
+	untyped = f < g
+	print(typeof(untyped) == TYPE_BOOL, " ", untyped)
+	untyped = v2 * 3.0
+	print(typeof(untyped) == TYPE_VECTOR2, " ", untyped)
+
+	# Conditions and loops.
+	var sum := 0
+	var n := 0
+	while n < 10:
+		sum += n
+		n += 1
+	print(sum)
+
+	var total := 0.0
+	while total < 3.0:
+		total += 0.75
+	print(total)
+
+	if i > j:
+		print("greater")
+	else:
+		print("not greater")
@@ -474,7 +474,7 @@ bool GodotBody3D::is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const {
 	return locked_axis & p_axis;
 }
 
-void GodotBody3D::integrate_forces(real_t p_step) {
+void GodotBody3D::integrate_forces(real_t p_step, bool p_defer_broadphase_update) {
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
 	}
@@ -665,12 +665,27 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector3();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		if (p_defer_broadphase_update) {
+			// The broadphase isn't safe to modify from multiple threads, so only update the AABBs here
+			// and let the caller push them with flush_broadphase_update(), in a deterministic order.
+			_update_shape_aabbs_with_motion(motion);
+			broadphase_update_pending = true;
+		} else {
+			_update_shapes_with_motion(motion);
+		}
 	}
 
 	contact_count = 0;
 }
 
+void GodotBody3D::flush_broadphase_update() {
+	if (!broadphase_update_pending) {
+		return;
+	}
+	broadphase_update_pending = false;
+	_update_broadphase_from_shape_aabbs();
+}
+
 void GodotBody3D::integrate_velocities(real_t p_step) {
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
@@ -106,6 +106,7 @@ class GodotBody3D : public GodotCollisionObject3D {
 	bool continuous_cd = false;
 	bool can_sleep = true;
 	bool first_time_kinematic = false;
+	bool broadphase_update_pending = false;
 
 	void _mass_properties_changed();
 	virtual void _shapes_changed() override;
@@ -144,6 +145,8 @@ class GodotBody3D : public GodotCollisionObject3D {
 	GodotPhysicsDirectBodyState3D *direct_state = nullptr;
 
 	uint64_t island_step = 0;
+	uint64_t solver_step = 0;
+	uint32_t solver_index = 0;
 
 	void _update_transform_dependent();
 
@@ -195,6 +198,11 @@ public:
 	_FORCE_INLINE_ uint64_t get_island_step() const { return island_step; }
 	_FORCE_INLINE_ void set_island_step(uint64_t p_step) { island_step = p_step; }
 
+	_FORCE_INLINE_ uint64_t get_solver_step() const { return solver_step; }
+	_FORCE_INLINE_ void set_solver_step(uint64_t p_step) { solver_step = p_step; }
+	_FORCE_INLINE_ uint32_t get_solver_index() const { return solver_index; }
+	_FORCE_INLINE_ void set_solver_index(uint32_t p_index) { solver_index = p_index; }
+
 	_FORCE_INLINE_ void add_constraint(GodotConstraint3D *p_constraint, int p_pos) { constraint_map[p_constraint] = p_pos; }
 	_FORCE_INLINE_ void remove_constraint(GodotConstraint3D *p_constraint) { constraint_map.erase(p_constraint); }
 	const HashMap<GodotConstraint3D *, int> &get_constraint_map() const { return constraint_map; }
@@ -220,6 +228,13 @@ public:
 	_FORCE_INLINE_ const Vector3 &get_biased_linear_velocity() const { return biased_linear_velocity; }
 	_FORCE_INLINE_ const Vector3 &get_biased_angular_velocity() const { return biased_angular_velocity; }
 
+	_FORCE_INLINE_ void set_solver_velocities(const Vector3 &p_linear_velocity, const Vector3 &p_angular_velocity, const Vector3 &p_biased_linear_velocity, const Vector3 &p_biased_angular_velocity) {
+		linear_velocity = p_linear_velocity;
+		angular_velocity = p_angular_velocity;
+		biased_linear_velocity = p_biased_linear_velocity;
+		biased_angular_velocity = p_biased_angular_velocity;
+	}
+
 	_FORCE_INLINE_ void apply_central_impulse(const Vector3 &p_impulse) {
 		linear_velocity += p_impulse * _inv_mass;
 	}
@@ -316,7 +331,8 @@ public:
 	void set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool lock);
 	bool is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const;
 
-	void integrate_forces(real_t p_step);
+	void integrate_forces(real_t p_step, bool p_defer_broadphase_update = false);
+	void flush_broadphase_update();
 	void integrate_velocities(real_t p_step);
 
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
@@ -31,6 +31,7 @@
 #include "godot_body_pair_3d.h"
 
 #include "godot_collision_solver_3d.h"
+#include "godot_solver_body_3d.h"
 #include "godot_space_3d.h"
 
 #define MIN_VELOCITY 0.0001
@@ -452,6 +453,22 @@ bool GodotBodyPair3D::pre_solve(real_t p_step) {
 }
 
 void GodotBodyPair3D::solve(real_t p_step) {
+	_solve(p_step, A, B);
+}
+
+bool GodotBodyPair3D::setup_solver_bodies(GodotSolverBodyStore3D &r_store) {
+	solver_index_A = r_store.add_body(A);
+	solver_index_B = r_store.add_body(B);
+	return true;
+}
+
+void GodotBodyPair3D::solve_solver_bodies(real_t p_step, GodotSolverBodyStore3D &r_store) {
+	GodotSolverBody3D *solver_bodies = r_store.ptr();
+	_solve(p_step, &solver_bodies[solver_index_A], &solver_bodies[solver_index_B]);
+}
+
+template <typename T>
+void GodotBodyPair3D::_solve(real_t p_step, T *p_A, T *p_B) {
 	if (!collided) {
 		return;
 	}
@@ -461,11 +478,13 @@ void GodotBodyPair3D::solve(real_t p_step) {
 	Basis zero_basis;
 	zero_basis.set_zero();
 
-	const Basis &inv_inertia_tensor_A = collide_A ? A->get_inv_inertia_tensor() : zero_basis;
-	const Basis &inv_inertia_tensor_B = collide_B ? B->get_inv_inertia_tensor() : zero_basis;
+	const Basis &inv_inertia_tensor_A = collide_A ? p_A->get_inv_inertia_tensor() : zero_basis;
+	const Basis &inv_inertia_tensor_B = collide_B ? p_B->get_inv_inertia_tensor() : zero_basis;
 
-	real_t inv_mass_A = collide_A ? A->get_inv_mass() : 0.0;
-	real_t inv_mass_B = collide_B ? B->get_inv_mass() : 0.0;
+	real_t inv_mass_A = collide_A ? p_A->get_inv_mass() : 0.0;
+	real_t inv_mass_B = collide_B ? p_B->get_inv_mass() : 0.0;
+
+	real_t friction = combine_friction(A, B);
 
 	for (int i = 0; i < contact_count; i++) {
 		Contact &c = contacts[i];
@@ -477,9 +496,9 @@ void GodotBodyPair3D::solve(real_t p_step) {
 
 		//bias impulse
 
-		Vector3 crbA = A->get_biased_angular_velocity().cross(c.rA);
-		Vector3 crbB = B->get_biased_angular_velocity().cross(c.rB);
-		Vector3 dbv = B->get_biased_linear_velocity() + crbB - A->get_biased_linear_velocity() - crbA;
+		Vector3 crbA = p_A->get_biased_angular_velocity().cross(c.rA);
+		Vector3 crbB = p_B->get_biased_angular_velocity().cross(c.rB);
+		Vector3 dbv = p_B->get_biased_linear_velocity() + crbB - p_A->get_biased_linear_velocity() - crbA;
 
 		real_t vbn = dbv.dot(c.normal);
 
@@ -491,15 +510,15 @@ void GodotBodyPair3D::solve(real_t p_step) {
 			Vector3 jb = c.normal * (c.acc_bias_impulse - jbnOld);
 
 			if (collide_A) {
-				A->apply_bias_impulse(-jb, c.rA + A->get_center_of_mass(), max_bias_av);
+				p_A->apply_bias_impulse(-jb, c.rA + p_A->get_center_of_mass(), max_bias_av);
 			}
 			if (collide_B) {
-				B->apply_bias_impulse(jb, c.rB + B->get_center_of_mass(), max_bias_av);
+				p_B->apply_bias_impulse(jb, c.rB + p_B->get_center_of_mass(), max_bias_av);
 			}
 
-			crbA = A->get_biased_angular_velocity().cross(c.rA);
-			crbB = B->get_biased_angular_velocity().cross(c.rB);
-			dbv = B->get_biased_linear_velocity() + crbB - A->get_biased_linear_velocity() - crbA;
+			crbA = p_A->get_biased_angular_velocity().cross(c.rA);
+			crbB = p_B->get_biased_angular_velocity().cross(c.rB);
+			dbv = p_B->get_biased_linear_velocity() + crbB - p_A->get_biased_linear_velocity() - crbA;
 
 			vbn = dbv.dot(c.normal);
 
@@ -511,19 +530,19 @@ void GodotBodyPair3D::solve(real_t p_step) {
 				Vector3 jb_com = c.normal * (c.acc_bias_impulse_center_of_mass - jbnOld_com);
 
 				if (collide_A) {
-					A->apply_bias_impulse(-jb_com, A->get_center_of_mass(), 0.0f);
+					p_A->apply_bias_impulse(-jb_com, p_A->get_center_of_mass(), 0.0f);
 				}
 				if (collide_B) {
-					B->apply_bias_impulse(jb_com, B->get_center_of_mass(), 0.0f);
+					p_B->apply_bias_impulse(jb_com, p_B->get_center_of_mass(), 0.0f);
 				}
 			}
 
 			c.active = true;
 		}
 
-		Vector3 crA = A->get_angular_velocity().cross(c.rA);
-		Vector3 crB = B->get_angular_velocity().cross(c.rB);
-		Vector3 dv = B->get_linear_velocity() + crB - A->get_linear_velocity() - crA;
+		Vector3 crA = p_A->get_angular_velocity().cross(c.rA);
+		Vector3 crB = p_B->get_angular_velocity().cross(c.rB);
+		Vector3 dv = p_B->get_linear_velocity() + crB - p_A->get_linear_velocity() - crA;
 
 		//normal impulse
 		real_t vn = dv.dot(c.normal);
@@ -536,10 +555,10 @@ void GodotBodyPair3D::solve(real_t p_step) {
 			Vector3 j = c.normal * (c.acc_normal_impulse - jnOld);
 
 			if (collide_A) {
-				A->apply_impulse(-j, c.rA + A->get_center_of_mass());
+				p_A->apply_impulse(-j, c.rA + p_A->get_center_of_mass());
 			}
 			if (collide_B) {
-				B->apply_impulse(j, c.rB + B->get_center_of_mass());
+				p_B->apply_impulse(j, c.rB + p_B->get_center_of_mass());
 			}
 			c.acc_impulse -= j;
 
@@ -548,10 +567,8 @@ void GodotBodyPair3D::solve(real_t p_step) {
 
 		//friction impulse
 
-		real_t friction = combine_friction(A, B);
-
-		Vector3 lvA = A->get_linear_velocity() + A->get_angular_velocity().cross(c.rA);
-		Vector3 lvB = B->get_linear_velocity() + B->get_angular_velocity().cross(c.rB);
+		Vector3 lvA = p_A->get_linear_velocity() + p_A->get_angular_velocity().cross(c.rA);
+		Vector3 lvB = p_B->get_linear_velocity() + p_B->get_angular_velocity().cross(c.rB);
 
 		Vector3 dtv = lvB - lvA;
 		real_t tn = c.normal.dot(dtv);
@@ -583,10 +600,10 @@ void GodotBodyPair3D::solve(real_t p_step) {
 			jt = c.acc_tangent_impulse - jtOld;
 
 			if (collide_A) {
-				A->apply_impulse(-jt, c.rA + A->get_center_of_mass());
+				p_A->apply_impulse(-jt, c.rA + p_A->get_center_of_mass());
 			}
 			if (collide_B) {
-				B->apply_impulse(jt, c.rB + B->get_center_of_mass());
+				p_B->apply_impulse(jt, c.rB + p_B->get_center_of_mass());
 			}
 			c.acc_impulse -= jt;
 
@@ -103,11 +103,20 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	void validate_contacts();
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
+	uint32_t solver_index_A = 0;
+	uint32_t solver_index_B = 0;
+
+	template <typename T>
+	void _solve(real_t p_step, T *p_A, T *p_B);
+
 public:
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual bool setup_solver_bodies(GodotSolverBodyStore3D &r_store) override;
+	virtual void solve_solver_bodies(real_t p_step, GodotSolverBodyStore3D &r_store) override;
+
 	GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B);
 	~GodotBodyPair3D();
 };
@@ -183,10 +183,16 @@ void GodotCollisionObject3D::_update_shapes() {
 }
 
 void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion) {
+	_update_shape_aabbs_with_motion(p_motion);
+	_update_broadphase_from_shape_aabbs();
+}
+
+void GodotCollisionObject3D::_update_shape_aabbs_with_motion(const Vector3 &p_motion) {
 	if (!space) {
 		return;
 	}
 
+	// Doesn't touch the broadphase, so it's safe to call for different objects from multiple threads.
 	for (int i = 0; i < shapes.size(); i++) {
 		Shape &s = shapes.write[i];
 		if (s.disabled) {
@@ -199,13 +205,26 @@ void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion)
 		shape_aabb = xform.xform(shape_aabb);
 		shape_aabb.merge_with(AABB(shape_aabb.position + p_motion, shape_aabb.size)); //use motion
 		s.aabb_cache = shape_aabb;
+	}
+}
+
+void GodotCollisionObject3D::_update_broadphase_from_shape_aabbs() {
+	if (!space) {
+		return;
+	}
+
+	for (int i = 0; i < shapes.size(); i++) {
+		Shape &s = shapes.write[i];
+		if (s.disabled) {
+			continue;
+		}
 
 		if (s.bpid == 0) {
-			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
+			s.bpid = space->get_broadphase()->create(this, i, s.aabb_cache, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
 		}
 
-		space->get_broadphase()->move(s.bpid, shape_aabb);
+		space->get_broadphase()->move(s.bpid, s.aabb_cache);
 	}
 }
 
@@ -82,6 +82,8 @@ private:
 
 protected:
 	void _update_shapes_with_motion(const Vector3 &p_motion);
+	void _update_shape_aabbs_with_motion(const Vector3 &p_motion);
+	void _update_broadphase_from_shape_aabbs();
 	void _unregister_shapes();
 
 	_FORCE_INLINE_ void _set_transform(const Transform3D &p_transform, bool p_update_shapes = true) {
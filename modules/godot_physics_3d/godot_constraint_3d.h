@@ -35,6 +35,7 @@
 
 class GodotBody3D;
 class GodotSoftBody3D;
+class GodotSolverBodyStore3D;
 
 class GodotConstraint3D {
 	GodotBody3D **_body_ptr;
@@ -77,5 +78,10 @@ public:
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
 
+	// Optional path where the solver reads and writes packed copies of the bodies instead.
+	// Returns false if the constraint doesn't support it, in which case the whole island uses solve().
+	virtual bool setup_solver_bodies(GodotSolverBodyStore3D &r_store) { return false; }
+	virtual void solve_solver_bodies(real_t p_step, GodotSolverBodyStore3D &r_store) {}
+
 	virtual ~GodotConstraint3D() {}
 };
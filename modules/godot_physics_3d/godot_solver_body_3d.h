@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*  godot_solver_body_3d.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "godot_body_3d.h"
+
+#include "core/templates/local_vector.h"
+
+// Copy of the body state read and written by the contact solver. Kept in a
+// contiguous array per island, so the solver iterations don't have to chase
+// pointers to scattered GodotBody3D objects.
+struct GodotSolverBody3D {
+	Vector3 linear_velocity;
+	Vector3 angular_velocity;
+	Vector3 biased_linear_velocity;
+	Vector3 biased_angular_velocity;
+	Basis inv_inertia_tensor;
+	Vector3 center_of_mass;
+	real_t inv_mass = 0.0;
+
+	// Body to write the velocities back to, null for static bodies which are never written to.
+	GodotBody3D *body = nullptr;
+
+	// Same interface and math as GodotBody3D, so solvers can be templated over both and give identical results.
+
+	_FORCE_INLINE_ real_t get_inv_mass() const { return inv_mass; }
+	_FORCE_INLINE_ const Basis &get_inv_inertia_tensor() const { return inv_inertia_tensor; }
+	_FORCE_INLINE_ Vector3 get_center_of_mass() const { return center_of_mass; }
+
+	_FORCE_INLINE_ Vector3 get_linear_velocity() const { return linear_velocity; }
+	_FORCE_INLINE_ Vector3 get_angular_velocity() const { return angular_velocity; }
+	_FORCE_INLINE_ const Vector3 &get_biased_linear_velocity() const { return biased_linear_velocity; }
+	_FORCE_INLINE_ const Vector3 &get_biased_angular_velocity() const { return biased_angular_velocity; }
+
+	_FORCE_INLINE_ void apply_impulse(const Vector3 &p_impulse, const Vector3 &p_position = Vector3()) {
+		linear_velocity += p_impulse * inv_mass;
+		angular_velocity += inv_inertia_tensor.xform((p_position - center_of_mass).cross(p_impulse));
+	}
+
+	_FORCE_INLINE_ void apply_bias_impulse(const Vector3 &p_impulse, const Vector3 &p_position = Vector3(), real_t p_max_delta_av = -1.0) {
+		biased_linear_velocity += p_impulse * inv_mass;
+		if (p_max_delta_av != 0.0) {
+			Vector3 delta_av = inv_inertia_tensor.xform((p_position - center_of_mass).cross(p_impulse));
+			if (p_max_delta_av > 0 && delta_av.length() > p_max_delta_av) {
+				delta_av = delta_av.normalized() * p_max_delta_av;
+			}
+			biased_angular_velocity += delta_av;
+		}
+	}
+};
+
+class GodotSolverBodyStore3D {
+	LocalVector<GodotSolverBody3D> bodies;
+	uint64_t step = 0;
+
+public:
+	// Returns the index of the body in the store, adding it if needed.
+	// Non-static bodies belong to a single island, so they are only added once per step.
+	uint32_t add_body(GodotBody3D *p_body) {
+		bool is_static = p_body->get_mode() == PhysicsServer3D::BODY_MODE_STATIC;
+		if (!is_static && p_body->get_solver_step() == step) {
+			return p_body->get_solver_index();
+		}
+
+		uint32_t index = bodies.size();
+		bodies.push_back(GodotSolverBody3D());
+		GodotSolverBody3D &solver_body = bodies[index];
+		solver_body.linear_velocity = p_body->get_linear_velocity();
+		solver_body.angular_velocity = p_body->get_angular_velocity();
+		solver_body.biased_linear_velocity = p_body->get_biased_linear_velocity();
+		solver_body.biased_angular_velocity = p_body->get_biased_angular_velocity();
+		solver_body.inv_inertia_tensor = p_body->get_inv_inertia_tensor();
+		solver_body.center_of_mass = p_body->get_center_of_mass();
+		solver_body.inv_mass = p_body->get_inv_mass();
+
+		if (!is_static) {
+			solver_body.body = p_body;
+			p_body->set_solver_step(step);
+			p_body->set_solver_index(index);
+		}
+		return index;
+	}
+
+	void write_back() {
+		for (const GodotSolverBody3D &solver_body : bodies) {
+			if (solver_body.body) {
+				solver_body.body->set_solver_velocities(solver_body.linear_velocity, solver_body.angular_velocity, solver_body.biased_linear_velocity, solver_body.biased_angular_velocity);
+			}
+		}
+		bodies.clear();
+	}
+
+	void reset(uint64_t p_step) {
+		bodies.clear();
+		step = p_step;
+	}
+
+	_FORCE_INLINE_ GodotSolverBody3D *ptr() { return bodies.ptr(); }
+	_FORCE_INLINE_ uint32_t size() const { return bodies.size(); }
+};
@@ -1265,6 +1265,9 @@ GodotSpace3D::GodotSpace3D() {
 	contact_max_separation = GLOBAL_GET("physics/3d/solver/contact_max_separation");
 	contact_max_allowed_penetration = GLOBAL_GET("physics/3d/solver/contact_max_allowed_penetration");
 	contact_bias = GLOBAL_GET("physics/3d/solver/default_contact_bias");
+	threaded_integration = GLOBAL_GET("physics/3d/solver/threaded_integration");
+	threaded_integration_minimum_bodies = GLOBAL_GET("physics/3d/solver/threaded_integration_minimum_bodies");
+	use_solver_bodies = GLOBAL_GET("physics/3d/solver/use_packed_solver_bodies");
 
 	broadphase = GodotBroadPhase3D::create_func();
 	broadphase->set_pair_callback(_broadphase_pair, this);
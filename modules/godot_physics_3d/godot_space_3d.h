@@ -90,6 +90,10 @@ private:
 
 	int solver_iterations = 0;
 
+	bool threaded_integration = false;
+	int threaded_integration_minimum_bodies = 0;
+	bool use_solver_bodies = false;
+
 	real_t contact_recycle_radius = 0.0;
 	real_t contact_max_separation = 0.0;
 	real_t contact_max_allowed_penetration = 0.0;
@@ -156,6 +160,9 @@ public:
 	const HashSet<GodotCollisionObject3D *> &get_objects() const;
 
 	_FORCE_INLINE_ int get_solver_iterations() const { return solver_iterations; }
+	_FORCE_INLINE_ bool is_threaded_integration_enabled() const { return threaded_integration; }
+	_FORCE_INLINE_ int get_threaded_integration_minimum_bodies() const { return threaded_integration_minimum_bodies; }
+	_FORCE_INLINE_ bool is_using_solver_bodies() const { return use_solver_bodies; }
 	_FORCE_INLINE_ real_t get_contact_recycle_radius() const { return contact_recycle_radius; }
 	_FORCE_INLINE_ real_t get_contact_max_separation() const { return contact_max_separation; }
 	_FORCE_INLINE_ real_t get_contact_max_allowed_penetration() const { return contact_max_allowed_penetration; }
@@ -40,6 +40,7 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define ACTIVE_BODY_COUNT_RESERVE 1024
 
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -112,6 +113,10 @@ void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, Local
 	}
 }
 
+void GodotStep3D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta, true);
+}
+
 void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
 	GodotConstraint3D *constraint = all_constraints[p_constraint_index];
 	constraint->setup(delta);
@@ -130,17 +135,42 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 	p_constraint_island.resize(valid_constraint_count);
 }
 
+bool GodotStep3D::_setup_solver_bodies(const LocalVector<GodotConstraint3D *> &p_constraint_island, GodotSolverBodyStore3D &r_store) const {
+	r_store.reset(_step);
+
+	for (GodotConstraint3D *constraint : p_constraint_island) {
+		if (!constraint->setup_solver_bodies(r_store)) {
+			// Joints and soft body contacts only work on the bodies directly.
+			r_store.reset(_step);
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
 
+	GodotSolverBodyStore3D *solver_body_store = nullptr;
+	if (use_solver_bodies && _setup_solver_bodies(constraint_island, solver_body_stores[p_island_index])) {
+		solver_body_store = &solver_body_stores[p_island_index];
+	}
+
 	int current_priority = 1;
 
 	uint32_t constraint_count = constraint_island.size();
 	while (constraint_count > 0) {
 		for (int i = 0; i < iterations; i++) {
 			// Go through all iterations.
-			for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
-				constraint_island[constraint_index]->solve(delta);
+			if (solver_body_store) {
+				for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+					constraint_island[constraint_index]->solve_solver_bodies(delta, *solver_body_store);
+				}
+			} else {
+				for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+					constraint_island[constraint_index]->solve(delta);
+				}
 			}
 		}
 
@@ -156,6 +186,10 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 		}
 		constraint_count = priority_constraint_count;
 	}
+
+	if (solver_body_store) {
+		solver_body_store->write_back();
+	}
 }
 
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
@@ -204,6 +238,31 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	int active_count = 0;
 
 	const SelfList<GodotBody3D> *b = body_list->first();
+	if (p_space->is_threaded_integration_enabled()) {
+		// Flatten the active list so bodies can be integrated in parallel.
+		while (b) {
+			active_bodies.push_back(b->self());
+			b = b->next();
+		}
+	}
+
+	uint32_t active_body_count = active_bodies.size();
+	if (active_body_count > 0 && active_body_count >= (uint32_t)p_space->get_threaded_integration_minimum_bodies()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_forces, nullptr, active_body_count, -1, true, SNAME("Physics3DIntegrateForces"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		// Broadphase changes are applied in list order, so pairs are generated exactly as in the serial path.
+		for (uint32_t body_index = 0; body_index < active_body_count; ++body_index) {
+			active_bodies[body_index]->flush_broadphase_update();
+		}
+	} else {
+		for (uint32_t body_index = 0; body_index < active_body_count; ++body_index) {
+			active_bodies[body_index]->integrate_forces(p_delta);
+		}
+	}
+	active_count += active_body_count;
+
+	// Only reached when the list wasn't flattened above.
 	while (b) {
 		b->self()->integrate_forces(p_delta);
 		b = b->next();
@@ -362,6 +421,11 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
+	use_solver_bodies = p_space->is_using_solver_bodies();
+	if (use_solver_bodies && solver_body_stores.size() < island_count) {
+		solver_body_stores.resize(island_count);
+	}
+
 	// WARNING: `_solve_island` modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
@@ -403,6 +467,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	}
 
 	all_constraints.clear();
+	active_bodies.clear();
 
 	p_space->unlock();
 	_step++;
@@ -412,6 +477,7 @@ GodotStep3D::GodotStep3D() {
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
+	active_bodies.reserve(ACTIVE_BODY_COUNT_RESERVE);
 }
 
 GodotStep3D::~GodotStep3D() {
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "godot_solver_body_3d.h"
 #include "godot_space_3d.h"
 
 #include "core/templates/local_vector.h"
@@ -43,11 +44,17 @@ class GodotStep3D {
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
+	LocalVector<GodotBody3D *> active_bodies;
 
+	bool use_solver_bodies = false;
+	LocalVector<GodotSolverBodyStore3D> solver_body_stores;
+
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
+	bool _setup_solver_bodies(const LocalVector<GodotConstraint3D *> &p_constraint_island, GodotSolverBodyStore3D &r_store) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
 
@@ -0,0 +1,196 @@
+/**************************************************************************/
+/*  test_godot_step_3d.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "servers/physics_3d/physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotStep3D {
+
+struct ContactRecord {
+	int collider = -1; // Index of the colliding body in the scene.
+	Vector3 local_position;
+	Vector3 local_normal;
+	Vector3 collider_position;
+};
+
+struct StepRecord {
+	LocalVector<Transform3D> transforms;
+	LocalVector<LocalVector<ContactRecord>> contacts;
+};
+
+class TestScene {
+	RID space;
+	RID box_shape;
+	RID sphere_shape;
+	RID floor_shape;
+	LocalVector<RID> bodies; // The floor comes first.
+	HashMap<RID, int> body_indices;
+
+	RID _add_body(RID p_shape, PhysicsServer3D::BodyMode p_mode, const Transform3D &p_transform) {
+		PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+		RID body = ps->body_create();
+		ps->body_set_mode(body, p_mode);
+		ps->body_add_shape(body, p_shape);
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, p_transform);
+		ps->body_set_max_contacts_reported(body, 8);
+		ps->body_set_space(body, space);
+		body_indices.insert(body, bodies.size());
+		bodies.push_back(body);
+		return body;
+	}
+
+public:
+	StepRecord record() const {
+		PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+		StepRecord record;
+		record.contacts.resize(bodies.size());
+		for (uint32_t body = 0; body < bodies.size(); body++) {
+			PhysicsDirectBodyState3D *state = ps->body_get_direct_state(bodies[body]);
+			record.transforms.push_back(state->get_transform());
+
+			LocalVector<ContactRecord> &contacts = record.contacts[body];
+			for (int i = 0; i < state->get_contact_count(); i++) {
+				ContactRecord contact;
+				const int *collider = body_indices.getptr(state->get_contact_collider(i));
+				contact.collider = collider ? *collider : -1;
+				contact.local_position = state->get_contact_local_position(i);
+				contact.local_normal = state->get_contact_local_normal(i);
+				contact.collider_position = state->get_contact_collider_position(i);
+				contacts.push_back(contact);
+			}
+		}
+		return record;
+	}
+
+	// Spaces read the solver settings when they are created.
+	TestScene(bool p_threaded_integration) {
+		ProjectSettings *settings = ProjectSettings::get_singleton();
+		const Variant previous_threaded = settings->get_setting("physics/3d/solver/threaded_integration");
+		const Variant previous_minimum = settings->get_setting("physics/3d/solver/threaded_integration_minimum_bodies");
+		settings->set_setting("physics/3d/solver/threaded_integration", p_threaded_integration);
+		settings->set_setting("physics/3d/solver/threaded_integration_minimum_bodies", 1);
+
+		PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+		space = ps->space_create();
+		ps->space_set_active(space, true);
+		settings->set_setting("physics/3d/solver/threaded_integration", previous_threaded);
+		settings->set_setting("physics/3d/solver/threaded_integration_minimum_bodies", previous_minimum);
+
+		floor_shape = ps->world_boundary_shape_create();
+		ps->shape_set_data(floor_shape, Plane(Vector3(0, 1, 0), 0));
+		box_shape = ps->box_shape_create();
+		ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+		sphere_shape = ps->sphere_shape_create();
+		ps->shape_set_data(sphere_shape, 0.4);
+
+		_add_body(floor_shape, PhysicsServer3D::BODY_MODE_STATIC, Transform3D());
+		// Piles of slightly rotated boxes, with spheres dropped onto them.
+		for (int i = 0; i < 16; i++) {
+			for (int j = 0; j < 6; j++) {
+				const Basis basis = Basis(Vector3(0, 1, 0), (i * 6 + j) * 0.1);
+				_add_body(box_shape, PhysicsServer3D::BODY_MODE_RIGID, Transform3D(basis, Vector3((i % 4) * 2.5, 0.5 + j * 1.05, (i / 4) * 2.5)));
+			}
+			_add_body(sphere_shape, PhysicsServer3D::BODY_MODE_RIGID, Transform3D(Basis(), Vector3((i % 4) * 2.5 + 0.3, 9.0, (i / 4) * 2.5 - 0.2)));
+		}
+	}
+
+	~TestScene() {
+		PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+		for (const RID &body : bodies) {
+			ps->free_rid(body);
+		}
+		ps->free_rid(sphere_shape);
+		ps->free_rid(box_shape);
+		ps->free_rid(floor_shape);
+		ps->free_rid(space);
+	}
+};
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Threaded integration matches serial integration") {
+	const String engine = GLOBAL_GET("physics/3d/physics_engine");
+	if (engine != "DEFAULT" && engine != "GodotPhysics3D") {
+		return; // Only Godot Physics has threaded integration.
+	}
+
+	constexpr int STEPS = 120;
+	constexpr int RECORD_EVERY = 10;
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	// Each scene is stepped on its own, so the other one doesn't change the order of anything.
+	LocalVector<StepRecord> serial;
+	{
+		TestScene scene(false);
+		for (int i = 1; i <= STEPS; i++) {
+			ps->step(1.0 / 60.0);
+			if (i % RECORD_EVERY == 0) {
+				serial.push_back(scene.record());
+			}
+		}
+	}
+
+	LocalVector<StepRecord> threaded;
+	{
+		TestScene scene(true);
+		for (int i = 1; i <= STEPS; i++) {
+			ps->step(1.0 / 60.0);
+			if (i % RECORD_EVERY == 0) {
+				threaded.push_back(scene.record());
+			}
+		}
+	}
+
+	REQUIRE(serial.size() == threaded.size());
+	bool any_contact = false;
+	for (uint32_t record = 0; record < serial.size(); record++) {
+		const StepRecord &a = serial[record];
+		const StepRecord &b = threaded[record];
+		REQUIRE(a.transforms.size() == b.transforms.size());
+		for (uint32_t body = 0; body < a.transforms.size(); body++) {
+			CHECK_MESSAGE(a.transforms[body] == b.transforms[body], vformat("Body %d should have the same transform at step %d.", body, (record + 1) * RECORD_EVERY));
+
+			const LocalVector<ContactRecord> &contacts_a = a.contacts[body];
+			const LocalVector<ContactRecord> &contacts_b = b.contacts[body];
+			REQUIRE_MESSAGE(contacts_a.size() == contacts_b.size(), vformat("Body %d should have as many contacts at step %d.", body, (record + 1) * RECORD_EVERY));
+			for (uint32_t i = 0; i < contacts_a.size(); i++) {
+				CHECK(contacts_a[i].collider == contacts_b[i].collider);
+				CHECK(contacts_a[i].local_position == contacts_b[i].local_position);
+				CHECK(contacts_a[i].local_normal == contacts_b[i].local_normal);
+				CHECK(contacts_a[i].collider_position == contacts_b[i].collider_position);
+			}
+			any_contact = any_contact || !contacts_a.is_empty();
+		}
+	}
+	CHECK_MESSAGE(any_contact, "The scene should generate contact pairs to compare.");
+}
+
+} // namespace TestGodotStep3D
@@ -55,6 +55,7 @@ PointKey NavMapBuilder3D::get_point_key(const Vector3 &p_pos, const Vector3 &p_c
 
 void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 	PerformanceData &performance_data = r_build.performance_data;
+	NavMapIterationBuild3D::LinkCache &link_cache = r_build.link_cache;
 
 	performance_data.pm_polygon_count = 0;
 	performance_data.pm_edge_count = 0;
@@ -62,14 +63,32 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 	performance_data.pm_edge_connection_count = 0;
 	performance_data.pm_edge_free_count = 0;
 
+	// The link cache holds the edge connections of the previous build.
+	// Only regions that were added, removed, or that are linked with those need to be linked again.
+	// A cache invalidated by the previous build (e.g. after edge merge errors) still holds that build's
+	// regions, drop them so every region is linked again.
+	if (!link_cache.valid || link_cache.use_edge_connections != r_build.use_edge_connections || link_cache.edge_connection_margin != r_build.edge_connection_margin) {
+		link_cache.clear();
+	}
+	link_cache.use_edge_connections = r_build.use_edge_connections;
+	link_cache.edge_connection_margin = r_build.edge_connection_margin;
+
 	_build_step_gather_region_polygons(r_build);
 
-	_build_step_find_edge_connection_pairs(r_build);
+	if (!_build_step_find_edge_connection_pairs(r_build)) {
+		// Edges can not be merged incrementally when more than 2 edges occupy the same space.
+		// Link everything from scratch so the result is the same as with a full build.
+		link_cache.clear();
+		_build_step_gather_region_polygons(r_build);
+		_build_step_find_edge_connection_pairs(r_build);
+	}
 
 	_build_step_merge_edge_connection_pairs(r_build);
 
 	_build_step_edge_connection_margin_connections(r_build);
 
+	_build_step_gather_region_connections(r_build);
+
 	_build_step_navlink_connections(r_build);
 
 	_build_update_map_iteration(r_build);
@@ -78,55 +97,96 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 void NavMapBuilder3D::_build_step_gather_region_polygons(NavMapIterationBuild3D &r_build) {
 	PerformanceData &performance_data = r_build.performance_data;
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
+	NavMapIterationBuild3D::LinkCache &link_cache = r_build.link_cache;
 
 	const LocalVector<Ref<NavRegionIteration3D>> &regions = map_iteration->region_iterations;
-	HashMap<const NavBaseIteration3D *, LocalVector<Connection>> &region_external_connections = map_iteration->external_region_connections;
 
-	map_iteration->navbases_polygons_external_connections.clear();
+	r_build.iter_added_regions.clear();
+	r_build.iter_removed_regions.clear();
+	r_build.iter_edge_changed_regions.clear();
+	r_build.iter_dirty_regions.clear();
 
-	// Remove regions connections.
-	region_external_connections.clear();
+	// Region iterations are immutable, a region that changed has a new iteration.
+	HashSet<const NavBaseIteration3D *> current_regions;
+	current_regions.reserve(regions.size());
 
-	// Copy all region polygons in the map.
 	int polygon_count = 0;
 	for (const Ref<NavRegionIteration3D> &region : regions) {
-		const uint32_t polygons_size = region->navmesh_polygons.size();
-		polygon_count += polygons_size;
+		polygon_count += region->navmesh_polygons.size();
 
-		region_external_connections[region.ptr()] = LocalVector<Connection>();
-		map_iteration->navbases_polygons_external_connections[region.ptr()] = LocalVector<LocalVector<Connection>>();
-		map_iteration->navbases_polygons_external_connections[region.ptr()].resize(polygons_size);
+		current_regions.insert(region.ptr());
+		if (!link_cache.regions.has(region.ptr())) {
+			r_build.iter_added_regions.push_back(region);
+		}
+	}
+
+	for (const KeyValue<const NavBaseIteration3D *, NavMapRegionConnections3D> &E : link_cache.regions) {
+		if (!current_regions.has(E.key)) {
+			r_build.iter_removed_regions.insert(E.key);
+		}
 	}
 
 	performance_data.pm_polygon_count = polygon_count;
 	r_build.polygon_count = polygon_count;
 }
 
-void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build) {
-	PerformanceData &performance_data = r_build.performance_data;
-	NavMapIteration3D *map_iteration = r_build.map_iteration;
-	int polygon_count = r_build.polygon_count;
+bool NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build) {
+	NavMapIterationBuild3D::LinkCache &link_cache = r_build.link_cache;
+	HashSet<const NavBaseIteration3D *> &edge_changed_regions = r_build.iter_edge_changed_regions;
 
-	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
+	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = link_cache.connection_pairs_map;
 
-	// Group all edges per key.
-	connection_pairs_map.clear();
-	connection_pairs_map.reserve(polygon_count);
-	int free_edges_count = 0; // How many ConnectionPairs have only one Connection.
+	const bool incremental = link_cache.valid;
+	if (!incremental) {
+		connection_pairs_map.clear();
+		connection_pairs_map.reserve(r_build.polygon_count);
+	}
+
+	// Remove the edges of removed regions, the regions that shared those edges need to be relinked.
+	for (const NavBaseIteration3D *removed_region : r_build.iter_removed_regions) {
+		const NavMapRegionConnections3D &region_connections = link_cache.regions[removed_region];
+
+		for (const ConnectableEdge &connectable_edge : region_connections.region->get_external_edges()) {
+			HashMap<EdgeKey, EdgeConnectionPair, EdgeKey>::Iterator pair_it = connection_pairs_map.find(connectable_edge.ek);
+			if (!pair_it) {
+				continue;
+			}
+			EdgeConnectionPair &pair = pair_it->value;
+			for (int i = pair.size - 1; i >= 0; i--) {
+				if (pair.connections[i].polygon->owner == removed_region) {
+					pair.connections[i] = pair.connections[pair.size - 1];
+					--pair.size;
+				} else {
+					edge_changed_regions.insert(pair.connections[i].polygon->owner);
+				}
+			}
+			if (pair.size == 0) {
+				connection_pairs_map.remove(pair_it);
+			}
+		}
+	}
+
+	// Group the edges of added regions per key.
 	int edge_merge_error_count = 0;
 
-	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+	for (const Ref<NavRegionIteration3D> &region : r_build.iter_added_regions) {
+		NavMapRegionConnections3D &region_connections = link_cache.regions.insert(region.ptr(), NavMapRegionConnections3D())->value;
+		region_connections.region = region;
+		edge_changed_regions.insert(region.ptr());
+
 		for (const ConnectableEdge &connectable_edge : region->get_external_edges()) {
 			const EdgeKey &ek = connectable_edge.ek;
 
 			HashMap<EdgeKey, EdgeConnectionPair, EdgeKey>::Iterator pair_it = connection_pairs_map.find(ek);
 			if (!pair_it) {
 				pair_it = connection_pairs_map.insert(ek, EdgeConnectionPair());
-				performance_data.pm_edge_count += 1;
-				++free_edges_count;
 			}
 			EdgeConnectionPair &pair = pair_it->value;
 			if (pair.size < 2) {
+				if (pair.size == 1) {
+					edge_changed_regions.insert(pair.connections[0].polygon->owner);
+				}
+
 				// Add the polygon/edge tuple to this key.
 				Connection new_connection;
 				new_connection.polygon = &region->navmesh_polygons[connectable_edge.polygon_index];
@@ -136,9 +196,10 @@ void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuil
 
 				pair.connections[pair.size] = new_connection;
 				++pair.size;
-				if (pair.size == 2) {
-					--free_edges_count;
-				}
+
+			} else if (incremental) {
+				// Which of the edges ends up connected depends on the order they were added.
+				return false;
 
 			} else {
 				// The edge is already connected with another edge, skip.
@@ -151,123 +212,249 @@ void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuil
 		WARN_PRINT("Navigation map synchronization had " + itos(edge_merge_error_count) + " edge error(s).\nMore than 2 edges tried to occupy the same map rasterization space.\nThis causes a logical error in the navigation mesh geometry and is commonly caused by overlap or too densely placed edges.\nConsider baking with a higher 'cell_size', greater geometry margin, and less detailed bake objects to cause fewer edges.\nConsider lowering the 'navigation/3d/merge_rasterizer_cell_scale' in the project settings.\nThis warning can be toggled under 'navigation/3d/warnings/navmesh_edge_merge_errors' in the project settings.");
 	}
 
-	r_build.free_edge_count = free_edges_count;
+	// Removing one of the overlapping edges would need the skipped edges, always rebuild in that case.
+	// The regions are still needed by the following steps, the next build clears the cache.
+	link_cache.valid = edge_merge_error_count == 0;
+
+	r_build.performance_data.pm_edge_count = connection_pairs_map.size();
+
+	return true;
 }
 
 void NavMapBuilder3D::_build_step_merge_edge_connection_pairs(NavMapIterationBuild3D &r_build) {
-	PerformanceData &performance_data = r_build.performance_data;
+	NavMapIterationBuild3D::LinkCache &link_cache = r_build.link_cache;
 
-	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
-	LocalVector<Connection> &free_edges = r_build.iter_free_edges;
-	int free_edges_count = r_build.free_edge_count;
+	const HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = link_cache.connection_pairs_map;
 	bool use_edge_connections = r_build.use_edge_connections;
 
-	free_edges.clear();
-	free_edges.reserve(free_edges_count);
-
-	NavMapIteration3D *map_iteration = r_build.map_iteration;
+	// Update which edges are merged or free for the regions that had edges added or removed next to them.
+	for (const NavBaseIteration3D *edge_changed_region : r_build.iter_edge_changed_regions) {
+		if (r_build.iter_removed_regions.has(edge_changed_region)) {
+			continue;
+		}
+		NavMapRegionConnections3D &region_connections = link_cache.regions[edge_changed_region];
+		NavRegionIteration3D *region = region_connections.region.ptr();
 
-	HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
+		region_connections.free_edges.clear();
+		region_connections.merged_edge_count = 0;
 
-	for (const KeyValue<EdgeKey, EdgeConnectionPair> &pair_it : connection_pairs_map) {
-		const EdgeConnectionPair &pair = pair_it.value;
-		if (pair.size == 2) {
-			// Connect edge that are shared in different polygons.
-			const Connection &c1 = pair.connections[0];
-			const Connection &c2 = pair.connections[1];
-
-			navbases_polygons_external_connections[c1.polygon->owner][c1.polygon->id].push_back(c2);
-			navbases_polygons_external_connections[c2.polygon->owner][c2.polygon->id].push_back(c1);
-			performance_data.pm_edge_connection_count += 1;
-
-		} else {
-			CRASH_COND_MSG(pair.size != 1, vformat("Number of connection != 1. Found: %d", pair.size));
-			if (use_edge_connections && pair.connections[0].polygon->owner->get_use_edge_connections()) {
-				free_edges.push_back(pair.connections[0]);
+		for (const ConnectableEdge &connectable_edge : region->get_external_edges()) {
+			const EdgeConnectionPair *pair = connection_pairs_map.getptr(connectable_edge.ek);
+			if (pair == nullptr) {
+				continue;
+			}
+			const Polygon *polygon = &region->navmesh_polygons[connectable_edge.polygon_index];
+			if (pair->size == 2) {
+				if ((pair->connections[0].polygon == polygon && pair->connections[0].edge == connectable_edge.edge) || (pair->connections[1].polygon == polygon && pair->connections[1].edge == connectable_edge.edge)) {
+					region_connections.merged_edge_count++;
+				}
+			} else if (use_edge_connections && region->get_use_edge_connections()) {
+				region_connections.free_edges.push_back(pair->connections[0]);
 			}
 		}
 	}
 }
 
+bool NavMapBuilder3D::_get_edge_connection_margin_pathway(const Connection &p_free_edge, const Connection &p_other_edge, real_t p_edge_connection_margin_squared, Vector3 &r_pathway_start, Vector3 &r_pathway_end) {
+	const Vector3 &edge_p1 = p_free_edge.pathway_start;
+	const Vector3 &edge_p2 = p_free_edge.pathway_end;
+
+	const Vector3 &other_edge_p1 = p_other_edge.pathway_start;
+	const Vector3 &other_edge_p2 = p_other_edge.pathway_end;
+
+	// Compute the projection of the opposite edge on the current one
+	Vector3 edge_vector = edge_p2 - edge_p1;
+	real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
+	real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
+	if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
+		return false;
+	}
+
+	// Check if the two edges are close to each other enough and compute a pathway between the two regions.
+	Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
+	Vector3 other1;
+	if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
+		other1 = other_edge_p1;
+	} else {
+		other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+	}
+	if (other1.distance_squared_to(self1) > p_edge_connection_margin_squared) {
+		return false;
+	}
+
+	Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
+	Vector3 other2;
+	if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
+		other2 = other_edge_p2;
+	} else {
+		other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+	}
+	if (other2.distance_squared_to(self2) > p_edge_connection_margin_squared) {
+		return false;
+	}
+
+	r_pathway_start = (self1 + other1) / 2.0;
+	r_pathway_end = (self2 + other2) / 2.0;
+	return true;
+}
+
 void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapIterationBuild3D &r_build) {
-	PerformanceData &performance_data = r_build.performance_data;
-	NavMapIteration3D *map_iteration = r_build.map_iteration;
+	NavMapIterationBuild3D::LinkCache &link_cache = r_build.link_cache;
+
+	const HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = link_cache.connection_pairs_map;
+	const HashSet<const NavBaseIteration3D *> &removed_regions = r_build.iter_removed_regions;
+	const HashSet<const NavBaseIteration3D *> &edge_changed_regions = r_build.iter_edge_changed_regions;
+	HashSet<const NavBaseIteration3D *> &dirty_regions = r_build.iter_dirty_regions;
 
 	real_t edge_connection_margin = r_build.edge_connection_margin;
+	const real_t edge_connection_margin_squared = edge_connection_margin * edge_connection_margin;
 
-	LocalVector<Connection> &free_edges = r_build.iter_free_edges;
-	HashMap<const NavBaseIteration3D *, LocalVector<Connection>> &region_external_connections = map_iteration->external_region_connections;
+	for (const NavBaseIteration3D *edge_changed_region : edge_changed_regions) {
+		if (!removed_regions.has(edge_changed_region)) {
+			dirty_regions.insert(edge_changed_region);
+		}
+	}
 
-	HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
+	if (!removed_regions.is_empty() || !edge_changed_regions.is_empty()) {
+		Vector3 pathway_start;
+		Vector3 pathway_end;
 
-	// Find the compatible near edges.
+		for (const KeyValue<const NavBaseIteration3D *, NavMapRegionConnections3D> &E : link_cache.regions) {
+			if (dirty_regions.has(E.key) || removed_regions.has(E.key)) {
+				continue;
+			}
+			const NavMapRegionConnections3D &region_connections = E.value;
+
+			// Regions connected to free edges that are gone.
+			bool dirty = false;
+			for (const Connection &margin_connection : region_connections.margin_connections) {
+				const NavBaseIteration3D *owner = margin_connection.polygon->owner;
+				if (removed_regions.has(owner) || edge_changed_regions.has(owner)) {
+					dirty = true;
+					break;
+				}
+			}
+
+			// Regions that can connect to new free edges.
+			const AABB region_bounds = region_connections.region->get_bounds().grow(edge_connection_margin);
+			for (const NavBaseIteration3D *edge_changed_region : edge_changed_regions) {
+				if (dirty) {
+					break;
+				}
+				if (removed_regions.has(edge_changed_region)) {
+					continue;
+				}
+				const NavMapRegionConnections3D &other_connections = link_cache.regions[edge_changed_region];
+				if (other_connections.free_edges.is_empty() || !region_bounds.intersects_inclusive(other_connections.region->get_bounds())) {
+					continue;
+				}
+				for (const Connection &free_edge : region_connections.free_edges) {
+					for (const Connection &other_edge : other_connections.free_edges) {
+						if (_get_edge_connection_margin_pathway(free_edge, other_edge, edge_connection_margin_squared, pathway_start, pathway_end)) {
+							dirty = true;
+							break;
+						}
+					}
+					if (dirty) {
+						break;
+					}
+				}
+			}
+
+			if (dirty) {
+				dirty_regions.insert(E.key);
+			}
+		}
+	}
+
+	for (const NavBaseIteration3D *removed_region : removed_regions) {
+		link_cache.regions.erase(removed_region);
+	}
+
+	// Relink the dirty regions.
 	//
 	// Note:
 	// Considering that the edges must be compatible (for obvious reasons)
 	// to be connected, create new polygons to remove that small gap is
 	// not really useful and would result in wasteful computation during
 	// connection, integration and path finding.
-	performance_data.pm_edge_free_count = free_edges.size();
-
-	const real_t edge_connection_margin_squared = edge_connection_margin * edge_connection_margin;
+	for (const NavBaseIteration3D *dirty_region : dirty_regions) {
+		NavMapRegionConnections3D &region_connections = link_cache.regions[dirty_region];
+		NavRegionIteration3D *region = region_connections.region.ptr();
+
+		region_connections.polygons_connections.clear();
+		region_connections.polygons_connections.resize(region->navmesh_polygons.size());
+		region_connections.margin_connections.clear();
+
+		// Connect edges that are shared in different polygons.
+		if (region_connections.merged_edge_count > 0) {
+			for (const ConnectableEdge &connectable_edge : region->get_external_edges()) {
+				const EdgeConnectionPair *pair = connection_pairs_map.getptr(connectable_edge.ek);
+				if (pair == nullptr || pair->size != 2) {
+					continue;
+				}
+				const Polygon *polygon = &region->navmesh_polygons[connectable_edge.polygon_index];
+				if (pair->connections[0].polygon == polygon && pair->connections[0].edge == connectable_edge.edge) {
+					region_connections.polygons_connections[polygon->id].push_back(pair->connections[1]);
+				} else if (pair->connections[1].polygon == polygon && pair->connections[1].edge == connectable_edge.edge) {
+					region_connections.polygons_connections[polygon->id].push_back(pair->connections[0]);
+				}
+			}
+		}
 
-	for (uint32_t i = 0; i < free_edges.size(); i++) {
-		const Connection &free_edge = free_edges[i];
-		const Vector3 &edge_p1 = free_edge.pathway_start;
-		const Vector3 &edge_p2 = free_edge.pathway_end;
+		// Find the compatible near edges.
+		if (region_connections.free_edges.is_empty()) {
+			continue;
+		}
+		const AABB region_bounds = region->get_bounds().grow(edge_connection_margin);
 
-		for (uint32_t j = 0; j < free_edges.size(); j++) {
-			const Connection &other_edge = free_edges[j];
-			if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
+		for (const KeyValue<const NavBaseIteration3D *, NavMapRegionConnections3D> &E : link_cache.regions) {
+			const NavMapRegionConnections3D &other_connections = E.value;
+			if (E.key == dirty_region || other_connections.free_edges.is_empty() || !region_bounds.intersects_inclusive(other_connections.region->get_bounds())) {
 				continue;
 			}
 
-			const Vector3 &other_edge_p1 = other_edge.pathway_start;
-			const Vector3 &other_edge_p2 = other_edge.pathway_end;
+			for (const Connection &free_edge : region_connections.free_edges) {
+				for (const Connection &other_edge : other_connections.free_edges) {
+					// The edges can now be connected.
+					Connection new_connection = other_edge;
+					if (!_get_edge_connection_margin_pathway(free_edge, other_edge, edge_connection_margin_squared, new_connection.pathway_start, new_connection.pathway_end)) {
+						continue;
+					}
 
-			// Compute the projection of the opposite edge on the current one
-			Vector3 edge_vector = edge_p2 - edge_p1;
-			real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
-			real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
-			if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
-				continue;
+					region_connections.margin_connections.push_back(new_connection);
+					region_connections.polygons_connections[free_edge.polygon->id].push_back(new_connection);
+				}
 			}
+		}
+	}
+}
 
-			// Check if the two edges are close to each other enough and compute a pathway between the two regions.
-			Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
-			Vector3 other1;
-			if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
-				other1 = other_edge_p1;
-			} else {
-				other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-			}
-			if (other1.distance_squared_to(self1) > edge_connection_margin_squared) {
-				continue;
-			}
+void NavMapBuilder3D::_build_step_gather_region_connections(NavMapIterationBuild3D &r_build) {
+	PerformanceData &performance_data = r_build.performance_data;
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+	const NavMapIterationBuild3D::LinkCache &link_cache = r_build.link_cache;
 
-			Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
-			Vector3 other2;
-			if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
-				other2 = other_edge_p2;
-			} else {
-				other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-			}
-			if (other2.distance_squared_to(self2) > edge_connection_margin_squared) {
-				continue;
-			}
+	HashMap<const NavBaseIteration3D *, LocalVector<Connection>> &region_external_connections = map_iteration->external_region_connections;
+	HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
 
-			// The edges can now be connected.
-			Connection new_connection = other_edge;
-			new_connection.pathway_start = (self1 + other1) / 2.0;
-			new_connection.pathway_end = (self2 + other2) / 2.0;
-			//free_edge.polygon->connections.push_back(new_connection);
+	// Remove regions connections.
+	region_external_connections.clear();
+	navbases_polygons_external_connections.clear();
 
-			// Add the connection to the region_connection map.
-			region_external_connections[free_edge.polygon->owner].push_back(new_connection);
-			navbases_polygons_external_connections[free_edge.polygon->owner][free_edge.polygon->id].push_back(new_connection);
-			performance_data.pm_edge_connection_count += 1;
-		}
+	uint32_t merged_edge_count = 0;
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		const NavMapRegionConnections3D &region_connections = link_cache.regions[region.ptr()];
+
+		region_external_connections[region.ptr()] = region_connections.margin_connections;
+		navbases_polygons_external_connections[region.ptr()] = region_connections.polygons_connections;
+
+		merged_edge_count += region_connections.merged_edge_count;
+		performance_data.pm_edge_connection_count += region_connections.margin_connections.size();
+		performance_data.pm_edge_free_count += region_connections.free_edges.size();
 	}
+	// Each merged edge pair is counted by both of its regions.
+	performance_data.pm_edge_connection_count += merged_edge_count / 2;
 }
 
 void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_build) {
@@ -36,12 +36,15 @@ struct NavMapIterationBuild3D;
 
 class NavMapBuilder3D {
 	static void _build_step_gather_region_polygons(NavMapIterationBuild3D &r_build);
-	static void _build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build);
+	static bool _build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build);
 	static void _build_step_merge_edge_connection_pairs(NavMapIterationBuild3D &r_build);
 	static void _build_step_edge_connection_margin_connections(NavMapIterationBuild3D &r_build);
+	static void _build_step_gather_region_connections(NavMapIterationBuild3D &r_build);
 	static void _build_step_navlink_connections(NavMapIterationBuild3D &r_build);
 	static void _build_update_map_iteration(NavMapIterationBuild3D &r_build);
 
+	static bool _get_edge_connection_margin_pathway(const Nav3D::Connection &p_free_edge, const Nav3D::Connection &p_other_edge, real_t p_edge_connection_margin_squared, Vector3 &r_pathway_start, Vector3 &r_pathway_end);
+
 public:
 	static Nav3D::PointKey get_point_key(const Vector3 &p_pos, const Vector3 &p_cell_size);
 
@@ -37,12 +37,29 @@
 #include "core/math/math_defs.h"
 #include "core/os/rw_lock.h"
 #include "core/os/semaphore.h"
+#include "core/templates/hash_set.h"
 
 class NavLinkIteration3D;
 class NavRegion3D;
 class NavRegionIteration3D;
 struct NavMapIteration3D;
 
+// Edge linking results of a single region, kept between map builds so that
+// regions that did not change do not need to be linked again.
+struct NavMapRegionConnections3D {
+	// Keeps the region iteration (and the polygons that connections point to) alive.
+	Ref<NavRegionIteration3D> region;
+
+	// Edge and edge connection margin connections per polygon. Navlink connections are not included.
+	LocalVector<LocalVector<Nav3D::Connection>> polygons_connections;
+	// The connections made with the edge connection margin.
+	LocalVector<Nav3D::Connection> margin_connections;
+	// The external edges that are not merged with another edge and can use the edge connection margin.
+	LocalVector<Nav3D::Connection> free_edges;
+	// How many of the external edges are merged with another edge.
+	uint32_t merged_edge_count = 0;
+};
+
 struct NavMapIterationBuild3D {
 	Vector3 merge_rasterizer_cell_size;
 	bool use_edge_connections = true;
@@ -50,10 +67,29 @@ struct NavMapIterationBuild3D {
 	real_t link_connection_radius;
 	Nav3D::PerformanceData performance_data;
 	int polygon_count = 0;
-	int free_edge_count = 0;
 
-	HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> iter_connection_pairs_map;
-	LocalVector<Nav3D::Connection> iter_free_edges;
+	// Persists between builds, see NavMapBuilder3D::build_navmap_iteration().
+	struct LinkCache {
+		bool valid = false;
+		bool use_edge_connections = true;
+		real_t edge_connection_margin = 0.0;
+
+		HashMap<const NavBaseIteration3D *, NavMapRegionConnections3D> regions;
+		HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> connection_pairs_map;
+
+		void clear() {
+			valid = false;
+			regions.clear();
+			connection_pairs_map.clear();
+		}
+	} link_cache;
+
+	LocalVector<Ref<NavRegionIteration3D>> iter_added_regions;
+	HashSet<const NavBaseIteration3D *> iter_removed_regions;
+	// Regions whose merged or free edges changed.
+	HashSet<const NavBaseIteration3D *> iter_edge_changed_regions;
+	// Regions whose connections need to be rebuilt.
+	HashSet<const NavBaseIteration3D *> iter_dirty_regions;
 
 	NavMapIteration3D *map_iteration = nullptr;
 
@@ -62,10 +98,11 @@ struct NavMapIterationBuild3D {
 	void reset() {
 		performance_data.reset();
 
-		iter_connection_pairs_map.clear();
-		iter_free_edges.clear();
+		iter_added_regions.clear();
+		iter_removed_regions.clear();
+		iter_edge_changed_regions.clear();
+		iter_dirty_regions.clear();
 		polygon_count = 0;
-		free_edge_count = 0;
 
 		navmesh_polygon_count = 0;
 	}
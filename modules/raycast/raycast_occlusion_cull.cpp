@@ -53,6 +53,15 @@ void RaycastOcclusionCull::RaycastHZBuffer::clear() {
 	camera_ray_masks.clear();
 	camera_rays_tile_count = 0;
 	tile_grid_size = Size2i();
+
+	history_points.clear();
+	history_hits.clear();
+	reprojected_depths.clear();
+	reprojected_points.clear();
+	reprojected_hits.clear();
+	reused_tiles.clear();
+	history_valid = false;
+	has_reused_tiles = false;
 }
 
 void RaycastOcclusionCull::RaycastHZBuffer::resize(const Size2i &p_size) {
@@ -80,6 +89,17 @@ void RaycastOcclusionCull::RaycastHZBuffer::resize(const Size2i &p_size) {
 
 	camera_ray_masks.resize(camera_rays_tile_count * TILE_RAYS);
 	memset(camera_ray_masks.ptr(), ~0, camera_rays_tile_count * TILE_RAYS * sizeof(uint32_t));
+
+	int pixel_count = p_size.x * p_size.y;
+	history_points.resize(pixel_count);
+	history_hits.resize(pixel_count);
+	reprojected_depths.resize(pixel_count);
+	reprojected_points.resize(pixel_count);
+	reprojected_hits.resize(pixel_count);
+	reused_tiles.resize(camera_rays_tile_count);
+	memset(reused_tiles.ptr(), 0, camera_rays_tile_count * sizeof(uint8_t));
+	history_valid = false;
+	has_reused_tiles = false;
 }
 
 void RaycastOcclusionCull::RaycastHZBuffer::update_camera_rays(const Transform3D &p_cam_transform, const Vector3 &p_near_bottom_left, const Vector2 &p_near_extents, real_t p_z_far, bool p_cam_orthogonal) {
@@ -160,7 +180,131 @@ void RaycastOcclusionCull::RaycastHZBuffer::_generate_camera_rays(const CameraRa
 	}
 }
 
-void RaycastOcclusionCull::RaycastHZBuffer::sort_rays(const Vector3 &p_camera_dir, bool p_orthogonal) {
+void RaycastOcclusionCull::RaycastHZBuffer::_reset_reused_tiles() {
+	memset(camera_ray_masks.ptr(), ~0, camera_rays_tile_count * TILE_RAYS * sizeof(uint32_t));
+	memset(reused_tiles.ptr(), 0, camera_rays_tile_count * sizeof(uint8_t));
+	has_reused_tiles = false;
+}
+
+bool RaycastOcclusionCull::RaycastHZBuffer::reproject(const Transform3D &p_cam_transform, const Vector3 &p_near_bottom_left, const Vector2 &p_near_extents, real_t p_z_far, bool p_cam_orthogonal, uint64_t p_scenario_version) {
+	ERR_FAIL_COND_V(is_empty(), false);
+
+	bool can_reuse = history_valid && history_frames < TEMPORAL_MAX_HISTORY_FRAMES;
+	can_reuse = can_reuse && history_scenario_version == p_scenario_version; // Occluders changed.
+	can_reuse = can_reuse && history_orthogonal == p_cam_orthogonal && history_z_far == p_z_far && history_near_extents.is_equal_approx(p_near_extents);
+
+	if (can_reuse) {
+		// Large rotations move most of the buffer out of view, skip straight to a full trace.
+		Vector3 history_dir = -history_cam_transform.basis.get_column(2).normalized();
+		Vector3 camera_dir = -p_cam_transform.basis.get_column(2).normalized();
+		can_reuse = history_dir.dot(camera_dir) > TEMPORAL_MIN_DIRECTION_DOT;
+
+		// Reprojected hits lose precision as the camera moves away, and newly visible geometry
+		// at the borders is only found by tracing.
+		can_reuse = can_reuse && (p_cam_transform.origin - history_trace_origin).length() <= p_z_far * TEMPORAL_MAX_TRANSLATION;
+	}
+
+	history_cam_transform = p_cam_transform;
+	history_near_extents = p_near_extents;
+	history_z_far = p_z_far;
+	history_orthogonal = p_cam_orthogonal;
+	history_scenario_version = p_scenario_version;
+
+	if (!can_reuse) {
+		history_frames = 0;
+		history_trace_origin = p_cam_transform.origin;
+		if (has_reused_tiles) {
+			_reset_reused_tiles();
+		}
+		return false;
+	}
+
+	const Size2i &buffer_size = sizes[0];
+	const int pixel_count = buffer_size.x * buffer_size.y;
+	const Transform3D cam_inverse = p_cam_transform.affine_inverse();
+	const float z_near = -p_near_bottom_left.z;
+	const float miss_distance = p_z_far * 1.05f; // Same as the rays' tfar.
+	const Vector3 camera_dir = -p_cam_transform.basis.get_column(2).normalized();
+
+	for (int i = 0; i < pixel_count; i++) {
+		reprojected_depths[i] = -1.0f;
+	}
+
+	// Splat last frame's hit points into the new view, keeping the closest one per pixel.
+	// Rays that missed are splatted too, so open sky is reused as well. They are moved back to
+	// the far distance of the new view, otherwise moving forward would pull the sky closer.
+	for (int i = 0; i < pixel_count; i++) {
+		const Vector3 &point = history_points[i];
+		Vector3 view_point = cam_inverse.xform(point);
+		float depth = -view_point.z;
+		if (depth < z_near) {
+			continue;
+		}
+
+		Vector2 near_point = Vector2(view_point.x, view_point.y);
+		if (!p_cam_orthogonal) {
+			near_point *= z_near / depth;
+		}
+
+		int x = int(Math::floor((near_point.x - p_near_bottom_left.x) / p_near_extents.x * buffer_size.x));
+		int y = int(Math::floor((near_point.y - p_near_bottom_left.y) / p_near_extents.y * buffer_size.y));
+		if (x < 0 || y < 0 || x >= buffer_size.x || y >= buffer_size.y) {
+			continue;
+		}
+
+		float distance = p_cam_orthogonal ? depth : (point - p_cam_transform.origin).length();
+		Vector3 reprojected_point = point;
+		if (!history_hits[i]) {
+			if (p_cam_orthogonal) {
+				reprojected_point += camera_dir * (miss_distance - depth);
+			} else {
+				reprojected_point = p_cam_transform.origin + (point - p_cam_transform.origin) * (miss_distance / distance);
+			}
+			distance = miss_distance;
+		}
+
+		int pixel = y * buffer_size.x + x;
+		if (reprojected_depths[pixel] < 0.0f || distance < reprojected_depths[pixel]) {
+			reprojected_depths[pixel] = distance;
+			reprojected_points[pixel] = reprojected_point;
+			reprojected_hits[pixel] = history_hits[i];
+		}
+	}
+
+	// Any tile with a hole was disoccluded or magnified and has to be traced again.
+	memset(reused_tiles.ptr(), 1, camera_rays_tile_count * sizeof(uint8_t));
+	uint32_t retraced_tiles = 0;
+	for (int y = 0; y < buffer_size.y; y++) {
+		for (int x = 0; x < buffer_size.x; x++) {
+			if (reprojected_depths[y * buffer_size.x + x] >= 0.0f) {
+				continue;
+			}
+			int tile_index = (y / TILE_SIZE) * tile_grid_size.x + x / TILE_SIZE;
+			if (reused_tiles[tile_index]) {
+				reused_tiles[tile_index] = 0;
+				retraced_tiles++;
+			}
+		}
+	}
+
+	if (retraced_tiles > camera_rays_tile_count * TEMPORAL_MAX_RETRACED_TILES) {
+		// Too much changed for the reprojection to pay off.
+		history_frames = 0;
+		history_trace_origin = p_cam_transform.origin;
+		_reset_reused_tiles();
+		return false;
+	}
+
+	for (uint32_t i = 0; i < camera_rays_tile_count; i++) {
+		memset(&camera_ray_masks[i * TILE_RAYS], reused_tiles[i] ? 0 : ~0, TILE_RAYS * sizeof(uint32_t));
+	}
+
+	history_frames++;
+	has_reused_tiles = true;
+	return true;
+}
+
+void RaycastOcclusionCull::RaycastHZBuffer::sort_rays(const Vector3 &p_camera_dir, bool p_orthogonal, bool p_store_history) {
 	ERR_FAIL_COND(is_empty());
 
 	Size2i buffer_size = sizes[0];
@@ -175,12 +319,29 @@ void RaycastOcclusionCull::RaycastHZBuffer::sort_rays(const Vector3 &p_camera_di
 					}
 					int k = tile_i * TILE_SIZE + tile_j;
 					int tile_index = i * tile_grid_size.x + j;
+					int pixel = y * buffer_size.x + x;
+
+					if (has_reused_tiles && reused_tiles[tile_index]) {
+						mips[0][pixel] = reprojected_depths[pixel];
+						if (p_store_history) {
+							history_points[pixel] = reprojected_points[pixel];
+							history_hits[pixel] = reprojected_hits[pixel];
+						}
+						continue;
+					}
 
-					mips[0][y * buffer_size.x + x] = camera_rays[tile_index].ray.tfar[k];
+					const RTCRay16 &ray = camera_rays[tile_index].ray;
+					mips[0][pixel] = ray.tfar[k];
+					if (p_store_history) {
+						history_points[pixel] = Vector3(ray.org_x[k], ray.org_y[k], ray.org_z[k]) + Vector3(ray.dir_x[k], ray.dir_y[k], ray.dir_z[k]) * ray.tfar[k];
+						history_hits[pixel] = camera_rays[tile_index].hit.geomID[k] != RTC_INVALID_GEOMETRY_ID;
+					}
 				}
 			}
 		}
 	}
+
+	history_valid = p_store_history;
 }
 
 RaycastOcclusionCull::RaycastHZBuffer::~RaycastHZBuffer() {
@@ -413,6 +574,7 @@ void RaycastOcclusionCull::Scenario::update() {
 		if (commit_done) {
 			commit_thread->wait_to_finish();
 			current_scene_idx = 1 - current_scene_idx;
+			version++;
 		} else {
 			return;
 		}
@@ -613,9 +775,12 @@ void RaycastOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_
 	Vector3 near_bottom_left = Vector3(bottom_left.x, bottom_left.y, -p_cam_projection.get_z_near());
 
 	buffer.update_camera_rays(p_cam_transform, near_bottom_left, vp_rect.get_size(), p_cam_projection.get_z_far(), p_cam_orthogonal);
+	if (_temporal_reprojection_enabled) {
+		buffer.reproject(p_cam_transform, near_bottom_left, vp_rect.get_size(), p_cam_projection.get_z_far(), p_cam_orthogonal, scenario.version);
+	}
 
 	scenario.raycast(buffer.camera_rays, buffer.camera_ray_masks.ptr(), buffer.camera_rays_tile_count);
-	buffer.sort_rays(-p_cam_transform.basis.get_column(2), p_cam_orthogonal);
+	buffer.sort_rays(-p_cam_transform.basis.get_column(2), p_cam_orthogonal, _temporal_reprojection_enabled);
 	buffer.update_mips();
 }
 
@@ -659,6 +824,7 @@ RaycastOcclusionCull::RaycastOcclusionCull() {
 	raycast_singleton = this;
 	int default_quality = GLOBAL_GET("rendering/occlusion_culling/bvh_build_quality");
 	_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
+	_temporal_reprojection_enabled = GLOBAL_GET("rendering/occlusion_culling/temporal_reprojection");
 	build_quality = RSE::ViewportOcclusionCullingBuildQuality(default_quality);
 }
 
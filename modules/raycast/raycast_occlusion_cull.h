@@ -63,6 +63,26 @@ public:
 		void _camera_rays_threaded(uint32_t p_thread, const CameraRayThreadData *p_data);
 		void _generate_camera_rays(const CameraRayThreadData *p_data, int p_from, int p_to);
 
+		// Temporal reprojection, reuses last frame's hits for tiles that are still fully covered.
+		// Rays that missed are kept as misses, so they stay at the far distance of later frames.
+		LocalVector<Vector3> history_points;
+		LocalVector<uint8_t> history_hits;
+		LocalVector<float> reprojected_depths;
+		LocalVector<Vector3> reprojected_points;
+		LocalVector<uint8_t> reprojected_hits;
+		LocalVector<uint8_t> reused_tiles;
+		Transform3D history_cam_transform;
+		Vector3 history_trace_origin; // Camera position of the last full trace.
+		Vector2 history_near_extents;
+		real_t history_z_far = 0.0;
+		bool history_orthogonal = false;
+		uint64_t history_scenario_version = 0;
+		uint32_t history_frames = 0;
+		bool history_valid = false;
+		bool has_reused_tiles = false;
+
+		void _reset_reused_tiles();
+
 	public:
 		unsigned int camera_rays_tile_count = 0;
 		uint8_t *camera_rays_unaligned_buffer = nullptr;
@@ -72,8 +92,9 @@ public:
 
 		virtual void clear() override;
 		virtual void resize(const Size2i &p_size) override;
-		void sort_rays(const Vector3 &p_camera_dir, bool p_orthogonal);
+		void sort_rays(const Vector3 &p_camera_dir, bool p_orthogonal, bool p_store_history);
 		void update_camera_rays(const Transform3D &p_cam_transform, const Vector3 &p_near_bottom_left, const Vector2 &p_near_extents, real_t p_z_far, bool p_cam_orthogonal);
+		bool reproject(const Transform3D &p_cam_transform, const Vector3 &p_near_bottom_left, const Vector2 &p_near_extents, real_t p_z_far, bool p_cam_orthogonal, uint64_t p_scenario_version);
 
 		~RaycastHZBuffer();
 	};
@@ -129,6 +150,7 @@ private:
 		Thread *commit_thread = nullptr;
 		bool commit_done = true;
 		bool dirty = false;
+		uint64_t version = 0; // Increased every time a new scene is committed.
 
 		RTCScene ebr_scene[2] = { nullptr, nullptr };
 		int current_scene_idx = 0;
@@ -155,12 +177,19 @@ private:
 	static const int TILE_SIZE = 4;
 	static const int TILE_RAYS = TILE_SIZE * TILE_SIZE;
 
+	// Limits for reusing the previous frame's buffer before it is fully traced again.
+	static const uint32_t TEMPORAL_MAX_HISTORY_FRAMES = 8;
+	static constexpr float TEMPORAL_MIN_DIRECTION_DOT = 0.966f; // About 15 degrees of rotation.
+	static constexpr float TEMPORAL_MAX_RETRACED_TILES = 0.5f;
+	static constexpr float TEMPORAL_MAX_TRANSLATION = 0.02f; // Fraction of z_far since the last full trace.
+
 	RTCDevice ebr_device = nullptr;
 	RID_PtrOwner<Occluder> occluder_owner;
 	HashMap<RID, Scenario> scenarios;
 	HashMap<RID, RaycastHZBuffer> buffers;
 	RSE::ViewportOcclusionCullingBuildQuality build_quality;
 	bool _jitter_enabled = false;
+	bool _temporal_reprojection_enabled = false;
 
 	void _init_embree();
 	Vector2 _get_jitter(const Rect2 &p_viewport_rect, const Size2i &p_buffer_size);
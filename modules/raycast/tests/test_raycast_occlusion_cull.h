@@ -0,0 +1,182 @@
+/**************************************************************************/
+/*  test_raycast_occlusion_cull.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#pragma once
+
+#include "../raycast_occlusion_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRaycastOcclusionCull {
+
+// Traces the camera rays against an 8x8 wall 20 units in front of the origin,
+// so the reprojection can be tested without an Embree scene.
+class TestRaycastHZBuffer : public RaycastOcclusionCull::RaycastHZBuffer {
+	static constexpr int TILE_SIZE = 4; // Same as RaycastOcclusionCull::TILE_SIZE.
+
+public:
+	static constexpr real_t WALL_Z = -20.0;
+	static constexpr real_t WALL_HALF_SIZE = 4.0;
+
+	Transform3D cam_transform;
+	Projection projection;
+
+	bool update(bool p_temporal_reprojection) {
+		Size2 half_extents = projection.get_viewport_half_extents();
+		Vector3 near_bottom_left = Vector3(-half_extents.x, -half_extents.y, -projection.get_z_near());
+		Vector2 near_extents = half_extents * 2.0;
+
+		update_camera_rays(cam_transform, near_bottom_left, near_extents, projection.get_z_far(), false);
+		bool reused = p_temporal_reprojection && reproject(cam_transform, near_bottom_left, near_extents, projection.get_z_far(), false, 0);
+
+		for (uint32_t i = 0; i < camera_rays_tile_count; i++) {
+			RTCRayHit16 &tile = camera_rays[i];
+			for (int j = 0; j < TILE_SIZE * TILE_SIZE; j++) {
+				if (!camera_ray_masks[i * TILE_SIZE * TILE_SIZE + j]) {
+					continue;
+				}
+				Vector3 origin = Vector3(tile.ray.org_x[j], tile.ray.org_y[j], tile.ray.org_z[j]);
+				Vector3 dir = Vector3(tile.ray.dir_x[j], tile.ray.dir_y[j], tile.ray.dir_z[j]);
+				if (dir.z >= 0.0) {
+					continue;
+				}
+				float t = (WALL_Z - origin.z) / dir.z;
+				Vector3 hit = origin + dir * t;
+				if (t >= tile.ray.tnear[j] && t <= tile.ray.tfar[j] && Math::abs(hit.x) <= WALL_HALF_SIZE && Math::abs(hit.y) <= WALL_HALF_SIZE) {
+					tile.ray.tfar[j] = t;
+					tile.hit.geomID[j] = 0;
+				}
+			}
+		}
+
+		sort_rays(-cam_transform.basis.get_column(2), false, p_temporal_reprojection);
+		update_mips();
+		return reused;
+	}
+
+	bool is_traced(int p_x, int p_y) const {
+		int tile_index = (p_y / TILE_SIZE) * (sizes[0].x / TILE_SIZE) + p_x / TILE_SIZE;
+		int ray_index = (p_y % TILE_SIZE) * TILE_SIZE + p_x % TILE_SIZE;
+		return camera_ray_masks[tile_index * TILE_SIZE * TILE_SIZE + ray_index] != 0;
+	}
+
+	float get_depth(int p_x, int p_y) const {
+		return mips[0][p_y * sizes[0].x + p_x];
+	}
+
+	bool is_aabb_occluded(const AABB &p_aabb) const {
+		const real_t bounds[6] = {
+			p_aabb.position.x, p_aabb.position.y, p_aabb.position.z,
+			p_aabb.position.x + p_aabb.size.x, p_aabb.position.y + p_aabb.size.y, p_aabb.position.z + p_aabb.size.z
+		};
+		uint64_t timeout = 0;
+		return is_occluded(bounds, cam_transform.origin, cam_transform.affine_inverse(), projection, projection.get_z_near(), false, timeout);
+	}
+};
+
+const AABB BOX_BEHIND_WALL = AABB(Vector3(-0.5, -0.5, -30.5), Vector3(1, 1, 1));
+const AABB BOX_IN_SKY = AABB(Vector3(29, -1, -81), Vector3(2, 2, 2));
+
+TEST_CASE("[RaycastOcclusionCull] Temporal reprojection matches a full trace") {
+	TestRaycastHZBuffer buffer;
+	buffer.resize(Size2i(64, 64));
+	buffer.projection.set_perspective(60.0, 1.0, 0.1, 100.0);
+	const float miss_depth = buffer.projection.get_z_far() * 1.05f;
+
+	CHECK_FALSE_MESSAGE(buffer.update(true), "The first frame has no history and must be traced.");
+	CHECK(buffer.is_aabb_occluded(BOX_BEHIND_WALL));
+	CHECK_FALSE(buffer.is_aabb_occluded(BOX_IN_SKY));
+
+	SUBCASE("Pure translation") {
+		// Walk forward in steps of 0.5, the history may be kept for 2 units (2% of z_far).
+		for (int i = 1; i <= 4; i++) {
+			buffer.cam_transform.origin.z = -0.5 * i;
+			CHECK_MESSAGE(buffer.update(true), vformat("Frame %d should reuse the history.", i));
+			CHECK(buffer.is_aabb_occluded(BOX_BEHIND_WALL));
+			CHECK_FALSE(buffer.is_aabb_occluded(BOX_IN_SKY));
+
+			// The sky must stay at the far distance instead of following the camera.
+			int reused_sky_pixels = 0;
+			for (int y = 0; y < 64; y++) {
+				for (int x = 0; x < 64; x++) {
+					if (buffer.is_traced(x, y) || buffer.get_depth(x, y) < -TestRaycastHZBuffer::WALL_Z + 1.0) {
+						continue;
+					}
+					CHECK(buffer.get_depth(x, y) == doctest::Approx(miss_depth));
+					reused_sky_pixels++;
+				}
+			}
+			CHECK(reused_sky_pixels > 0);
+
+			// Reprojected wall hits keep their position in the world.
+			REQUIRE_FALSE(buffer.is_traced(32, 32));
+			CHECK(buffer.get_depth(32, 32) == doctest::Approx(-TestRaycastHZBuffer::WALL_Z - 0.5 * i).epsilon(0.01));
+		}
+
+		buffer.cam_transform.origin.z = -2.5;
+		CHECK_FALSE_MESSAGE(buffer.update(true), "Moving past the translation limit should trace everything again.");
+		CHECK(buffer.get_depth(0, 0) == doctest::Approx(miss_depth));
+		CHECK(buffer.is_aabb_occluded(BOX_BEHIND_WALL));
+		CHECK_FALSE(buffer.is_aabb_occluded(BOX_IN_SKY));
+
+		buffer.cam_transform.origin.z = -3.0;
+		CHECK_MESSAGE(buffer.update(true), "The history should be reused again after the full trace.");
+	}
+
+	SUBCASE("Rotation") {
+		buffer.cam_transform.basis = Basis(Vector3(0, 1, 0), Math::deg_to_rad(5.0));
+		CHECK_MESSAGE(buffer.update(true), "A small rotation should reuse the history.");
+		CHECK(buffer.is_aabb_occluded(BOX_BEHIND_WALL));
+		CHECK_FALSE(buffer.is_aabb_occluded(BOX_IN_SKY));
+
+		buffer.cam_transform.basis = Basis(Vector3(0, 1, 0), Math::deg_to_rad(25.0));
+		CHECK_FALSE_MESSAGE(buffer.update(true), "Rotating more than 15 degrees should trace everything again.");
+		for (int y = 0; y < 64; y++) {
+			for (int x = 0; x < 64; x++) {
+				REQUIRE(buffer.is_traced(x, y));
+			}
+		}
+
+		// Compare against a buffer that never reprojects.
+		TestRaycastHZBuffer reference;
+		reference.resize(Size2i(64, 64));
+		reference.projection = buffer.projection;
+		reference.cam_transform = buffer.cam_transform;
+		reference.update(false);
+		for (int y = 0; y < 64; y++) {
+			for (int x = 0; x < 64; x++) {
+				CHECK(buffer.get_depth(x, y) == reference.get_depth(x, y));
+			}
+		}
+		CHECK(buffer.is_aabb_occluded(BOX_BEHIND_WALL) == reference.is_aabb_occluded(BOX_BEHIND_WALL));
+		CHECK(buffer.is_aabb_occluded(BOX_IN_SKY) == reference.is_aabb_occluded(BOX_IN_SKY));
+	}
+}
+
+} // namespace TestRaycastOcclusionCull
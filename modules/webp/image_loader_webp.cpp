@@ -67,4 +67,5 @@ ImageLoaderWebP::ImageLoaderWebP() {
 	Image::webp_lossy_packer = WebPCommon::_webp_lossy_pack;
 	Image::webp_lossless_packer = WebPCommon::_webp_lossless_pack;
 	Image::webp_unpacker = WebPCommon::_webp_unpack;
+	Image::webp_unpacker_ptr = WebPCommon::_webp_unpack_ptr;
 }
@@ -40,5 +40,6 @@ Vector<uint8_t> _webp_lossless_pack(const Ref<Image> &p_image);
 Vector<uint8_t> _webp_packer(const Ref<Image> &p_image, float p_quality, bool p_lossless);
 // Given a WebP file, unpack it into an image.
 Ref<Image> _webp_unpack(const Vector<uint8_t> &p_buffer);
+Ref<Image> _webp_unpack_ptr(const uint8_t *p_buffer, int p_size);
 Error webp_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len);
 } //namespace WebPCommon
@@ -33,6 +33,7 @@
 #include "core/io/certs_compressed.gen.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/heap_profiler.h"
 #include "core/os/main_loop.h"
 #include "core/os/os.h"
 #include "core/profiling/profiling.h"
@@ -78,6 +79,12 @@
 #include <dlfcn.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+
+#ifdef CRASH_HANDLER_ENABLED
+#include <cxxabi.h>
+#include <execinfo.h>
+#include <cstdlib>
+#endif
 #include <sys/utsname.h>
 #include <unistd.h>
 #include <cstdio>
@@ -157,8 +164,35 @@ void OS_LinuxBSD::alert(const String &p_alert, const String &p_title) {
 	}
 }
 
+#ifdef CRASH_HANDLER_ENABLED
+static int _heap_profiler_capture(void **r_frames, int p_max_frames) {
+	return backtrace(r_frames, p_max_frames);
+}
+
+static String _heap_profiler_symbolize(void *p_address) {
+	Dl_info info;
+	if (!dladdr(p_address, &info)) {
+		return String::num_uint64((uint64_t)p_address, 16);
+	}
+
+	if (info.dli_sname) {
+		int status = 0;
+		char *demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+		const String name = String::utf8(status == 0 ? demangled : info.dli_sname);
+		std::free(demangled);
+		return vformat("%s+0x%x", name, (uint64_t)p_address - (uint64_t)info.dli_saddr);
+	}
+
+	// Not exported, print the module offset so it can be resolved with addr2line.
+	return vformat("%s+0x%x", String::utf8(info.dli_fname), (uint64_t)p_address - (uint64_t)info.dli_fbase);
+}
+#endif // CRASH_HANDLER_ENABLED
+
 void OS_LinuxBSD::initialize() {
 	crash_handler.initialize();
+#ifdef CRASH_HANDLER_ENABLED
+	HeapProfiler::set_backtrace_functions(&_heap_profiler_capture, &_heap_profiler_symbolize);
+#endif
 
 	OS_Unix::initialize_core();
 
@@ -3606,6 +3606,9 @@ void TileMapLayer::navmesh_parse_source_geometry(const Ref<NavigationPolygon> &p
 
 TileMapLayer::TileMapLayer() {
 	set_notify_transform(true);
+
+	// Rendering quadrants don't move, let the renderer only visit the visible ones.
+	RenderingServer::get_singleton()->canvas_item_set_use_spatial_index(get_canvas_item(), true);
 }
 
 TileMapLayer::~TileMapLayer() {
@@ -324,18 +324,21 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				continue;
 			}
 
+			// Decode straight from the file's memory when it can be viewed (e.g. a mapped pack) instead of copying it first.
 			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
+			Span<uint8_t> view = f->get_buffer_view(size);
+			if (view.is_empty()) {
+				pv.resize(size);
 				uint8_t *wr = pv.ptrw();
 				f->get_buffer(wr, size);
+				view = pv.span();
 			}
 
 			Ref<Image> img;
-			if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
-				img = Image::png_unpacker(pv);
-			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
-				img = Image::webp_unpacker(pv);
+			if (data_format == DATA_FORMAT_PNG && Image::_png_mem_unpacker_func) {
+				img = Image::_png_mem_unpacker_func(view.ptr(), view.size());
+			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker_ptr) {
+				img = Image::webp_unpacker_ptr(view.ptr(), view.size());
 			}
 
 			if (img.is_null() || img->is_empty()) {
@@ -406,13 +409,15 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			return Ref<Image>();
 		}
 		Vector<uint8_t> pv;
-		pv.resize(size);
-		{
+		Span<uint8_t> view = f->get_buffer_view(size);
+		if (view.is_empty()) {
+			pv.resize(size);
 			uint8_t *wr = pv.ptrw();
 			f->get_buffer(wr, size);
+			view = pv.span();
 		}
 		Ref<Image> img;
-		img = Image::basis_universal_unpacker(pv);
+		img = Image::basis_universal_unpacker_ptr(view.ptr(), view.size());
 		if (img.is_null() || img->is_empty()) {
 			ERR_FAIL_COND_V(img.is_null() || img->is_empty(), Ref<Image>());
 		}
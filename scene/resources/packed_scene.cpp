@@ -152,7 +152,7 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
-Node *SceneState::instantiate(GenEditState p_edit_state) const {
+Node *SceneState::instantiate(GenEditState p_edit_state, Node **r_prebuilt_instances, SafeNumeric<uint32_t> *r_progress) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
 
@@ -225,6 +225,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
 		bool is_inherited_scene = false;
+		bool keep_unique_scene_id = false;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			// Scene inheritance on root node.
@@ -262,7 +263,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			} else {
 				Ref<Resource> res = props[n.instance & FLAG_MASK];
 				Ref<PackedScene> sdata = res;
-				if (sdata.is_valid()) {
+				if (r_prebuilt_instances && r_prebuilt_instances[i]) {
+					// Already instantiated on a worker thread.
+					node = r_prebuilt_instances[i];
+					r_prebuilt_instances[i] = nullptr;
+				} else if (sdata.is_valid()) {
 					node = sdata->instantiate(p_edit_state == GEN_EDIT_STATE_DISABLED ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE);
 					ERR_FAIL_NULL_V_MSG(node, nullptr, vformat("Failed to load scene dependency: \"%s\". Make sure the required scene is valid.", sdata->get_path()));
 				} else if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
@@ -303,7 +308,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 							// This may be a scene that did not originally have ids and
 							// was saved before the parent, so force the id to match the
 							// parent scene node id.
-							ids.write[i] = node->get_unique_scene_id();
+							// The same state may be instantiated concurrently from worker threads,
+							// so the fix is only written back from the main thread.
+							if (Thread::is_main_thread()) {
+								ids.write[i] = node->get_unique_scene_id();
+							}
+							keep_unique_scene_id = true;
 						}
 					}
 				}
@@ -355,7 +365,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		}
 
 		if (node) {
-			if (i < ids.size()) {
+			if (i < ids.size() && !keep_unique_scene_id) {
 				node->set_unique_scene_id(ids[i]);
 			}
 			// may not have found the node (part of instantiated scene and removed)
@@ -592,6 +602,10 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			NodePath n2 = ret_nodes[0]->get_path_to(node);
 			node_path_cache[n2] = i;
 		}
+
+		if (r_progress) {
+			r_progress->increment();
+		}
 	}
 
 	for (const DeferredNodePathProperties &dnp : deferred_node_paths) {
@@ -2527,6 +2541,116 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+void PackedScene::ThreadedInstantiation::_prebuild(uint32_t p_index, void *p_userdata) {
+	int node_idx = prebuild_nodes[p_index];
+	Ref<PackedScene> sdata = state->get_node_instance(node_idx);
+	if (sdata.is_valid()) {
+		// If this fails, the assembly step will try again and report the error.
+		prebuilt[node_idx] = sdata->instantiate();
+	}
+	progress.increment();
+}
+
+void PackedScene::ThreadedInstantiation::_assemble(void *p_userdata) {
+	result = state->instantiate(SceneState::GEN_EDIT_STATE_DISABLED, prebuilt.ptr(), &progress);
+
+	// Sub-scenes that weren't used, because the instantiation failed or their parent vanished.
+	for (Node *node : prebuilt) {
+		if (node) {
+			memdelete(node);
+		}
+	}
+	prebuilt.clear();
+
+	if (result) {
+		if (!scene_file_path.is_empty()) {
+			result->set_scene_file_path(scene_file_path);
+		}
+		result->notification(Node::NOTIFICATION_SCENE_INSTANTIATED);
+	}
+}
+
+int64_t PackedScene::instantiate_threaded_request() {
+	ERR_FAIL_COND_V_MSG(!can_instantiate(), -1, "Can't instantiate an empty scene.");
+
+	ThreadedInstantiation *ti = memnew(ThreadedInstantiation);
+	ti->state = state;
+	ti->scene_file_path = is_built_in() ? String() : get_path();
+
+	// Sub-scene instances don't depend on anything else in the scene, so they can be built in parallel,
+	// detached from the tree. The rest of the scene is put together afterwards, in a single task.
+	int node_count = state->get_node_count();
+	ti->prebuilt.resize_initialized(node_count);
+	for (int i = 1; i < node_count; i++) {
+		if (state->get_node_instance(i).is_valid()) {
+			ti->prebuild_nodes.push_back(i);
+		}
+	}
+	ti->progress_total = ti->prebuild_nodes.size() + node_count;
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	String description = vformat("Instantiate scene: %s", get_path());
+	if (ti->prebuild_nodes.is_empty()) {
+		ti->assemble_task = pool->add_template_task(ti, &ThreadedInstantiation::_assemble, nullptr, false, description);
+	} else {
+		ti->prebuild_group = pool->add_template_group_task(ti, &ThreadedInstantiation::_prebuild, nullptr, ti->prebuild_nodes.size(), -1, false, description);
+		ti->assemble_task = pool->add_template_task(ti, &ThreadedInstantiation::_assemble, nullptr, false, description, Span<WorkerThreadPool::TaskID>(&ti->prebuild_group, 1));
+	}
+
+	MutexLock lock(threaded_instantiation_mutex);
+	int64_t id = ++last_threaded_instantiation;
+	threaded_instantiations.insert(id, ti);
+	return id;
+}
+
+PackedScene::InstantiationStatus PackedScene::instantiate_threaded_get_status(int64_t p_request, Array r_progress) {
+	ThreadedInstantiation *ti = nullptr;
+	{
+		MutexLock lock(threaded_instantiation_mutex);
+		ThreadedInstantiation **tip = threaded_instantiations.getptr(p_request);
+		if (!tip) {
+			return INSTANTIATION_STATUS_INVALID;
+		}
+		ti = *tip;
+	}
+
+	if (r_progress.size() < 1) {
+		r_progress.resize(1);
+	}
+	r_progress[0] = MIN(1.0f, (float)ti->progress.get() / MAX(1u, ti->progress_total));
+
+	if (!WorkerThreadPool::get_singleton()->is_task_completed(ti->assemble_task)) {
+		return INSTANTIATION_STATUS_IN_PROGRESS;
+	}
+	return ti->result ? INSTANTIATION_STATUS_DONE : INSTANTIATION_STATUS_FAILED;
+}
+
+Node *PackedScene::instantiate_threaded_get(int64_t p_request) {
+	ThreadedInstantiation *ti = nullptr;
+	{
+		MutexLock lock(threaded_instantiation_mutex);
+		ThreadedInstantiation **tip = threaded_instantiations.getptr(p_request);
+		ERR_FAIL_NULL_V_MSG(tip, nullptr, "Invalid threaded instantiation request ID.");
+		ti = *tip;
+		threaded_instantiations.erase(p_request);
+	}
+
+	Node *result = _finish_threaded_instantiation(ti);
+	ERR_FAIL_NULL_V_MSG(result, nullptr, vformat("Failed to instantiate scene \"%s\" on worker threads.", get_path()));
+	return result;
+}
+
+Node *PackedScene::_finish_threaded_instantiation(ThreadedInstantiation *p_ti) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	pool->wait_for_task_completion(p_ti->assemble_task);
+	if (p_ti->prebuild_group != WorkerThreadPool::INVALID_TASK_ID) {
+		pool->wait_for_group_task_completion(p_ti->prebuild_group); // Already done; this releases it.
+	}
+	Node *result = p_ti->result;
+	memdelete(p_ti);
+	return result;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 	state = p_by;
 	state->set_path(get_path());
@@ -2614,6 +2738,9 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
+	ClassDB::bind_method(D_METHOD("instantiate_threaded_request"), &PackedScene::instantiate_threaded_request);
+	ClassDB::bind_method(D_METHOD("instantiate_threaded_get_status", "request_id", "progress"), &PackedScene::instantiate_threaded_get_status, DEFVAL(Array()));
+	ClassDB::bind_method(D_METHOD("instantiate_threaded_get", "request_id"), &PackedScene::instantiate_threaded_get);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
@@ -2624,8 +2751,23 @@ void PackedScene::_bind_methods() {
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_INSTANCE);
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_MAIN);
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_MAIN_INHERITED);
+
+	BIND_ENUM_CONSTANT(INSTANTIATION_STATUS_INVALID);
+	BIND_ENUM_CONSTANT(INSTANTIATION_STATUS_IN_PROGRESS);
+	BIND_ENUM_CONSTANT(INSTANTIATION_STATUS_FAILED);
+	BIND_ENUM_CONSTANT(INSTANTIATION_STATUS_DONE);
 }
 
 PackedScene::PackedScene() {
 	state.instantiate();
 }
+
+PackedScene::~PackedScene() {
+	// Requests that were never collected.
+	for (KeyValue<int64_t, ThreadedInstantiation *> &E : threaded_instantiations) {
+		Node *result = _finish_threaded_instantiation(E.value);
+		if (result) {
+			memdelete(result);
+		}
+	}
+}
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/main/node.h"
 
 class PackedScene;
@@ -160,7 +161,9 @@ public:
 	Error copy_from(const Ref<SceneState> &p_scene_state);
 
 	bool can_instantiate() const;
-	Node *instantiate(GenEditState p_edit_state) const;
+	// If given, `r_prebuilt_instances` has an entry per node. Non-null entries are used (and cleared)
+	// instead of instantiating the sub-scene of that node.
+	Node *instantiate(GenEditState p_edit_state, Node **r_prebuilt_instances = nullptr, SafeNumeric<uint32_t> *r_progress = nullptr) const;
 
 	Array setup_resources_in_array(Array &array_to_scan, const SceneState::NodeData &n, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *node, const StringName sname, int i, Node **ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Dictionary setup_resources_in_dictionary(Dictionary &p_dictionary_to_scan, const SceneState::NodeData &p_n, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *p_node, const StringName p_sname, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
@@ -249,6 +252,27 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	struct ThreadedInstantiation {
+		Ref<SceneState> state;
+		String scene_file_path;
+		LocalVector<int> prebuild_nodes; // Nodes whose sub-scenes are instantiated in parallel.
+		LocalVector<Node *> prebuilt; // One entry per node.
+		SafeNumeric<uint32_t> progress;
+		uint32_t progress_total = 0;
+		WorkerThreadPool::GroupID prebuild_group = WorkerThreadPool::INVALID_TASK_ID;
+		WorkerThreadPool::TaskID assemble_task = WorkerThreadPool::INVALID_TASK_ID;
+		Node *result = nullptr;
+
+		void _prebuild(uint32_t p_index, void *p_userdata);
+		void _assemble(void *p_userdata);
+	};
+
+	BinaryMutex threaded_instantiation_mutex;
+	HashMap<int64_t, ThreadedInstantiation *> threaded_instantiations;
+	int64_t last_threaded_instantiation = 0;
+
+	static Node *_finish_threaded_instantiation(ThreadedInstantiation *p_ti);
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -265,6 +289,13 @@ public:
 		GEN_EDIT_STATE_MAIN_INHERITED,
 	};
 
+	enum InstantiationStatus {
+		INSTANTIATION_STATUS_INVALID,
+		INSTANTIATION_STATUS_IN_PROGRESS,
+		INSTANTIATION_STATUS_FAILED,
+		INSTANTIATION_STATUS_DONE,
+	};
+
 	Error pack(Node *p_scene);
 
 	void clear();
@@ -272,6 +303,10 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
+	int64_t instantiate_threaded_request();
+	InstantiationStatus instantiate_threaded_get_status(int64_t p_request, Array r_progress = Array());
+	Node *instantiate_threaded_get(int64_t p_request);
+
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
@@ -291,6 +326,8 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
+VARIANT_ENUM_CAST(PackedScene::InstantiationStatus)
@@ -1153,6 +1153,9 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_separation", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.05);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_allowed_penetration", PROPERTY_HINT_RANGE, "0.001,0.1,0.001,or_greater"), 0.01);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/default_contact_bias", PROPERTY_HINT_RANGE, "0,1,0.01"), 0.8);
+	GLOBAL_DEF("physics/3d/solver/threaded_integration", false);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/solver/threaded_integration_minimum_bodies", PROPERTY_HINT_RANGE, "1,65536,1,or_greater"), 512);
+	GLOBAL_DEF("physics/3d/solver/use_packed_solver_bodies", false);
 }
 
 PhysicsServer3D::~PhysicsServer3D() {
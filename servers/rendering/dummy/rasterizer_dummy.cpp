@@ -42,6 +42,14 @@
 #include "servers/rendering/dummy/storage/texture_storage.h"
 #include "servers/rendering/dummy/storage/utilities.h"
 
+void RasterizerDummy::begin_frame(double frame_step) {
+	frame++;
+	delta = frame_step;
+	time += frame_step;
+
+	utilities->_capture_timestamps_begin();
+}
+
 void RasterizerDummy::end_frame(bool p_present) {
 	if (p_present) {
 		DisplayServer::get_singleton()->swap_buffers();
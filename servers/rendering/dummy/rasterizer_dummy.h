@@ -82,11 +82,7 @@ public:
 	void set_boot_image_with_stretch(const Ref<Image> &p_image, const Color &p_color, RSE::SplashStretchMode p_stretch_mode, bool p_use_filter = true) override {}
 
 	void initialize() override {}
-	void begin_frame(double frame_step) override {
-		frame++;
-		delta = frame_step;
-		time += frame_step;
-	}
+	void begin_frame(double frame_step) override;
 
 	void blit_render_targets_to_screen(int p_screen, const RenderingServerTypes::BlitToScreen *p_render_targets, int p_amount) override {}
 
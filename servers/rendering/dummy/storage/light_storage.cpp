@@ -47,7 +47,10 @@ LightStorage::~LightStorage() {
 }
 
 bool LightStorage::free(RID p_rid) {
-	if (owns_lightmap(p_rid)) {
+	if (owns_light(p_rid)) {
+		light_free(p_rid);
+		return true;
+	} else if (owns_lightmap(p_rid)) {
 		lightmap_free(p_rid);
 		return true;
 	} else if (owns_lightmap_instance(p_rid)) {
@@ -58,6 +61,153 @@ bool LightStorage::free(RID p_rid) {
 	return false;
 }
 
+/* LIGHT API */
+
+void LightStorage::_light_initialize(RID p_rid, RSE::LightType p_type) {
+	if (p_rid.is_null()) {
+		return; // Not tracked.
+	}
+
+	Light light;
+	light.type = p_type;
+
+	light.param[RSE::LIGHT_PARAM_ENERGY] = 1.0;
+	light.param[RSE::LIGHT_PARAM_INDIRECT_ENERGY] = 1.0;
+	light.param[RSE::LIGHT_PARAM_VOLUMETRIC_FOG_ENERGY] = 1.0;
+	light.param[RSE::LIGHT_PARAM_SPECULAR] = 0.5;
+	light.param[RSE::LIGHT_PARAM_RANGE] = 1.0;
+	light.param[RSE::LIGHT_PARAM_SIZE] = 0.0;
+	light.param[RSE::LIGHT_PARAM_ATTENUATION] = 1.0;
+	light.param[RSE::LIGHT_PARAM_SPOT_ANGLE] = 45;
+	light.param[RSE::LIGHT_PARAM_SPOT_ATTENUATION] = 1.0;
+	light.param[RSE::LIGHT_PARAM_SHADOW_MAX_DISTANCE] = 0;
+	light.param[RSE::LIGHT_PARAM_SHADOW_SPLIT_1_OFFSET] = 0.1;
+	light.param[RSE::LIGHT_PARAM_SHADOW_SPLIT_2_OFFSET] = 0.3;
+	light.param[RSE::LIGHT_PARAM_SHADOW_SPLIT_3_OFFSET] = 0.6;
+	light.param[RSE::LIGHT_PARAM_SHADOW_FADE_START] = 0.8;
+	light.param[RSE::LIGHT_PARAM_SHADOW_NORMAL_BIAS] = 1.0;
+	light.param[RSE::LIGHT_PARAM_SHADOW_OPACITY] = 1.0;
+	light.param[RSE::LIGHT_PARAM_SHADOW_BIAS] = 0.02;
+	light.param[RSE::LIGHT_PARAM_SHADOW_BLUR] = 0;
+	light.param[RSE::LIGHT_PARAM_SHADOW_PANCAKE_SIZE] = 20.0;
+	light.param[RSE::LIGHT_PARAM_TRANSMITTANCE_BIAS] = 0.05;
+	light.param[RSE::LIGHT_PARAM_INTENSITY] = p_type == RSE::LIGHT_DIRECTIONAL ? 100000.0 : 1000.0;
+
+	light_owner.initialize_rid(p_rid, light);
+}
+
+void LightStorage::light_free(RID p_rid) {
+	Light *light = light_owner.get_or_null(p_rid);
+	ERR_FAIL_NULL(light);
+	light->dependency.deleted_notify(p_rid);
+	light_owner.free(p_rid);
+}
+
+void LightStorage::light_set_param(RID p_light, RSE::LightParam p_param, float p_value) {
+	if (p_light.is_null()) {
+		return; // Not tracked.
+	}
+
+	Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL(light);
+	ERR_FAIL_INDEX(p_param, RSE::LIGHT_PARAM_MAX);
+
+	if (light->param[p_param] == p_value) {
+		return;
+	}
+
+	switch (p_param) {
+		case RSE::LIGHT_PARAM_RANGE:
+		case RSE::LIGHT_PARAM_SPOT_ANGLE: {
+			light->version++;
+			light->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_LIGHT);
+		} break;
+		default: {
+		}
+	}
+
+	light->param[p_param] = p_value;
+}
+
+void LightStorage::light_set_cull_mask(RID p_light, uint32_t p_mask) {
+	if (p_light.is_null()) {
+		return; // Not tracked.
+	}
+
+	Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL(light);
+
+	light->cull_mask = p_mask;
+
+	light->version++;
+	light->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_LIGHT);
+}
+
+RSE::LightType LightStorage::light_get_type(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL_V(light, RSE::LIGHT_DIRECTIONAL);
+
+	return light->type;
+}
+
+AABB LightStorage::light_get_aabb(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL_V(light, AABB());
+
+	switch (light->type) {
+		case RSE::LIGHT_SPOT: {
+			float len = light->param[RSE::LIGHT_PARAM_RANGE];
+			float angle = Math::deg_to_rad(light->param[RSE::LIGHT_PARAM_SPOT_ANGLE]);
+
+			if (angle > Math::PI * 0.5) {
+				// Light casts backwards as well.
+				return AABB(Vector3(-1, -1, -1) * len, Vector3(2, 2, 2) * len);
+			}
+
+			float size = Math::sin(angle) * len;
+			return AABB(Vector3(-size, -size, -len), Vector3(size * 2, size * 2, len));
+		};
+		case RSE::LIGHT_OMNI: {
+			float r = light->param[RSE::LIGHT_PARAM_RANGE];
+			return AABB(-Vector3(r, r, r), Vector3(r, r, r) * 2);
+		};
+		case RSE::LIGHT_DIRECTIONAL: {
+			return AABB();
+		};
+	}
+
+	ERR_FAIL_V(AABB());
+}
+
+float LightStorage::light_get_param(RID p_light, RSE::LightParam p_param) {
+	const Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL_V(light, 0.0);
+	ERR_FAIL_INDEX_V(p_param, RSE::LIGHT_PARAM_MAX, 0.0);
+
+	return light->param[p_param];
+}
+
+uint64_t LightStorage::light_get_version(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL_V(light, 0);
+
+	return light->version;
+}
+
+uint32_t LightStorage::light_get_cull_mask(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL_V(light, 0);
+
+	return light->cull_mask;
+}
+
+Dependency *LightStorage::light_get_dependency(RID p_light) const {
+	Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL_V(light, nullptr);
+
+	return &light->dependency;
+}
+
 /* LIGHTMAP API */
 
 RID LightStorage::lightmap_allocate() {
@@ -33,12 +33,27 @@
 #include "core/templates/rid_owner.h"
 
 #include "servers/rendering/storage/light_storage.h"
+#include "servers/rendering/storage/utilities.h"
 
 namespace RendererDummy {
 
 class LightStorage : public RendererLightStorage {
 private:
 	static LightStorage *singleton;
+
+	/* LIGHT */
+
+	// Lights keep just enough state for the scene cull to pair and cull them.
+	struct Light {
+		RSE::LightType type;
+		float param[RSE::LIGHT_PARAM_MAX];
+		uint32_t cull_mask = 0xFFFFFFFF;
+		uint64_t version = 0;
+		Dependency dependency;
+	};
+
+	mutable RID_Owner<Light, true> light_owner;
+
 	/* LIGHTMAP */
 	struct Lightmap {
 		// dummy lightmap, no data
@@ -62,21 +77,29 @@ public:
 	bool free(RID p_rid);
 	/* Light API */
 
-	virtual RID directional_light_allocate() override { return RID(); }
-	virtual void directional_light_initialize(RID p_rid) override {}
-	virtual RID omni_light_allocate() override { return RID(); }
-	virtual void omni_light_initialize(RID p_rid) override {}
-	virtual RID spot_light_allocate() override { return RID(); }
-	virtual void spot_light_initialize(RID p_rid) override {}
+	// Lights are only kept while tracking is enabled, so headless servers don't pay for pairing and culling them.
+	// Lights created while it's disabled are null RIDs, ignored like before tracking existed.
+	bool tracking_lights = false;
 
-	virtual void light_free(RID p_rid) override {}
+	bool owns_light(RID p_rid) { return light_owner.owns(p_rid); }
+
+	void _light_initialize(RID p_rid, RSE::LightType p_type);
+
+	virtual RID directional_light_allocate() override { return tracking_lights ? light_owner.allocate_rid() : RID(); }
+	virtual void directional_light_initialize(RID p_rid) override { _light_initialize(p_rid, RSE::LIGHT_DIRECTIONAL); }
+	virtual RID omni_light_allocate() override { return tracking_lights ? light_owner.allocate_rid() : RID(); }
+	virtual void omni_light_initialize(RID p_rid) override { _light_initialize(p_rid, RSE::LIGHT_OMNI); }
+	virtual RID spot_light_allocate() override { return tracking_lights ? light_owner.allocate_rid() : RID(); }
+	virtual void spot_light_initialize(RID p_rid) override { _light_initialize(p_rid, RSE::LIGHT_SPOT); }
+
+	virtual void light_free(RID p_rid) override;
 
 	virtual void light_set_color(RID p_light, const Color &p_color) override {}
-	virtual void light_set_param(RID p_light, RSE::LightParam p_param, float p_value) override {}
+	virtual void light_set_param(RID p_light, RSE::LightParam p_param, float p_value) override;
 	virtual void light_set_shadow(RID p_light, bool p_enabled) override {}
 	virtual void light_set_projector(RID p_light, RID p_texture) override {}
 	virtual void light_set_negative(RID p_light, bool p_enable) override {}
-	virtual void light_set_cull_mask(RID p_light, uint32_t p_mask) override {}
+	virtual void light_set_cull_mask(RID p_light, uint32_t p_mask) override;
 	virtual void light_set_distance_fade(RID p_light, bool p_enabled, float p_begin, float p_shadow, float p_length) override {}
 	virtual void light_set_reverse_cull_face_mode(RID p_light, bool p_enabled) override {}
 	virtual void light_set_shadow_caster_mask(RID p_light, uint32_t p_caster_mask) override {}
@@ -98,15 +121,17 @@ public:
 	virtual bool light_has_shadow(RID p_light) const override { return false; }
 	virtual bool light_has_projector(RID p_light) const override { return false; }
 
-	virtual RSE::LightType light_get_type(RID p_light) const override { return RSE::LIGHT_OMNI; }
-	virtual AABB light_get_aabb(RID p_light) const override { return AABB(); }
-	virtual float light_get_param(RID p_light, RSE::LightParam p_param) override { return 0.0; }
+	virtual RSE::LightType light_get_type(RID p_light) const override;
+	virtual AABB light_get_aabb(RID p_light) const override;
+	virtual float light_get_param(RID p_light, RSE::LightParam p_param) override;
 	virtual Color light_get_color(RID p_light) override { return Color(); }
 	virtual bool light_get_reverse_cull_face_mode(RID p_light) const override { return false; }
 	virtual RSE::LightBakeMode light_get_bake_mode(RID p_light) override { return RSE::LIGHT_BAKE_DISABLED; }
 	virtual uint32_t light_get_max_sdfgi_cascade(RID p_light) override { return 0; }
-	virtual uint64_t light_get_version(RID p_light) const override { return 0; }
-	virtual uint32_t light_get_cull_mask(RID p_light) const override { return 0; }
+	virtual uint64_t light_get_version(RID p_light) const override;
+	virtual uint32_t light_get_cull_mask(RID p_light) const override;
+
+	Dependency *light_get_dependency(RID p_light) const;
 
 	/* LIGHT INSTANCE API */
 
@@ -30,6 +30,7 @@
 
 #include "utilities.h"
 
+#include "core/os/os.h"
 #include "servers/rendering/dummy/storage/light_storage.h"
 #include "servers/rendering/dummy/storage/material_storage.h"
 #include "servers/rendering/dummy/storage/mesh_storage.h"
@@ -44,6 +45,8 @@ RSE::InstanceType Utilities::get_base_type(RID p_rid) const {
 		return RSE::INSTANCE_MESH;
 	} else if (RendererDummy::MeshStorage::get_singleton()->owns_multimesh(p_rid)) {
 		return RSE::INSTANCE_MULTIMESH;
+	} else if (RendererDummy::LightStorage::get_singleton()->owns_light(p_rid)) {
+		return RSE::INSTANCE_LIGHT;
 	} else if (RendererDummy::LightStorage::get_singleton()->owns_lightmap(p_rid)) {
 		return RSE::INSTANCE_LIGHTMAP;
 	}
@@ -76,6 +79,9 @@ void Utilities::base_update_dependency(RID p_base, DependencyTracker *p_instance
 	if (RendererDummy::MeshStorage::get_singleton()->owns_mesh(p_base)) {
 		DummyMesh *mesh = RendererDummy::MeshStorage::get_singleton()->get_mesh(p_base);
 		p_instance->update_dependency(&mesh->dependency);
+	} else if (RendererDummy::LightStorage::get_singleton()->owns_light(p_base)) {
+		Dependency *dependency = RendererDummy::LightStorage::get_singleton()->light_get_dependency(p_base);
+		p_instance->update_dependency(dependency);
 	}
 }
 
@@ -86,3 +92,50 @@ Utilities::Utilities() {
 Utilities::~Utilities() {
 	singleton = nullptr;
 }
+
+/* TIMING */
+
+void Utilities::capture_timestamps_begin() {
+	capture_timestamp("Frame Begin");
+}
+
+void Utilities::capture_timestamp(const String &p_name) {
+	timestamp_names.push_back(p_name);
+	timestamp_cpu_values.push_back(OS::get_singleton()->get_ticks_usec());
+}
+
+void Utilities::_capture_timestamps_begin() {
+	if (!capturing_timestamps && timestamp_names.is_empty() && timestamp_result_names.is_empty()) {
+		return; // Nothing to publish, headless servers don't pay for the bookkeeping.
+	}
+
+	SWAP(timestamp_names, timestamp_result_names);
+	SWAP(timestamp_cpu_values, timestamp_cpu_result_values);
+	timestamp_names.clear();
+	timestamp_cpu_values.clear();
+
+	timestamp_result_frame = timestamp_frame;
+	timestamp_frame++;
+
+	if (capturing_timestamps) {
+		capture_timestamp("Internal Begin");
+	}
+}
+
+uint32_t Utilities::get_captured_timestamps_count() const {
+	return timestamp_result_names.size();
+}
+
+uint64_t Utilities::get_captured_timestamps_frame() const {
+	return timestamp_result_frame;
+}
+
+uint64_t Utilities::get_captured_timestamp_cpu_time(uint32_t p_index) const {
+	ERR_FAIL_UNSIGNED_INDEX_V(p_index, timestamp_cpu_result_values.size(), 0);
+	return timestamp_cpu_result_values[p_index];
+}
+
+String Utilities::get_captured_timestamp_name(uint32_t p_index) const {
+	ERR_FAIL_UNSIGNED_INDEX_V(p_index, timestamp_result_names.size(), String());
+	return timestamp_result_names[p_index];
+}
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/templates/local_vector.h"
 #include "servers/rendering/storage/utilities.h"
 
 namespace RendererDummy {
@@ -38,6 +39,15 @@ class Utilities : public RendererUtilities {
 private:
 	static Utilities *singleton;
 
+	// There is no GPU to query, so only CPU times are recorded. They are
+	// published at the start of the next frame, like on the other backends.
+	LocalVector<String> timestamp_names;
+	LocalVector<uint64_t> timestamp_cpu_values;
+	LocalVector<String> timestamp_result_names;
+	LocalVector<uint64_t> timestamp_cpu_result_values;
+	uint64_t timestamp_frame = 0;
+	uint64_t timestamp_result_frame = 0;
+
 public:
 	static Utilities *get_singleton() { return singleton; }
 
@@ -67,13 +77,14 @@ public:
 
 	/* TIMING */
 
-	virtual void capture_timestamps_begin() override {}
-	virtual void capture_timestamp(const String &p_name) override {}
-	virtual uint32_t get_captured_timestamps_count() const override { return 0; }
-	virtual uint64_t get_captured_timestamps_frame() const override { return 0; }
+	virtual void capture_timestamps_begin() override;
+	virtual void capture_timestamp(const String &p_name) override;
+	virtual uint32_t get_captured_timestamps_count() const override;
+	virtual uint64_t get_captured_timestamps_frame() const override;
 	virtual uint64_t get_captured_timestamp_gpu_time(uint32_t p_index) const override { return 0; }
-	virtual uint64_t get_captured_timestamp_cpu_time(uint32_t p_index) const override { return 0; }
-	virtual String get_captured_timestamp_name(uint32_t p_index) const override { return String(); }
+	virtual uint64_t get_captured_timestamp_cpu_time(uint32_t p_index) const override;
+	virtual String get_captured_timestamp_name(uint32_t p_index) const override;
+	void _capture_timestamps_begin();
 
 	/* MISC */
 
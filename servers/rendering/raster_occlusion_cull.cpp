@@ -0,0 +1,626 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "raster_occlusion_cull.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Writes the closest value of a triangle into one row of a tile. Values grow
+// towards the camera, so the closest one is the largest.
+static _FORCE_INLINE_ void _fill_span(float *r_values, const float *p_scale, int p_from, int p_to, float p_base, float p_step, float p_max) {
+	int x = p_from;
+#ifdef __SSE2__
+	const __m128 base = _mm_set1_ps(p_base);
+	const __m128 step = _mm_set1_ps(p_step);
+	const __m128 max = _mm_set1_ps(p_max);
+	__m128 xs = _mm_add_ps(_mm_set1_ps(float(x)), _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f));
+	const __m128 four = _mm_set1_ps(4.0f);
+
+	for (; x + 3 <= p_to; x += 4) {
+		__m128 depth = _mm_min_ps(_mm_add_ps(base, _mm_mul_ps(step, xs)), max);
+		__m128 value = _mm_mul_ps(depth, _mm_loadu_ps(p_scale + x));
+		_mm_storeu_ps(r_values + x, _mm_max_ps(_mm_loadu_ps(r_values + x), value));
+		xs = _mm_add_ps(xs, four);
+	}
+#endif
+	for (; x <= p_to; x++) {
+		float value = MIN(p_base + p_step * float(x), p_max) * p_scale[x];
+		r_values[x] = MAX(r_values[x], value);
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::clear() {
+	HZBuffer::clear();
+
+	setup_threads.clear();
+	triangle_offsets.clear();
+	pixel_scale.clear();
+	pixel_scale_dirty = true;
+	tile_grid_size = Size2i();
+}
+
+void RasterOcclusionCull::RasterHZBuffer::resize(const Size2i &p_size) {
+	if (p_size == Size2i()) {
+		clear();
+		return;
+	}
+
+	if (!sizes.is_empty() && p_size == sizes[0]) {
+		return; // Size didn't change
+	}
+
+	HZBuffer::resize(p_size);
+
+	tile_grid_size = Size2i(Math::ceil(p_size.x / (float)TILE_SIZE), Math::ceil(p_size.y / (float)TILE_SIZE));
+	setup_threads.clear();
+
+	pixel_scale.resize(p_size.x * p_size.y);
+	pixel_scale_dirty = true;
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_update_pixel_scale(const Projection &p_cam_projection, bool p_orthogonal) {
+	if (!pixel_scale_dirty && pixel_scale_orthogonal == p_orthogonal && pixel_scale_projection == p_cam_projection) {
+		return;
+	}
+
+	pixel_scale_projection = p_cam_projection;
+	pixel_scale_orthogonal = p_orthogonal;
+	pixel_scale_dirty = false;
+
+	const Size2i &buffer_size = sizes[0];
+
+	if (p_orthogonal) {
+		// Orthogonal rays all point along the view axis, the depth is the distance.
+		for (float &scale : pixel_scale) {
+			scale = 1.0f;
+		}
+		return;
+	}
+
+	// For perspective, the rasterized value is 1 / depth. Scaling it by the cosine between
+	// the pixel's ray and the view axis turns it into 1 / distance along that ray.
+	Projection inv_projection = p_cam_projection.inverse();
+	for (int y = 0; y < buffer_size.y; y++) {
+		for (int x = 0; x < buffer_size.x; x++) {
+			Vector3 ndc = Vector3((x + 0.5f) / buffer_size.x * 2.0f - 1.0f, (y + 0.5f) / buffer_size.y * 2.0f - 1.0f, -1.0f);
+			Vector3 view = inv_projection.xform(ndc);
+			pixel_scale[y * buffer_size.x + x] = -view.z / view.length();
+		}
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_setup_triangle(SetupThreadData &r_thread, const SetupData *p_data, const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c) const {
+	const Size2i &buffer_size = sizes[0];
+	const Vector3 *view[3] = { &p_a, &p_b, &p_c };
+
+	float sx[3];
+	float sy[3];
+	float sd[3];
+
+	for (int i = 0; i < 3; i++) {
+		const Vector3 &v = *view[i];
+		Vector4 clip = p_data->cam_projection.xform(Vector4(v.x, v.y, v.z, 1.0));
+		if (clip.w <= 0.0) {
+			return;
+		}
+		sx[i] = (clip.x / clip.w * 0.5f + 0.5f) * buffer_size.x - p_data->jitter.x;
+		sy[i] = (clip.y / clip.w * 0.5f + 0.5f) * buffer_size.y - p_data->jitter.y;
+		// Both values are linear in screen space and grow towards the camera.
+		sd[i] = p_data->orthogonal ? v.z : 1.0f / -v.z;
+	}
+
+	float area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sx[2] - sx[0]) * (sy[1] - sy[0]);
+	if (Math::abs(area) < CMP_EPSILON) {
+		return;
+	}
+
+	if (area < 0.0f) {
+		// Occluders are double sided, make the winding counter-clockwise.
+		SWAP(sx[1], sx[2]);
+		SWAP(sy[1], sy[2]);
+		SWAP(sd[1], sd[2]);
+		area = -area;
+	}
+
+	// Only pixels whose center is inside the bounds can be covered.
+	float min_x = MIN(sx[0], MIN(sx[1], sx[2]));
+	float max_x = MAX(sx[0], MAX(sx[1], sx[2]));
+	float min_y = MIN(sy[0], MIN(sy[1], sy[2]));
+	float max_y = MAX(sy[0], MAX(sy[1], sy[2]));
+
+	if (max_x < 0.5f || max_y < 0.5f || min_x > buffer_size.x - 0.5f || min_y > buffer_size.y - 0.5f) {
+		return;
+	}
+
+	Triangle triangle;
+	triangle.min_x = MAX(0, (int)Math::ceil(min_x - 0.5f));
+	triangle.max_x = MIN(buffer_size.x - 1, (int)Math::floor(max_x - 0.5f));
+	triangle.min_y = MAX(0, (int)Math::ceil(min_y - 0.5f));
+	triangle.max_y = MIN(buffer_size.y - 1, (int)Math::floor(max_y - 0.5f));
+
+	if (triangle.min_x > triangle.max_x || triangle.min_y > triangle.max_y) {
+		return;
+	}
+
+	for (int i = 0; i < 3; i++) {
+		int j = (i + 1) % 3;
+		triangle.edges[i][0] = -(sy[j] - sy[i]);
+		triangle.edges[i][1] = sx[j] - sx[i];
+		triangle.edges[i][2] = (sy[j] - sy[i]) * sx[i] - (sx[j] - sx[i]) * sy[i];
+	}
+
+	float dx = ((sd[1] - sd[0]) * (sy[2] - sy[0]) - (sd[2] - sd[0]) * (sy[1] - sy[0])) / area;
+	float dy = ((sd[2] - sd[0]) * (sx[1] - sx[0]) - (sd[1] - sd[0]) * (sx[2] - sx[0])) / area;
+	triangle.depth[0] = sd[0] - dx * sx[0] - dy * sy[0];
+	triangle.depth[1] = dx;
+	triangle.depth[2] = dy;
+	// Don't let the plane extrapolate closer than the triangle at its edges.
+	triangle.depth_max = MAX(sd[0], MAX(sd[1], sd[2]));
+
+	uint32_t index = r_thread.triangles.size();
+	r_thread.triangles.push_back(triangle);
+
+	for (int ty = triangle.min_y / TILE_SIZE; ty <= triangle.max_y / TILE_SIZE; ty++) {
+		for (int tx = triangle.min_x / TILE_SIZE; tx <= triangle.max_x / TILE_SIZE; tx++) {
+			r_thread.bins[ty * tile_grid_size.x + tx].push_back(index);
+		}
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_clip_triangle(SetupThreadData &r_thread, const SetupData *p_data, const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c) const {
+	const Vector3 vertices[3] = { p_a, p_b, p_c };
+
+	int inside = 0;
+	int beyond_far = 0;
+	for (int i = 0; i < 3; i++) {
+		float depth = -vertices[i].z;
+		inside += depth >= p_data->z_near ? 1 : 0;
+		beyond_far += depth > p_data->z_far ? 1 : 0;
+	}
+
+	if (inside == 0 || beyond_far == 3) {
+		return;
+	}
+
+	if (inside == 3) {
+		_setup_triangle(r_thread, p_data, p_a, p_b, p_c);
+		return;
+	}
+
+	// Clip against the near plane, which leaves at most a quad.
+	Vector3 clipped[4];
+	int clipped_count = 0;
+
+	for (int i = 0; i < 3; i++) {
+		const Vector3 &from = vertices[i];
+		const Vector3 &to = vertices[(i + 1) % 3];
+		float from_depth = -from.z - p_data->z_near;
+		float to_depth = -to.z - p_data->z_near;
+
+		if (from_depth >= 0.0f) {
+			clipped[clipped_count++] = from;
+		}
+		if ((from_depth >= 0.0f) != (to_depth >= 0.0f)) {
+			float t = from_depth / (from_depth - to_depth);
+			Vector3 point = from.lerp(to, t);
+			point.z = -p_data->z_near;
+			clipped[clipped_count++] = point;
+		}
+	}
+
+	for (int i = 2; i < clipped_count; i++) {
+		_setup_triangle(r_thread, p_data, clipped[0], clipped[i - 1], clipped[i]);
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_setup_thread(uint32_t p_thread, const SetupData *p_data) {
+	SetupThreadData &thread = setup_threads[p_thread];
+
+	thread.triangles.clear();
+	for (LocalVector<uint32_t> &bin : thread.bins) {
+		bin.clear();
+	}
+
+	// Split the work by triangles, so a single large occluder is still spread over all threads.
+	uint32_t total = p_data->triangle_count;
+	uint32_t from = p_thread * total / p_data->thread_count;
+	uint32_t to = (p_thread + 1 == p_data->thread_count) ? total : ((p_thread + 1) * total / p_data->thread_count);
+
+	const LocalVector<OccluderMesh> &occluders = *p_data->occluders;
+
+	for (uint32_t i = 0; i < occluders.size() && p_data->triangle_offsets[i] < to; i++) {
+		uint32_t occluder_from = p_data->triangle_offsets[i];
+		uint32_t occluder_to = p_data->triangle_offsets[i + 1];
+		if (occluder_to <= from) {
+			continue;
+		}
+
+		const OccluderMesh &mesh = occluders[i];
+		Transform3D view_xform = p_data->cam_inv_transform * mesh.xform;
+
+		thread.view_vertices.resize(mesh.vertex_count);
+		for (uint32_t j = 0; j < mesh.vertex_count; j++) {
+			thread.view_vertices[j] = view_xform.xform(mesh.vertices[j]);
+		}
+
+		uint32_t triangle_from = MAX(from, occluder_from) - occluder_from;
+		uint32_t triangle_to = MIN(to, occluder_to) - occluder_from;
+
+		for (uint32_t j = triangle_from; j < triangle_to; j++) {
+			const uint32_t *indices = &mesh.indices[j * 3];
+			_clip_triangle(thread, p_data, thread.view_vertices[indices[0]], thread.view_vertices[indices[1]], thread.view_vertices[indices[2]]);
+		}
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_rasterize_tile(uint32_t p_tile, const SetupData *p_data) {
+	const Size2i &buffer_size = sizes[0];
+
+	int tile_x = (p_tile % tile_grid_size.x) * TILE_SIZE;
+	int tile_y = (p_tile / tile_grid_size.x) * TILE_SIZE;
+	int tile_w = MIN(TILE_SIZE, buffer_size.x - tile_x);
+	int tile_h = MIN(TILE_SIZE, buffer_size.y - tile_y);
+
+	const float empty = p_data->orthogonal ? -FLT_MAX : 0.0f;
+	float values[TILE_PIXELS];
+	for (int i = 0; i < TILE_PIXELS; i++) {
+		values[i] = empty;
+	}
+
+	for (const SetupThreadData &thread : setup_threads) {
+		for (uint32_t index : thread.bins[p_tile]) {
+			const Triangle &triangle = thread.triangles[index];
+
+			int min_y = MAX(triangle.min_y, tile_y);
+			int max_y = MIN(triangle.max_y, tile_y + tile_h - 1);
+			float min_x = MAX(triangle.min_x, tile_x);
+			float max_x = MIN(triangle.max_x, tile_x + tile_w - 1);
+
+			for (int y = min_y; y <= max_y; y++) {
+				float center_y = y + 0.5f;
+				float from = min_x;
+				float to = max_x;
+
+				// Intersect the row with each edge to find the covered span.
+				for (int i = 0; i < 3; i++) {
+					const float *edge = triangle.edges[i];
+					float offset = edge[1] * center_y + edge[2];
+					if (edge[0] > 0.0f) {
+						from = MAX(from, Math::ceil(-offset / edge[0] - 0.5f));
+					} else if (edge[0] < 0.0f) {
+						to = MIN(to, Math::floor(-offset / edge[0] - 0.5f));
+					} else if (offset < 0.0f) {
+						to = from - 1.0f;
+					}
+				}
+
+				if (from > to) {
+					continue;
+				}
+
+				float base = triangle.depth[0] + triangle.depth[2] * center_y + triangle.depth[1] * (tile_x + 0.5f);
+				float *row = &values[(y - tile_y) * TILE_SIZE];
+				const float *scale = &pixel_scale[y * buffer_size.x + tile_x];
+				_fill_span(row, scale, int(from) - tile_x, int(to) - tile_x, base, triangle.depth[1], triangle.depth_max);
+			}
+		}
+	}
+
+	for (int y = 0; y < tile_h; y++) {
+		float *dst = &mips[0][(tile_y + y) * buffer_size.x + tile_x];
+		const float *src = &values[y * TILE_SIZE];
+		for (int x = 0; x < tile_w; x++) {
+			if (src[x] == empty) {
+				dst[x] = FLT_MAX;
+			} else {
+				dst[x] = p_data->orthogonal ? -src[x] : 1.0f / src[x];
+			}
+		}
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::rasterize(const LocalVector<OccluderMesh> &p_occluders, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const Vector2 &p_jitter) {
+	ERR_FAIL_COND(is_empty());
+
+	_update_pixel_scale(p_cam_projection, p_cam_orthogonal);
+
+	triangle_offsets.resize(p_occluders.size() + 1);
+	uint32_t triangle_count = 0;
+	for (uint32_t i = 0; i < p_occluders.size(); i++) {
+		triangle_offsets[i] = triangle_count;
+		triangle_count += p_occluders[i].index_count / 3;
+	}
+	triangle_offsets[p_occluders.size()] = triangle_count;
+
+	uint32_t tile_count = tile_grid_size.x * tile_grid_size.y;
+
+	SetupData data;
+	data.occluders = &p_occluders;
+	data.triangle_offsets = triangle_offsets.ptr();
+	data.triangle_count = triangle_count;
+	// Small occluder sets aren't worth waking up all threads for.
+	data.thread_count = CLAMP(triangle_count / 64, 1u, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count());
+	data.cam_inv_transform = p_cam_transform.affine_inverse();
+	data.cam_projection = p_cam_projection;
+	data.z_near = p_cam_projection.get_z_near();
+	data.z_far = p_cam_projection.get_z_far() * 1.05f;
+	data.orthogonal = p_cam_orthogonal;
+	data.jitter = p_jitter;
+
+	debug_tex_range = data.z_far;
+
+	if (setup_threads.size() < data.thread_count) {
+		setup_threads.resize(data.thread_count);
+	}
+	for (SetupThreadData &thread : setup_threads) {
+		if (thread.bins.size() != tile_count) {
+			thread.bins.resize(tile_count);
+		}
+	}
+	// Threads beyond the ones used this frame must not contribute stale triangles.
+	for (uint32_t i = data.thread_count; i < setup_threads.size(); i++) {
+		setup_threads[i].triangles.clear();
+		for (LocalVector<uint32_t> &bin : setup_threads[i].bins) {
+			bin.clear();
+		}
+	}
+
+	if (data.thread_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_setup_thread, (const SetupData *)&data, data.thread_count, -1, true, SNAME("RasterOcclusionCullSetup"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_setup_thread(0, &data);
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_rasterize_tile, (const SetupData *)&data, tile_count, -1, true, SNAME("RasterOcclusionCullRasterize"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+////////////////////////////////////////////////////////
+
+bool RasterOcclusionCull::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RasterOcclusionCull::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RasterOcclusionCull::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RasterOcclusionCull::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	ERR_FAIL_COND_MSG(p_indices.size() % 3 != 0, "Occluder index count must be a multiple of 3.");
+	for (int32_t index : p_indices) {
+		ERR_FAIL_INDEX_MSG(index, p_vertices.size(), "Occluder index is out of bounds.");
+	}
+
+	occluder->vertices.resize(p_vertices.size());
+	if (p_vertices.size()) {
+		memcpy(occluder->vertices.ptr(), p_vertices.ptr(), p_vertices.size() * sizeof(Vector3));
+	}
+	occluder->indices.resize(p_indices.size());
+	if (p_indices.size()) {
+		memcpy(occluder->indices.ptr(), p_indices.ptr(), p_indices.size() * sizeof(int32_t));
+	}
+
+	occluder->aabb = AABB();
+	for (uint32_t i = 0; i < occluder->vertices.size(); i++) {
+		if (i == 0) {
+			occluder->aabb.position = occluder->vertices[i];
+		} else {
+			occluder->aabb.expand_to(occluder->vertices[i]);
+		}
+	}
+}
+
+void RasterOcclusionCull::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+}
+
+void RasterOcclusionCull::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RasterOcclusionCull::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	Scenario &scenario = scenarios[p_scenario];
+
+	// Occluders are read directly when rasterizing, so there is nothing to rebuild here.
+	OccluderInstance &instance = scenario.instances[p_instance];
+	instance.occluder = p_occluder;
+	instance.xform = p_xform;
+	instance.enabled = p_enabled;
+}
+
+void RasterOcclusionCull::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios[p_scenario].instances.erase(p_instance);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RasterOcclusionCull::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RasterOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RasterOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+Vector2 RasterOcclusionCull::_get_jitter(const Size2i &p_buffer_size) const {
+	if (!jitter_enabled) {
+		return Vector2();
+	}
+
+	// Prevent divide by zero when using NULL viewport.
+	if ((p_buffer_size.x <= 0) || (p_buffer_size.y <= 0)) {
+		return Vector2();
+	}
+
+	int32_t frame = Engine::get_singleton()->get_frames_drawn();
+	frame %= 9;
+
+	Vector2 jitter;
+
+	switch (frame) {
+		default:
+			break;
+		case 1: {
+			jitter = Vector2(-1, -1);
+		} break;
+		case 2: {
+			jitter = Vector2(1, -1);
+		} break;
+		case 3: {
+			jitter = Vector2(-1, 1);
+		} break;
+		case 4: {
+			jitter = Vector2(1, 1);
+		} break;
+		case 5: {
+			jitter = Vector2(-0.5f, -0.5f);
+		} break;
+		case 6: {
+			jitter = Vector2(0.5f, -0.5f);
+		} break;
+		case 7: {
+			jitter = Vector2(-0.5f, 0.5f);
+		} break;
+		case 8: {
+			jitter = Vector2(0.5f, 0.5f);
+		} break;
+	}
+
+	// Same subpixel offsets as the raycast implementation, expressed in pixels.
+	return jitter * 0.33f;
+}
+
+void RasterOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	if (!buffers.has(p_buffer)) {
+		return;
+	}
+
+	RasterHZBuffer &buffer = buffers[p_buffer];
+
+	if (buffer.is_empty() || !scenarios.has(buffer.scenario_rid)) {
+		return;
+	}
+
+	const Scenario &scenario = scenarios[buffer.scenario_rid];
+	const Vector<Plane> planes = p_cam_projection.get_projection_planes(p_cam_transform);
+
+	visible_occluders.clear();
+
+	for (const KeyValue<RID, OccluderInstance> &E : scenario.instances) {
+		const OccluderInstance &instance = E.value;
+		const Occluder *occluder = occluder_owner.get_or_null(instance.occluder);
+
+		if (!occluder || !instance.enabled || occluder->indices.is_empty()) {
+			continue;
+		}
+
+		AABB aabb = instance.xform.xform(occluder->aabb);
+		bool outside = false;
+		for (const Plane &plane : planes) {
+			if (plane.is_point_over(aabb.get_support(-plane.normal))) {
+				outside = true;
+				break;
+			}
+		}
+		if (outside) {
+			continue;
+		}
+
+		RasterHZBuffer::OccluderMesh mesh;
+		mesh.vertices = occluder->vertices.ptr();
+		mesh.vertex_count = occluder->vertices.size();
+		mesh.indices = occluder->indices.ptr();
+		mesh.index_count = occluder->indices.size();
+		mesh.xform = instance.xform;
+		visible_occluders.push_back(mesh);
+	}
+
+	buffer.rasterize(visible_occluders, p_cam_transform, p_cam_projection, p_cam_orthogonal, _get_jitter(buffer.get_occlusion_buffer_size()));
+	buffer.update_mips();
+}
+
+RasterOcclusionCull::HZBuffer *RasterOcclusionCull::buffer_get_ptr(RID p_buffer) {
+	if (!buffers.has(p_buffer)) {
+		return nullptr;
+	}
+	return &buffers[p_buffer];
+}
+
+RID RasterOcclusionCull::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
+
+////////////////////////////////////////////////////////
+
+RasterOcclusionCull::RasterOcclusionCull() {
+	jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
+}
@@ -0,0 +1,159 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/aabb.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rid_owner.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
+
+// Portable occlusion culling that rasterizes occluders into the depth buffer
+// on the CPU instead of ray tracing them, so it works without Embree.
+class RasterOcclusionCull : public RendererSceneOcclusionCull {
+	static const int TILE_SIZE = 16;
+	static const int TILE_PIXELS = TILE_SIZE * TILE_SIZE;
+
+public:
+	class RasterHZBuffer : public HZBuffer {
+	public:
+		struct OccluderMesh {
+			const Vector3 *vertices = nullptr;
+			uint32_t vertex_count = 0;
+			const uint32_t *indices = nullptr;
+			uint32_t index_count = 0;
+			Transform3D xform;
+		};
+
+	private:
+		struct Triangle {
+			// Edge functions, A * x + B * y + C >= 0 inside the triangle.
+			float edges[3][3];
+			// Depth plane, evaluated per pixel and scaled by pixel_scale.
+			float depth[3];
+			float depth_max;
+			int min_x, min_y, max_x, max_y;
+		};
+
+		// Each setup thread bins its triangles separately, so binning doesn't need locking.
+		struct SetupThreadData {
+			LocalVector<Triangle> triangles;
+			LocalVector<LocalVector<uint32_t>> bins;
+			LocalVector<Vector3> view_vertices;
+		};
+
+		struct SetupData {
+			const LocalVector<OccluderMesh> *occluders = nullptr;
+			const uint32_t *triangle_offsets = nullptr;
+			uint32_t triangle_count = 0;
+			uint32_t thread_count = 0;
+			Transform3D cam_inv_transform;
+			Projection cam_projection;
+			float z_near = 0.0f;
+			float z_far = 0.0f;
+			bool orthogonal = false;
+			Vector2 jitter;
+		};
+
+		Size2i tile_grid_size;
+		LocalVector<SetupThreadData> setup_threads;
+		LocalVector<uint32_t> triangle_offsets;
+
+		// Converts the interpolated depth to the distance stored in the buffer,
+		// which matches the ray distance written by the raycast implementation.
+		LocalVector<float> pixel_scale;
+		Projection pixel_scale_projection;
+		bool pixel_scale_orthogonal = false;
+		bool pixel_scale_dirty = true;
+
+		void _update_pixel_scale(const Projection &p_cam_projection, bool p_orthogonal);
+		void _clip_triangle(SetupThreadData &r_thread, const SetupData *p_data, const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c) const;
+		void _setup_triangle(SetupThreadData &r_thread, const SetupData *p_data, const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c) const;
+		void _setup_thread(uint32_t p_thread, const SetupData *p_data);
+		void _rasterize_tile(uint32_t p_tile, const SetupData *p_data);
+
+	public:
+		RID scenario_rid;
+
+		virtual void clear() override;
+		virtual void resize(const Size2i &p_size) override;
+
+		void rasterize(const LocalVector<OccluderMesh> &p_occluders, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const Vector2 &p_jitter);
+	};
+
+private:
+	struct Occluder {
+		LocalVector<Vector3> vertices;
+		LocalVector<uint32_t> indices;
+		AABB aabb;
+	};
+
+	struct OccluderInstance {
+		RID occluder;
+		Transform3D xform;
+		bool enabled = true;
+	};
+
+	struct Scenario {
+		HashMap<RID, OccluderInstance> instances;
+	};
+
+	RID_PtrOwner<Occluder> occluder_owner;
+	HashMap<RID, Scenario> scenarios;
+	HashMap<RID, RasterHZBuffer> buffers;
+	LocalVector<RasterHZBuffer::OccluderMesh> visible_occluders;
+	bool jitter_enabled = false;
+
+	Vector2 _get_jitter(const Size2i &p_buffer_size) const;
+
+public:
+	virtual bool is_occluder(RID p_rid) override;
+	virtual RID occluder_allocate() override;
+	virtual void occluder_initialize(RID p_occluder) override;
+	virtual void occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) override;
+	virtual void free_occluder(RID p_occluder) override;
+
+	virtual void add_scenario(RID p_scenario) override;
+	virtual void remove_scenario(RID p_scenario) override;
+	virtual void scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) override;
+	virtual void scenario_remove_instance(RID p_scenario, RID p_instance) override;
+
+	virtual void add_buffer(RID p_buffer) override;
+	virtual void remove_buffer(RID p_buffer) override;
+	virtual HZBuffer *buffer_get_ptr(RID p_buffer) override;
+	virtual void buffer_set_scenario(RID p_buffer, RID p_scenario) override;
+	virtual void buffer_set_size(RID p_buffer, const Vector2i &p_size) override;
+	virtual void buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) override;
+
+	virtual RID buffer_get_debug_texture(RID p_buffer) override;
+
+	RasterOcclusionCull();
+};
@@ -34,6 +34,7 @@
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
 #include "core/math/transform_interpolator.h"
+#include "core/object/worker_thread_pool.h"
 #include "servers/rendering/renderer_viewport.h"
 #include "servers/rendering/rendering_server_default.h"
 #include "servers/rendering/rendering_server_globals.h"
@@ -79,8 +80,24 @@ void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas
 	memset(z_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
 	memset(z_last_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
 
-	for (int i = 0; i < p_child_item_count; i++) {
-		_cull_canvas_item(p_child_items[i].item, p_transform, p_clip_rect, Color(1, 1, 1, 1), 0, z_list, z_last_list, nullptr, nullptr, false, p_canvas_cull_mask, Point2(), 1, nullptr);
+	if (_can_cull_threaded(p_child_item_count)) {
+		cull_batch_items.resize(p_child_item_count);
+		for (int i = 0; i < p_child_item_count; i++) {
+			cull_batch_items[i] = p_child_items[i].item;
+		}
+
+		CullBatch batch;
+		batch.items = cull_batch_items.ptr();
+		batch.item_count = cull_batch_items.size();
+		batch.xform = p_transform;
+		batch.clip_rect = p_clip_rect;
+		batch.modulate = Color(1, 1, 1, 1);
+		batch.canvas_cull_mask = p_canvas_cull_mask;
+		_cull_canvas_items_threaded(batch, z_list, z_last_list);
+	} else {
+		for (int i = 0; i < p_child_item_count; i++) {
+			_cull_canvas_item(p_child_items[i].item, p_transform, p_clip_rect, Color(1, 1, 1, 1), 0, z_list, z_last_list, nullptr, nullptr, false, p_canvas_cull_mask, Point2(), 1, nullptr);
+		}
 	}
 
 	RendererCanvasRender::Item *list = nullptr;
@@ -189,6 +206,124 @@ void RendererCanvasCull::_mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner
 	} while (ysort_owner && ysort_owner->sort_y);
 }
 
+void RendererCanvasCull::_spatial_index_add_child(Item *p_owner, Item *p_child) {
+	p_child->spatial_index_owner = p_owner;
+	p_owner->spatial_index->unindexed_dirty = true;
+	_item_spatial_index_changed(p_child);
+}
+
+void RendererCanvasCull::_spatial_index_remove_child(Item *p_child) {
+	Item *owner = p_child->spatial_index_owner;
+	if (!owner) {
+		return;
+	}
+
+	SpatialIndex *index = owner->spatial_index;
+	if (p_child->spatial_index_id.is_valid()) {
+		index->bvh.remove(p_child->spatial_index_id);
+		p_child->spatial_index_id = DynamicBVH::ID();
+	}
+	if (p_child->spatial_index_dirty) {
+		index->dirty_items.erase(p_child);
+		p_child->spatial_index_dirty = false;
+	}
+	index->unindexed_dirty = true;
+	p_child->spatial_index_owner = nullptr;
+}
+
+bool RendererCanvasCull::_get_spatial_index_bounds(const Item *p_item, Rect2 &r_bounds) const {
+	// Only leaves are indexed, and only if their bounds can't change without the item being notified.
+	if (!p_item->child_items.is_empty() || p_item->use_identity_transform || p_item->copy_back_buffer || p_item->vp_render || p_item->canvas_group || p_item->repeat_source || p_item->on_interpolate_transform_list || p_item->update_when_visible || p_item->skeleton.is_valid()) {
+		return false;
+	}
+
+	for (const Item::Command *c = p_item->commands; c; c = c->next) {
+		if (c->type == Item::Command::TYPE_MESH || c->type == Item::Command::TYPE_MULTIMESH || c->type == Item::Command::TYPE_PARTICLES) {
+			return false;
+		}
+	}
+
+	Rect2 rect = p_item->get_rect();
+	if (p_item->visibility_notifier && p_item->visibility_notifier->area.size != Vector2()) {
+		rect = rect.merge(p_item->visibility_notifier->area);
+	}
+
+	// Grown to account for transform snapping.
+	r_bounds = p_item->xform_curr.xform(rect).grow(1.0);
+	return true;
+}
+
+void RendererCanvasCull::_update_spatial_index(Item *p_item) {
+	SpatialIndex *index = p_item->spatial_index;
+
+	for (Item *child : index->dirty_items) {
+		child->spatial_index_dirty = false;
+
+		Rect2 bounds;
+		if (_get_spatial_index_bounds(child, bounds)) {
+			AABB aabb(Vector3(bounds.position.x, bounds.position.y, 0), Vector3(bounds.size.x, bounds.size.y, 0));
+			if (child->spatial_index_id.is_valid()) {
+				index->bvh.update(child->spatial_index_id, aabb);
+			} else {
+				child->spatial_index_id = index->bvh.insert(aabb, child);
+				index->unindexed_dirty = true;
+			}
+		} else if (child->spatial_index_id.is_valid()) {
+			index->bvh.remove(child->spatial_index_id);
+			child->spatial_index_id = DynamicBVH::ID();
+			index->unindexed_dirty = true;
+		}
+	}
+	index->dirty_items.clear();
+
+	if (index->unindexed_dirty) {
+		index->unindexed_items.clear();
+		for (int i = 0; i < p_item->child_items.size(); i++) {
+			Item *child = p_item->child_items[i];
+			child->spatial_index_order = i;
+			if (!child->spatial_index_id.is_valid()) {
+				index->unindexed_items.push_back(child);
+			}
+		}
+		index->unindexed_dirty = false;
+	}
+}
+
+uint32_t RendererCanvasCull::_cull_spatial_index(Item *p_item, const Transform2D &p_xform, const Rect2 &p_clip_rect) {
+	_update_spatial_index(p_item);
+
+	SpatialIndex *index = p_item->spatial_index;
+	index->cull_result.clear();
+
+	// Same test as _attach_canvas_item_for_draw(), done in the item's space. Grown to account for transform snapping.
+	Rect2 rect = p_xform.affine_inverse().xform(Rect2(Point2(), p_clip_rect.size).grow(2.0));
+
+	struct CullResult {
+		LocalVector<Item *> *items = nullptr;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			items->push_back((Item *)p_data);
+			return false;
+		}
+	};
+
+	CullResult result;
+	result.items = &index->cull_result;
+	index->bvh.aabb_query(AABB(Vector3(rect.position.x, rect.position.y, 0), Vector3(rect.size.x, rect.size.y, 0)), result);
+
+	for (Item *child : index->unindexed_items) {
+		index->cull_result.push_back(child);
+	}
+
+	// Restore the draw order of the children. Sorting by draw index alone is not enough,
+	// as the sort is unstable and children often share the same index.
+	if (index->cull_result.size() > 1) {
+		SortArray<Item *, ItemSpatialIndexOrderSort> sorter;
+		sorter.sort(index->cull_result.ptr(), index->cull_result.size());
+	}
+
+	return index->cull_result.size();
+}
+
 void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *ci, RendererCanvasCull::Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &p_modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from) {
 	if (ci->copy_back_buffer) {
 		ci->copy_back_buffer->screen_rect = p_transform.xform(ci->copy_back_buffer->rect).intersection(p_clip_rect);
@@ -261,7 +396,11 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 		// Something to draw?
 
 		if (ci->update_when_visible) {
-			RenderingServerDefault::redraw_request();
+			if (unlikely(current_cull_thread_data)) {
+				current_cull_thread_data->redraw_requested = true;
+			} else {
+				RenderingServerDefault::redraw_request();
+			}
 		}
 
 		if (ci->commands != nullptr || ci->copy_back_buffer) {
@@ -280,6 +419,9 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 			} else {
 				r_z_list[zidx] = ci;
 				r_z_last_list[zidx] = ci;
+				if (unlikely(current_cull_thread_data)) {
+					current_cull_thread_data->used_z.push_back(zidx);
+				}
 			}
 
 			ci->z_final = p_z;
@@ -288,7 +430,10 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 		}
 
 		if (ci->visibility_notifier) {
-			if (!ci->visibility_notifier->visible_element.in_list()) {
+			if (unlikely(current_cull_thread_data)) {
+				// The list is shared, notifiers are added once culling on worker threads is done.
+				current_cull_thread_data->visible_notifiers.push_back(ci->visibility_notifier);
+			} else if (!ci->visibility_notifier->visible_element.in_list()) {
 				visibility_notifier_list.add(&ci->visibility_notifier->visible_element);
 				ci->visibility_notifier->just_visible = true;
 			}
@@ -315,6 +460,9 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	if (ci->children_order_dirty) {
 		ci->child_items.sort_custom<ItemIndexSort>();
 		ci->children_order_dirty = false;
+		if (ci->spatial_index) {
+			ci->spatial_index->unindexed_dirty = true;
+		}
 	}
 
 	if (ci->use_parent_material && p_material_owner) {
@@ -455,8 +603,21 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			SortArray<Item *, ItemYSort> sorter;
 			sorter.sort(child_items, child_item_count);
 
-			for (i = 0; i < child_item_count; i++) {
-				_cull_canvas_item(child_items[i], final_xform * child_items[i]->ysort_xform, p_clip_rect, modulate * child_items[i]->ysort_modulate, child_items[i]->ysort_parent_abs_z_index, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, (Item *)child_items[i]->material_owner, true, p_canvas_cull_mask, child_items[i]->repeat_size, child_items[i]->repeat_times, child_items[i]->repeat_source_item);
+			if (_can_cull_threaded(child_item_count)) {
+				CullBatch batch;
+				batch.items = child_items;
+				batch.item_count = child_item_count;
+				batch.y_sorted = true;
+				batch.xform = final_xform;
+				batch.clip_rect = p_clip_rect;
+				batch.modulate = modulate;
+				batch.canvas_clip = (Item *)ci->final_clip_owner;
+				batch.canvas_cull_mask = p_canvas_cull_mask;
+				_cull_canvas_items_threaded(batch, r_z_list, r_z_last_list);
+			} else {
+				for (i = 0; i < child_item_count; i++) {
+					_cull_canvas_item(child_items[i], final_xform * child_items[i]->ysort_xform, p_clip_rect, modulate * child_items[i]->ysort_modulate, child_items[i]->ysort_parent_abs_z_index, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, (Item *)child_items[i]->material_owner, true, p_canvas_cull_mask, child_items[i]->repeat_size, child_items[i]->repeat_times, child_items[i]->repeat_source_item);
+				}
 			}
 		} else {
 			RendererCanvasRender::Item *canvas_group_from = nullptr;
@@ -469,6 +630,12 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			_attach_canvas_item_for_draw(ci, p_canvas_clip, r_z_list, r_z_last_list, final_xform, p_clip_rect, global_rect, modulate, p_z, p_material_owner, use_canvas_group, canvas_group_from);
 		}
 	} else {
+		if (ci->spatial_index && !(repeat_source_item && (repeat_size.x || repeat_size.y)) && final_xform.determinant() != 0) {
+			// Only visit the indexed children overlapping the viewport.
+			child_item_count = _cull_spatial_index(ci, final_xform, p_clip_rect);
+			child_items = ci->spatial_index->cull_result.ptr();
+		}
+
 		RendererCanvasRender::Item *canvas_group_from = nullptr;
 		bool use_canvas_group = ci->canvas_group != nullptr && (ci->canvas_group->fit_empty || ci->commands != nullptr);
 		if (use_canvas_group) {
@@ -476,6 +643,43 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			canvas_group_from = r_z_last_list[zidx];
 		}
 
+		if (_can_cull_threaded(child_item_count)) {
+			CullBatch batch;
+			batch.xform = final_xform;
+			batch.clip_rect = p_clip_rect;
+			batch.modulate = modulate;
+			batch.z = p_z;
+			batch.canvas_clip = (Item *)ci->final_clip_owner;
+			batch.material_owner = p_material_owner;
+			batch.canvas_cull_mask = p_canvas_cull_mask;
+			batch.repeat_size = repeat_size;
+			batch.repeat_times = repeat_times;
+			batch.repeat_source_item = repeat_source_item;
+
+			cull_batch_items.clear();
+			for (int i = 0; i < child_item_count; i++) {
+				if (child_items[i]->behind || use_canvas_group) {
+					cull_batch_items.push_back(child_items[i]);
+				}
+			}
+			batch.items = cull_batch_items.ptr();
+			batch.item_count = cull_batch_items.size();
+			_cull_canvas_items_threaded(batch, r_z_list, r_z_last_list);
+
+			_attach_canvas_item_for_draw(ci, p_canvas_clip, r_z_list, r_z_last_list, final_xform, p_clip_rect, global_rect, modulate, p_z, p_material_owner, use_canvas_group, canvas_group_from);
+
+			cull_batch_items.clear();
+			for (int i = 0; i < child_item_count; i++) {
+				if (!child_items[i]->behind && !use_canvas_group) {
+					cull_batch_items.push_back(child_items[i]);
+				}
+			}
+			batch.items = cull_batch_items.ptr();
+			batch.item_count = cull_batch_items.size();
+			_cull_canvas_items_threaded(batch, r_z_list, r_z_last_list);
+			return;
+		}
+
 		for (int i = 0; i < child_item_count; i++) {
 			if (!child_items[i]->behind && !use_canvas_group) {
 				continue;
@@ -492,6 +696,85 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	}
 }
 
+thread_local RendererCanvasCull::CullThreadData *RendererCanvasCull::current_cull_thread_data = nullptr;
+
+void RendererCanvasCull::_cull_batch_item(const CullBatch &p_batch, uint32_t p_index, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list) {
+	Item *item = p_batch.items[p_index];
+	if (p_batch.y_sorted) {
+		_cull_canvas_item(item, p_batch.xform * item->ysort_xform, p_batch.clip_rect, p_batch.modulate * item->ysort_modulate, item->ysort_parent_abs_z_index, r_z_list, r_z_last_list, p_batch.canvas_clip, (Item *)item->material_owner, true, p_batch.canvas_cull_mask, item->repeat_size, item->repeat_times, item->repeat_source_item);
+	} else {
+		_cull_canvas_item(item, p_batch.xform, p_batch.clip_rect, p_batch.modulate, p_batch.z, r_z_list, r_z_last_list, p_batch.canvas_clip, p_batch.material_owner, false, p_batch.canvas_cull_mask, p_batch.repeat_size, p_batch.repeat_times, p_batch.repeat_source_item);
+	}
+}
+
+void RendererCanvasCull::_cull_canvas_items_thread(uint32_t p_thread, const CullBatch *p_batch) {
+	uint32_t total_threads = cull_thread_data.size();
+	uint32_t cull_from = p_thread * p_batch->item_count / total_threads;
+	uint32_t cull_to = (p_thread + 1 == total_threads) ? p_batch->item_count : ((p_thread + 1) * p_batch->item_count / total_threads);
+
+	CullThreadData &thread = cull_thread_data[p_thread];
+	CullThreadData *prev_thread_data = current_cull_thread_data;
+	current_cull_thread_data = &thread;
+
+	for (uint32_t i = cull_from; i < cull_to; i++) {
+		_cull_batch_item(*p_batch, i, thread.z_list, thread.z_last_list);
+	}
+
+	current_cull_thread_data = prev_thread_data;
+}
+
+void RendererCanvasCull::_cull_canvas_items_threaded(const CullBatch &p_batch, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list) {
+	if (cull_thread_data.is_empty()) {
+		cull_thread_data.resize(WorkerThreadPool::get_singleton()->get_thread_count());
+		for (CullThreadData &thread : cull_thread_data) {
+			thread.z_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+			thread.z_last_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+			memset(thread.z_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
+			memset(thread.z_last_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
+		}
+	}
+
+	if (p_batch.item_count == 0) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererCanvasCull::_cull_canvas_items_thread, &p_batch, cull_thread_data.size(), -1, true, SNAME("CullCanvasItems"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Each thread culled a contiguous range of siblings, so appending the lists in thread order
+	// keeps the same draw order as culling on a single thread.
+	bool redraw_requested = false;
+	for (CullThreadData &thread : cull_thread_data) {
+		for (int zidx : thread.used_z) {
+			if (r_z_last_list[zidx]) {
+				r_z_last_list[zidx]->next = thread.z_list[zidx];
+			} else {
+				r_z_list[zidx] = thread.z_list[zidx];
+			}
+			r_z_last_list[zidx] = thread.z_last_list[zidx];
+
+			thread.z_list[zidx] = nullptr;
+			thread.z_last_list[zidx] = nullptr;
+		}
+		thread.used_z.clear();
+
+		for (Item::VisibilityNotifierData *notifier : thread.visible_notifiers) {
+			if (!notifier->visible_element.in_list()) {
+				visibility_notifier_list.add(&notifier->visible_element);
+				notifier->just_visible = true;
+			}
+		}
+		thread.visible_notifiers.clear();
+
+		redraw_requested = redraw_requested || thread.redraw_requested;
+		thread.redraw_requested = false;
+	}
+
+	if (redraw_requested) {
+		RenderingServerDefault::redraw_request();
+	}
+}
+
 void RendererCanvasCull::render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RSE::CanvasItemTextureFilter p_default_filter, RSE::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel, uint32_t canvas_cull_mask, RenderingServerTypes::RenderInfo *r_render_info) {
 	RENDER_TIMESTAMP("> Render Canvas");
 
@@ -527,6 +810,7 @@ void RendererCanvasCull::canvas_set_item_mirroring(RID p_canvas, RID p_item, con
 	ERR_FAIL_NULL(canvas);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	int idx = canvas->find_item(canvas_item);
 	ERR_FAIL_COND(idx == -1);
@@ -542,6 +826,7 @@ void RendererCanvasCull::canvas_set_item_repeat(RID p_item, const Point2 &p_repe
 	ERR_FAIL_COND(p_repeat_times < 0);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	bool is_repeat_source = (p_repeat_size.x || p_repeat_size.y) && p_repeat_times;
 	canvas_item->repeat_source = is_repeat_source;
@@ -588,6 +873,8 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 		} else if (canvas_item_owner.owns(canvas_item->parent)) {
 			Item *item_owner = canvas_item_owner.get_or_null(canvas_item->parent);
 			item_owner->child_items.erase(canvas_item);
+			_spatial_index_remove_child(canvas_item);
+			_item_spatial_index_changed(item_owner);
 
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner);
@@ -608,6 +895,10 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 			Item *item_owner = canvas_item_owner.get_or_null(p_parent);
 			item_owner->child_items.push_back(canvas_item);
 			item_owner->children_order_dirty = true;
+			if (item_owner->spatial_index) {
+				_spatial_index_add_child(item_owner, canvas_item);
+			}
+			_item_spatial_index_changed(item_owner);
 
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner);
@@ -640,6 +931,7 @@ void RendererCanvasCull::canvas_item_set_light_mask(RID p_item, int p_mask) {
 void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	if (_interpolation_data.interpolation_enabled && canvas_item->interpolated) {
 		if (!canvas_item->on_interpolate_transform_list) {
@@ -685,6 +977,7 @@ void RendererCanvasCull::canvas_item_set_distance_field_mode(RID p_item, bool p_
 void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
@@ -714,13 +1007,37 @@ void RendererCanvasCull::canvas_item_set_draw_behind_parent(RID p_item, bool p_e
 void RendererCanvasCull::canvas_item_set_use_identity_transform(RID p_item, bool p_enable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	canvas_item->use_identity_transform = p_enable;
 }
 
+void RendererCanvasCull::canvas_item_set_use_spatial_index(RID p_item, bool p_enabled) {
+	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
+	ERR_FAIL_NULL(canvas_item);
+
+	if (p_enabled == (canvas_item->spatial_index != nullptr)) {
+		return;
+	}
+
+	if (p_enabled) {
+		canvas_item->spatial_index = memnew(SpatialIndex);
+		for (Item *child : canvas_item->child_items) {
+			_spatial_index_add_child(canvas_item, child);
+		}
+	} else {
+		for (Item *child : canvas_item->child_items) {
+			_spatial_index_remove_child(child);
+		}
+		memdelete(canvas_item->spatial_index);
+		canvas_item->spatial_index = nullptr;
+	}
+}
+
 void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_update) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	canvas_item->update_when_visible = p_update;
 }
@@ -728,6 +1045,7 @@ void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_
 void RendererCanvasCull::canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandPrimitive *line = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(line);
@@ -957,6 +1275,7 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 	ERR_FAIL_COND(p_points.size() < 2);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Color color = Color(1, 1, 1, 1);
 
@@ -1227,6 +1546,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 		}
 		Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 		ERR_FAIL_NULL(canvas_item);
+		_item_spatial_index_changed(canvas_item);
 
 		Vector<Color> colors;
 		if (p_colors.size() == 1) {
@@ -1269,6 +1589,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, const Color &p_color, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1433,6 +1754,7 @@ void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, c
 void RendererCanvasCull::canvas_item_add_ellipse(RID p_item, const Point2 &p_pos, float p_major, float p_minor, const Color &p_color, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	static const int ellipse_segments = 64;
 
@@ -1528,6 +1850,7 @@ void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
 void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p_rect, RID p_texture, bool p_tile, const Color &p_modulate, bool p_transpose) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1559,6 +1882,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p
 void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, int p_outline_size, float p_px_range, float p_scale) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1593,6 +1917,7 @@ void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, co
 void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1625,6 +1950,7 @@ void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, con
 void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, bool p_clip_uv) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1666,6 +1992,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const R
 void RendererCanvasCull::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_rect, const Rect2 &p_source, RID p_texture, const Vector2 &p_topleft, const Vector2 &p_bottomright, RSE::NinePatchAxisMode p_x_axis_mode, RSE::NinePatchAxisMode p_y_axis_mode, bool p_draw_center, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandNinePatch *style = canvas_item->alloc_command<Item::CommandNinePatch>();
 	ERR_FAIL_NULL(style);
@@ -1690,6 +2017,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandPrimitive *prim = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(prim);
@@ -1716,6 +2044,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 #ifdef DEBUG_ENABLED
 	int pointcount = p_points.size();
 	ERR_FAIL_COND(pointcount < 3);
@@ -1737,6 +2066,7 @@ void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2
 void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights, RID p_texture, int p_count) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	int vertex_count = p_points.size();
 	ERR_FAIL_COND(vertex_count == 0);
@@ -1758,6 +2088,7 @@ void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector
 void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandTransform *tr = canvas_item->alloc_command<Item::CommandTransform>();
 	ERR_FAIL_NULL(tr);
@@ -1767,6 +2098,7 @@ void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transfo
 void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, const Transform2D &p_transform, const Color &p_modulate, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 	ERR_FAIL_COND(!p_mesh.is_valid());
 
 	Item::CommandMesh *m = canvas_item->alloc_command<Item::CommandMesh>();
@@ -1786,6 +2118,7 @@ void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, con
 void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandParticles *part = canvas_item->alloc_command<Item::CommandParticles>();
 	ERR_FAIL_NULL(part);
@@ -1800,6 +2133,7 @@ void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles,
 void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandMultiMesh *mm = canvas_item->alloc_command<Item::CommandMultiMesh>();
 	ERR_FAIL_NULL(mm);
@@ -1811,6 +2145,7 @@ void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p
 void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandClipIgnore *ci = canvas_item->alloc_command<Item::CommandClipIgnore>();
 	ERR_FAIL_NULL(ci);
@@ -1820,6 +2155,7 @@ void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore)
 void RendererCanvasCull::canvas_item_add_animation_slice(RID p_item, double p_animation_length, double p_slice_begin, double p_slice_end, double p_offset) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	Item::CommandAnimationSlice *as = canvas_item->alloc_command<Item::CommandAnimationSlice>();
 	ERR_FAIL_NULL(as);
@@ -1857,6 +2193,7 @@ void RendererCanvasCull::canvas_item_set_z_as_relative_to_parent(RID p_item, boo
 void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 	if (canvas_item->skeleton == p_skeleton) {
 		return;
 	}
@@ -1886,6 +2223,7 @@ void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_enable, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 	if (p_enable && (canvas_item->copy_back_buffer == nullptr)) {
 		canvas_item->copy_back_buffer = memnew(RendererCanvasRender::Item::CopyBackBuffer);
 	}
@@ -1903,6 +2241,7 @@ void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
 void RendererCanvasCull::canvas_item_clear(RID p_item) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	canvas_item->clear();
 
@@ -1981,6 +2320,7 @@ void RendererCanvasCull::canvas_item_get_instance_shader_parameter_list(RID p_it
 void RendererCanvasCull::canvas_item_set_visibility_notifier(RID p_item, bool p_enable, const Rect2 &p_area, const Callable &p_enter_callable, const Callable &p_exit_callable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	if (p_enable) {
 		if (!canvas_item->visibility_notifier) {
@@ -2010,6 +2350,7 @@ bool RendererCanvasCull::canvas_item_get_debug_redraw() const {
 void RendererCanvasCull::canvas_item_set_interpolated(RID p_item, bool p_interpolated) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 	canvas_item->interpolated = p_interpolated;
 }
 
@@ -2023,6 +2364,7 @@ void RendererCanvasCull::canvas_item_reset_physics_interpolation(RID p_item) {
 void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 	canvas_item->xform_prev = p_transform * canvas_item->xform_prev;
 	canvas_item->xform_curr = p_transform * canvas_item->xform_curr;
 }
@@ -2030,6 +2372,7 @@ void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item,
 void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RSE::CanvasGroupMode p_mode, float p_clear_margin, bool p_fit_empty, float p_fit_margin, bool p_blur_mipmaps) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_index_changed(canvas_item);
 
 	if (p_mode == RSE::CANVAS_GROUP_MODE_DISABLED) {
 		if (canvas_item->canvas_group != nullptr) {
@@ -2604,6 +2947,8 @@ bool RendererCanvasCull::free(RID p_rid) {
 			} else if (canvas_item_owner.owns(canvas_item->parent)) {
 				Item *item_owner = canvas_item_owner.get_or_null(canvas_item->parent);
 				item_owner->child_items.erase(canvas_item);
+				_spatial_index_remove_child(canvas_item);
+				_item_spatial_index_changed(item_owner);
 
 				if (item_owner->sort_y) {
 					_mark_ysort_dirty(item_owner);
@@ -2612,9 +2957,15 @@ bool RendererCanvasCull::free(RID p_rid) {
 		}
 
 		for (int i = 0; i < canvas_item->child_items.size(); i++) {
+			_spatial_index_remove_child(canvas_item->child_items[i]);
 			canvas_item->child_items[i]->parent = RID();
 		}
 
+		if (canvas_item->spatial_index) {
+			memdelete(canvas_item->spatial_index);
+			canvas_item->spatial_index = nullptr;
+		}
+
 		if (canvas_item->visibility_notifier != nullptr) {
 			visibility_notifier_allocator.free(canvas_item->visibility_notifier);
 		}
@@ -2791,10 +3142,20 @@ RendererCanvasCull::RendererCanvasCull() {
 
 	debug_redraw_time = GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "debug/canvas_items/debug_redraw_time", PROPERTY_HINT_RANGE, "0.1,2,0.001,or_greater"), 1.0);
 	debug_redraw_color = GLOBAL_DEF(PropertyInfo(Variant::COLOR, "debug/canvas_items/debug_redraw_color"), Color(1.0, 0.2, 0.2, 0.5));
+
+	thread_cull_threshold = GLOBAL_GET("rendering/2d/culling/threaded_cull_minimum_items");
+	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one item per thread
+	if (WorkerThreadPool::get_singleton()->get_thread_count() < 2) {
+		thread_cull_threshold = UINT32_MAX; // Nothing to gain from splitting.
+	}
 }
 
 RendererCanvasCull::~RendererCanvasCull() {
 	memfree(z_list);
 	memfree(z_last_list);
+	for (CullThreadData &thread : cull_thread_data) {
+		memfree(thread.z_list);
+		memfree(thread.z_last_list);
+	}
 	_canvas_cull_singleton = nullptr;
 }
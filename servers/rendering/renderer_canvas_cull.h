@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/math/dynamic_bvh.h"
 #include "core/templates/paged_allocator.h"
 #include "servers/rendering/instance_uniforms.h"
 #include "servers/rendering/renderer_canvas_render.h"
@@ -38,10 +39,14 @@
 #include "servers/rendering/rendering_server_types.h"
 
 class RendererCanvasCull {
+	friend class TestRendererCanvasCullInternalsAccessor;
+
 	static void _dependency_changed(Dependency::DependencyChangedNotification p_notification, DependencyTracker *p_tracker);
 	static void _dependency_deleted(const RID &p_dependency, DependencyTracker *p_tracker);
 
 public:
+	struct SpatialIndex;
+
 	struct Item : public RendererCanvasRender::Item {
 		RID parent; // canvas it belongs to
 		RID self;
@@ -77,6 +82,12 @@ public:
 
 		VisibilityNotifierData *visibility_notifier = nullptr;
 
+		SpatialIndex *spatial_index = nullptr; // Indexes the children of this item, if enabled.
+		Item *spatial_index_owner = nullptr; // Parent whose spatial index contains this item.
+		DynamicBVH::ID spatial_index_id; // Only valid while the item is stored in the BVH.
+		bool spatial_index_dirty = false;
+		uint32_t spatial_index_order = 0; // Position in the owner's child_items, used to restore the draw order after culling.
+
 		DependencyTracker dependency_tracker;
 		InstanceUniforms instance_uniforms;
 		SelfList<Item> update_item;
@@ -105,6 +116,28 @@ public:
 		}
 	};
 
+	// Children that rarely move are kept in a BVH in their parent's space, so only the ones
+	// overlapping the viewport are visited. Other children are culled every frame as usual.
+	struct SpatialIndex {
+		DynamicBVH bvh;
+		LocalVector<Item *> dirty_items;
+		LocalVector<Item *> unindexed_items;
+		LocalVector<Item *> cull_result;
+		bool unindexed_dirty = true;
+	};
+
+	_FORCE_INLINE_ void _item_spatial_index_changed(Item *p_item) {
+		if (p_item->spatial_index_owner && !p_item->spatial_index_dirty) {
+			p_item->spatial_index_dirty = true;
+			p_item->spatial_index_owner->spatial_index->dirty_items.push_back(p_item);
+		}
+	}
+	void _spatial_index_add_child(Item *p_owner, Item *p_child);
+	void _spatial_index_remove_child(Item *p_child);
+	bool _get_spatial_index_bounds(const Item *p_item, Rect2 &r_bounds) const;
+	void _update_spatial_index(Item *p_item);
+	uint32_t _cull_spatial_index(Item *p_item, const Transform2D &p_xform, const Rect2 &p_clip_rect);
+
 	void _item_queue_update(Item *p_item, bool p_update_dependencies);
 	SelfList<Item>::List _item_update_list;
 
@@ -114,6 +147,12 @@ public:
 		}
 	};
 
+	struct ItemSpatialIndexOrderSort {
+		_FORCE_INLINE_ bool operator()(const Item *p_left, const Item *p_right) const {
+			return p_left->spatial_index_order < p_right->spatial_index_order;
+		}
+	};
+
 	struct ItemYSort {
 		_FORCE_INLINE_ bool operator()(const Item *p_left, const Item *p_right) const {
 			const real_t left_y = p_left->ysort_xform.columns[2].y;
@@ -220,6 +259,45 @@ private:
 
 	Transform2D _current_camera_transform;
 
+	// Siblings culled together, either the children of an item or the flattened children of a y-sorted item.
+	struct CullBatch {
+		Item **items = nullptr;
+		uint32_t item_count = 0;
+		bool y_sorted = false;
+		Transform2D xform;
+		Rect2 clip_rect;
+		Color modulate;
+		int z = 0;
+		Item *canvas_clip = nullptr;
+		Item *material_owner = nullptr;
+		uint32_t canvas_cull_mask = 0;
+		Point2 repeat_size;
+		int repeat_times = 1;
+		RendererCanvasRender::Item *repeat_source_item = nullptr;
+	};
+
+	// Each thread culls into its own z lists, which are appended to the caller's lists in thread order afterwards.
+	struct CullThreadData {
+		RendererCanvasRender::Item **z_list = nullptr;
+		RendererCanvasRender::Item **z_last_list = nullptr;
+		LocalVector<int> used_z;
+		LocalVector<Item::VisibilityNotifierData *> visible_notifiers;
+		bool redraw_requested = false;
+	};
+
+	LocalVector<CullThreadData> cull_thread_data;
+	LocalVector<Item *> cull_batch_items;
+	uint32_t thread_cull_threshold = 1000;
+	static thread_local CullThreadData *current_cull_thread_data;
+
+	_FORCE_INLINE_ bool _can_cull_threaded(uint32_t p_item_count) const {
+		// Batches are never split again while already culling on a worker thread.
+		return p_item_count >= thread_cull_threshold && current_cull_thread_data == nullptr;
+	}
+	_FORCE_INLINE_ void _cull_batch_item(const CullBatch &p_batch, uint32_t p_index, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list);
+	void _cull_canvas_items_threaded(const CullBatch &p_batch, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list);
+	void _cull_canvas_items_thread(uint32_t p_thread, const CullBatch *p_batch);
+
 public:
 	void render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RSE::CanvasItemTextureFilter p_default_filter, RSE::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel, uint32_t p_canvas_cull_mask, RenderingServerTypes::RenderInfo *r_render_info = nullptr);
 
@@ -256,6 +334,7 @@ public:
 	void canvas_item_set_use_identity_transform(RID p_item, bool p_enable);
 
 	void canvas_item_set_update_when_visible(RID p_item, bool p_update);
+	void canvas_item_set_use_spatial_index(RID p_item, bool p_enabled);
 
 	void canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width = -1.0, bool p_antialiased = false);
 	void canvas_item_add_polyline(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, float p_width = -1.0, bool p_antialiased = false);
@@ -126,7 +126,7 @@ public:
 
 	/* VISIBILITY NOTIFIER API */
 
-	RendererSceneOcclusionCull *dummy_occlusion_culling = nullptr;
+	RendererSceneOcclusionCull *default_occlusion_culling = nullptr;
 
 	/* SCENARIO API */
 
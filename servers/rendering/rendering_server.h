@@ -797,6 +797,7 @@ public:
 	virtual void canvas_item_set_light_mask(RID p_item, int p_mask) = 0;
 
 	virtual void canvas_item_set_update_when_visible(RID p_item, bool p_update) = 0;
+	virtual void canvas_item_set_use_spatial_index(RID p_item, bool p_enabled) = 0;
 
 	virtual void canvas_item_set_transform(RID p_item, const Transform2D &p_transform) = 0;
 	virtual void canvas_item_set_clip(RID p_item, bool p_clip) = 0;
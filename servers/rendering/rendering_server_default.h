@@ -1005,6 +1005,7 @@ public:
 	FUNC2(canvas_item_set_visibility_layer, RID, uint32_t)
 
 	FUNC2(canvas_item_set_update_when_visible, RID, bool)
+	FUNC2(canvas_item_set_use_spatial_index, RID, bool)
 
 	FUNC2(canvas_item_set_transform, RID, const Transform2D &)
 	FUNC2(canvas_item_set_clip, RID, bool)
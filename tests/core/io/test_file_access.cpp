@@ -297,4 +297,14 @@ TEST_CASE("[FileAccess] Cursor positioning") {
 	}
 }
 
+TEST_CASE("[FileAccess] No buffer views of loose files") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("line_endings_lf.test.txt"), FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(2);
+
+	// Only files inside packs are viewed, from the mapping shared by the pack.
+	CHECK(f->get_buffer_view(4).is_empty());
+	CHECK_MESSAGE(f->get_position() == 2, "An unsupported view must leave the cursor untouched.");
+}
+
 } // namespace TestFileAccess
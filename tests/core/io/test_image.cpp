@@ -487,4 +487,84 @@ TEST_CASE("[Image] Convert image") {
 	CHECK_MESSAGE(image2->get_data() == image_data, "Image conversion to invalid type (Image::FORMAT_MAX + 1) should not alter image.");
 }
 
+TEST_CASE("[Image] Processing large images") {
+	// Large enough to be split in row blocks across threads, and to use the SIMD mipmap kernels.
+	const int size = 514;
+	Vector<uint8_t> data;
+	data.resize(size * size * 4);
+	uint32_t seed = 12345;
+	for (int i = 0; i < data.size(); i++) {
+		seed = seed * 1103515245 + 12345;
+		data.write[i] = seed >> 24;
+	}
+	Ref<Image> image = Image::create_from_data(size, size, false, Image::FORMAT_RGBA8, data);
+
+	SUBCASE("Mipmaps of RGBA8 images") {
+		Ref<Image> mipmapped = image->duplicate();
+		mipmapped->generate_mipmaps();
+		const uint8_t *src = mipmapped->ptr();
+		const uint8_t *mip = src + mipmapped->get_mipmap_offset(1);
+		bool matches = true;
+		for (int y = 0; y < size / 2 && matches; y++) {
+			for (int x = 0; x < size / 2 * 4; x++) {
+				const int ofs = (y * 2 * size) * 4 + (x / 4) * 8 + x % 4;
+				const uint8_t expected = (src[ofs] + src[ofs + 4] + src[ofs + size * 4] + src[ofs + size * 4 + 4] + 2) >> 2;
+				if (mip[y * size / 2 * 4 + x] != expected) {
+					matches = false;
+					break;
+				}
+			}
+		}
+		CHECK_MESSAGE(matches, "Every mipmap pixel should be the rounded average of its 2x2 source pixels.");
+	}
+
+	SUBCASE("Mipmaps of RGBAF images") {
+		Ref<Image> mipmapped = image->duplicate();
+		mipmapped->convert(Image::FORMAT_RGBAF);
+		mipmapped->generate_mipmaps();
+		const float *src = reinterpret_cast<const float *>(mipmapped->ptr());
+		const float *mip = reinterpret_cast<const float *>(mipmapped->ptr() + mipmapped->get_mipmap_offset(1));
+		bool matches = true;
+		for (int y = 0; y < size / 2 && matches; y++) {
+			for (int x = 0; x < size / 2 * 4; x++) {
+				const int ofs = (y * 2 * size) * 4 + (x / 4) * 8 + x % 4;
+				const float expected = (src[ofs] + src[ofs + 4] + src[ofs + size * 4] + src[ofs + size * 4 + 4]) * 0.25f;
+				if (mip[y * size / 2 * 4 + x] != expected) {
+					matches = false;
+					break;
+				}
+			}
+		}
+		CHECK_MESSAGE(matches, "Every mipmap pixel should be the average of its 2x2 source pixels.");
+	}
+
+	SUBCASE("Nearest resizing and conversion") {
+		Ref<Image> resized = image->duplicate();
+		resized->resize(700, 300, Image::INTERPOLATE_NEAREST);
+		resized->convert(Image::FORMAT_RGB8);
+		bool matches = true;
+		for (int y = 0; y < 300 && matches; y++) {
+			for (int x = 0; x < 700; x++) {
+				const int src_x = (x + 0.5) * size / 700;
+				const int src_y = (y + 0.5) * size / 300;
+				if (memcmp(resized->ptr() + (y * 700 + x) * 3, data.ptr() + (src_y * size + src_x) * 4, 3) != 0) {
+					matches = false;
+					break;
+				}
+			}
+		}
+		CHECK_MESSAGE(matches, "Every resized pixel should come from the nearest source pixel.");
+	}
+
+	SUBCASE("Repeated resizing is deterministic") {
+		for (int i = 0; i < Image::INTERPOLATE_LANCZOS + 1; i++) {
+			Ref<Image> a = image->duplicate();
+			Ref<Image> b = image->duplicate();
+			a->resize(333, 777, Image::Interpolation(i));
+			b->resize(333, 777, Image::Interpolation(i));
+			CHECK(a->get_data() == b->get_data());
+		}
+	}
+}
+
 } // namespace TestImage
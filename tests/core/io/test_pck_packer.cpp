@@ -33,6 +33,7 @@
 TEST_FORCE_LINK(test_pck_packer)
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_pack.h"
 #include "core/io/pck_packer.h"
 #include "core/os/os.h"
 #include "tests/test_utils.h"
@@ -120,4 +121,127 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			"The generated non-empty PCK file shouldn't be too large.");
 }
 
+static Vector<uint8_t> _make_compressible_data(int p_size) {
+	Vector<uint8_t> data;
+	data.resize(p_size);
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < p_size; i++) {
+		w[i] = uint8_t((i / 7) % 13 + ((i % 1031) == 0 ? i / 1031 : 0));
+	}
+	return data;
+}
+
+TEST_CASE("[PCKPacker] Pack compressed and duplicated files") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	pck_packer.set_compression_enabled(true);
+
+	const Vector<uint8_t> data = _make_compressible_data(300000);
+	CHECK(pck_packer.add_file_from_buffer("a.bin", data) == OK);
+	CHECK(pck_packer.add_file_from_buffer("copy/a.bin", data) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	CHECK_MESSAGE(
+			f->get_length() < data.size() / 2,
+			"Compressible data stored twice should take much less space than a single raw copy.");
+}
+
+TEST_CASE("[PCKPacker] Read compressed chunks at random positions") {
+	const Vector<uint8_t> data = _make_compressible_data(PACK_COMPRESSED_CHUNK_SIZE * 3 + 1234);
+	const Vector<uint8_t> chunks = FileAccessPack::compress_chunks(data.ptr(), data.size());
+	REQUIRE(!chunks.is_empty());
+	CHECK(chunks.size() < data.size());
+
+	const String path = TestUtils::get_temp_path("compressed_chunks.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(chunks);
+	}
+
+	PackedData::PackedFile pf;
+	pf.pack = path;
+	pf.offset = 0;
+	pf.size = data.size();
+	pf.encrypted = false;
+	pf.bundle = false;
+	pf.delta = false;
+	pf.compressed = true;
+	Ref<FileAccess> fp = memnew(FileAccessPack("res://compressed_chunks.bin", pf));
+	REQUIRE(fp->is_open());
+	CHECK(fp->get_length() == (uint64_t)data.size());
+
+	// Reads crossing chunk boundaries, backwards seeks and a short read at the end.
+	const uint64_t positions[] = { 0, PACK_COMPRESSED_CHUNK_SIZE - 10, PACK_COMPRESSED_CHUNK_SIZE * 2 + 5, 100, (uint64_t)data.size() - 50 };
+	for (uint64_t position : positions) {
+		fp->seek(position);
+		Vector<uint8_t> read = fp->get_buffer(100);
+		const int expected = MIN(100, data.size() - (int)position);
+		REQUIRE(read.size() == expected);
+		CHECK(memcmp(read.ptr(), data.ptr() + position, expected) == 0);
+	}
+	CHECK(fp->eof_reached());
+
+	fp->seek(0);
+	CHECK(fp->get_buffer(data.size()) == data);
+}
+
+class MappedPackSource : public PackSource {
+public:
+	Span<uint8_t> mapping;
+
+	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) override { return false; }
+	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) override { return Ref<FileAccess>(); }
+	virtual Span<uint8_t> get_pack_mapping(const String &p_pack) override { return mapping; }
+};
+
+TEST_CASE("[PCKPacker] Files of a pack share its mapping") {
+	const Vector<uint8_t> data = _make_compressible_data(4096);
+	const String path = TestUtils::get_temp_path("mapped_pack.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(data);
+	}
+
+	Ref<FileAccess> pack = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(pack.is_valid());
+	MappedPackSource source;
+	source.mapping = pack->map_contents();
+	if (source.mapping.is_empty()) {
+		return; // Mapping is optional, files are read through regular file access then.
+	}
+	REQUIRE(source.mapping.size() == (uint64_t)data.size());
+
+	PackedData::PackedFile pf;
+	pf.pack = path;
+	pf.offset = 1000;
+	pf.size = 2000;
+	pf.src = &source;
+	pf.encrypted = false;
+	pf.bundle = false;
+	pf.delta = false;
+	Ref<FileAccess> a = memnew(FileAccessPack("res://a.bin", pf));
+	Ref<FileAccess> b = memnew(FileAccessPack("res://b.bin", pf));
+	REQUIRE(a->is_open());
+	REQUIRE(b->is_open());
+
+	a->seek(10);
+	Span<uint8_t> view_a = a->get_buffer_view(100);
+	Span<uint8_t> view_b = b->get_buffer_view(100);
+	CHECK_MESSAGE(view_a.ptr() == source.mapping.ptr() + 1010, "Views should point into the pack mapping.");
+	CHECK_MESSAGE(view_b.ptr() == source.mapping.ptr() + 1000, "Files of the same pack should share the mapping.");
+	CHECK(memcmp(view_a.ptr(), data.ptr() + 1010, 100) == 0);
+	CHECK(a->get_position() == 110);
+	CHECK(a->get_8() == data[1110]);
+
+	CHECK_MESSAGE(b->get_buffer_view(pf.size).is_empty(), "A view should not cross the end of the packed file.");
+	b->seek(1990);
+	CHECK(b->get_buffer(100) == data.slice(2990, 3000));
+	CHECK(b->eof_reached());
+}
+
 } // namespace TestPCKPacker
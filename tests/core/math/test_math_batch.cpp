@@ -0,0 +1,164 @@
+/**************************************************************************/
+/*  test_math_batch.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_math_batch)
+
+#include "core/math/math_batch.h"
+#include "core/math/quaternion.h"
+#include "core/math/random_pcg.h"
+#include "core/math/transform_3d.h"
+
+namespace TestMathBatch {
+
+// Counts that aren't multiples of the SIMD width, to cover the remainder loops too.
+constexpr uint32_t COUNT = 67;
+
+static Vector3 random_vector3(RandomPCG &p_rng) {
+	return Vector3(p_rng.random(-10.0f, 10.0f), p_rng.random(-10.0f, 10.0f), p_rng.random(-10.0f, 10.0f));
+}
+
+static Transform3D random_transform(RandomPCG &p_rng) {
+	return Transform3D(Basis(random_vector3(p_rng), random_vector3(p_rng), random_vector3(p_rng)), random_vector3(p_rng));
+}
+
+TEST_CASE("[MathBatch] Transform points") {
+	RandomPCG rng(1234);
+	const Transform3D xform = random_transform(rng);
+
+	LocalVector<Vector3> points;
+	LocalVector<Vector3> results;
+	points.resize(COUNT);
+	results.resize(COUNT);
+	for (Vector3 &point : points) {
+		point = random_vector3(rng);
+	}
+
+	MathBatch::transform_points(xform, points.ptr(), results.ptr(), COUNT);
+	bool all_equal = true;
+	for (uint32_t i = 0; i < COUNT; i++) {
+		all_equal &= results[i].is_equal_approx(xform.xform(points[i]));
+	}
+	CHECK_MESSAGE(all_equal, "Batch transformed points should match Transform3D.xform().");
+
+	// Transforming in place.
+	MathBatch::transform_points(xform, points.ptr(), points.ptr(), COUNT);
+	all_equal = true;
+	for (uint32_t i = 0; i < COUNT; i++) {
+		all_equal &= points[i] == results[i];
+	}
+	CHECK_MESSAGE(all_equal, "Transforming points in place should give the same results.");
+
+	MathBatch::transform_points(xform, nullptr, nullptr, 0);
+}
+
+TEST_CASE("[MathBatch] Multiply transforms") {
+	RandomPCG rng(5678);
+	const Transform3D parent = random_transform(rng);
+
+	LocalVector<Transform3D> a;
+	LocalVector<Transform3D> b;
+	LocalVector<Transform3D> results;
+	a.resize(COUNT);
+	b.resize(COUNT);
+	results.resize(COUNT);
+	for (uint32_t i = 0; i < COUNT; i++) {
+		a[i] = random_transform(rng);
+		b[i] = random_transform(rng);
+	}
+
+	MathBatch::multiply_transforms(a.ptr(), b.ptr(), results.ptr(), COUNT);
+	bool all_equal = true;
+	for (uint32_t i = 0; i < COUNT; i++) {
+		all_equal &= results[i].is_equal_approx(a[i] * b[i]);
+	}
+	CHECK_MESSAGE(all_equal, "Batch multiplied transforms should match Transform3D multiplication.");
+
+	MathBatch::multiply_transforms(parent, b.ptr(), results.ptr(), COUNT);
+	all_equal = true;
+	for (uint32_t i = 0; i < COUNT; i++) {
+		all_equal &= results[i].is_equal_approx(parent * b[i]);
+	}
+	CHECK_MESSAGE(all_equal, "Transforms multiplied by a parent should match Transform3D multiplication.");
+
+	// Multiplying in place.
+	MathBatch::multiply_transforms(parent, b.ptr(), b.ptr(), COUNT);
+	all_equal = true;
+	for (uint32_t i = 0; i < COUNT; i++) {
+		all_equal &= b[i] == results[i];
+	}
+	CHECK_MESSAGE(all_equal, "Multiplying transforms in place should give the same results.");
+}
+
+TEST_CASE("[MathBatch] Normalize quaternions") {
+	RandomPCG rng(9012);
+
+	LocalVector<Quaternion> quaternions;
+	LocalVector<Quaternion> expected;
+	quaternions.resize(COUNT);
+	expected.resize(COUNT);
+	for (uint32_t i = 0; i < COUNT; i++) {
+		quaternions[i] = Quaternion(rng.random(-10.0f, 10.0f), rng.random(-10.0f, 10.0f), rng.random(-10.0f, 10.0f), rng.random(-10.0f, 10.0f));
+		expected[i] = quaternions[i].normalized();
+	}
+
+	MathBatch::normalize_quaternions(quaternions.ptr(), COUNT);
+	bool all_equal = true;
+	bool all_normalized = true;
+	for (uint32_t i = 0; i < COUNT; i++) {
+		all_equal &= quaternions[i].is_equal_approx(expected[i]);
+		all_normalized &= quaternions[i].is_normalized();
+	}
+	CHECK_MESSAGE(all_equal, "Batch normalized quaternions should match Quaternion.normalized().");
+	CHECK_MESSAGE(all_normalized, "Batch normalized quaternions should be normalized.");
+}
+
+TEST_CASE("[MathBatch] Merge AABBs") {
+	RandomPCG rng(3456);
+
+	LocalVector<AABB> aabbs;
+	aabbs.resize(COUNT);
+	AABB expected;
+	for (uint32_t i = 0; i < COUNT; i++) {
+		aabbs[i] = AABB(random_vector3(rng), random_vector3(rng).abs());
+		if (i == 0) {
+			expected = aabbs[i];
+		} else {
+			expected.merge_with(aabbs[i]);
+		}
+	}
+
+	CHECK_MESSAGE(MathBatch::merge_aabbs(aabbs.ptr(), COUNT).is_equal_approx(expected), "Batch merged AABB should match AABB.merge_with().");
+	CHECK_MESSAGE(MathBatch::merge_aabbs(aabbs.ptr(), 1).is_equal_approx(aabbs[0]), "Merging a single AABB should return it unchanged.");
+	CHECK_MESSAGE(MathBatch::merge_aabbs(aabbs.ptr(), 0) == AABB(), "Merging no AABBs should return an empty AABB.");
+}
+
+} // namespace TestMathBatch
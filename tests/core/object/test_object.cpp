@@ -36,7 +36,10 @@ TEST_FORCE_LINK(test_object)
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 #include "tests/signal_watcher.h"
+#include "tests/test_utils.h"
 
 namespace TestObject {
 
@@ -310,6 +313,17 @@ class SignalReceiver : public Object {
 
 public:
 	Vector<Variant> received_args;
+	int call_count = 0;
+	Object *emitter = nullptr;
+
+	void callback_count() {
+		call_count++;
+	}
+
+	void callback_disconnect() {
+		call_count++;
+		emitter->disconnect("my_custom_signal", callable_mp(this, &SignalReceiver::callback_disconnect));
+	}
 
 	void callback0() {
 		received_args = Vector<Variant>{};
@@ -468,6 +482,31 @@ TEST_CASE("[Object] Signals") {
 		CHECK(signal_connections.size() == 0);
 	}
 
+	SUBCASE("Changing connections while emitting should only affect the next emission") {
+		SignalReceiver first;
+		SignalReceiver second;
+		first.emitter = &object;
+
+		object.connect("my_custom_signal", callable_mp(&first, &SignalReceiver::callback_disconnect));
+		object.connect("my_custom_signal", callable_mp(&second, &SignalReceiver::callback_count));
+		object.emit_signal("my_custom_signal");
+		CHECK_EQ(first.call_count, 1);
+		CHECK_EQ(second.call_count, 1);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&first, &SignalReceiver::callback_disconnect)));
+
+		object.emit_signal("my_custom_signal");
+		CHECK_EQ(first.call_count, 1);
+		CHECK_EQ(second.call_count, 2);
+
+		object.connect("my_custom_signal", callable_mp(&first, &SignalReceiver::callback_count), Object::CONNECT_ONE_SHOT);
+		object.emit_signal("my_custom_signal");
+		object.emit_signal("my_custom_signal");
+		CHECK_EQ(first.call_count, 2);
+		CHECK_EQ(second.call_count, 4);
+
+		object.disconnect("my_custom_signal", callable_mp(&second, &SignalReceiver::callback_count));
+	}
+
 	SUBCASE("Connecting with CONNECT_APPEND_SOURCE_OBJECT flag") {
 		SignalReceiver target;
 
@@ -653,6 +692,215 @@ TEST_CASE("[Object] Destruction at the end of the call chain is safe") {
 			"Object was tail-deleted without crashes.");
 }
 
+TEST_CASE("[Object] ObjectDB lookups are invalidated on free") {
+	const int count_before = ObjectDB::get_object_count();
+
+	Object *object = memnew(Object);
+	const ObjectID id = object->get_instance_id();
+	CHECK(ObjectDB::get_instance(id) == object);
+	CHECK(ObjectDB::get_object_count() == count_before + 1);
+
+	memdelete(object);
+	CHECK(ObjectDB::get_instance(id) == nullptr);
+	CHECK(ObjectDB::get_object_count() == count_before);
+
+	// The slot may be reused, but never under the same ID.
+	Object *other = memnew(Object);
+	CHECK(other->get_instance_id() != id);
+	CHECK(ObjectDB::get_instance(id) == nullptr);
+	memdelete(other);
+}
+
+static constexpr uint32_t OBJECTDB_STRESS_THREADS = 4;
+static constexpr uint32_t OBJECTDB_STRESS_ROUNDS = 64;
+static constexpr uint32_t OBJECTDB_STRESS_OBJECTS = 256;
+
+struct ObjectDBStressData {
+	SafeNumeric<uint32_t> failures;
+};
+
+static void objectdb_stress(void *p_data) {
+	ObjectDBStressData *data = (ObjectDBStressData *)p_data;
+	LocalVector<Object *> objects;
+	LocalVector<ObjectID> ids;
+	objects.resize(OBJECTDB_STRESS_OBJECTS);
+	ids.resize(OBJECTDB_STRESS_OBJECTS);
+
+	for (uint32_t round = 0; round < OBJECTDB_STRESS_ROUNDS; round++) {
+		for (uint32_t i = 0; i < OBJECTDB_STRESS_OBJECTS; i++) {
+			objects[i] = (i % 2) ? memnew(RefCounted) : memnew(Object);
+			ids[i] = objects[i]->get_instance_id();
+		}
+		for (uint32_t i = 0; i < OBJECTDB_STRESS_OBJECTS; i++) {
+			if (ObjectDB::get_instance(ids[i]) != objects[i] || ids[i].is_ref_counted() != bool(i % 2)) {
+				data->failures.increment();
+			}
+		}
+		// Free out of order, so slots move between threads through the shared free list.
+		for (uint32_t i = 0; i < OBJECTDB_STRESS_OBJECTS; i += 2) {
+			memdelete(objects[i]);
+		}
+		for (uint32_t i = 1; i < OBJECTDB_STRESS_OBJECTS; i += 2) {
+			memdelete(objects[i]);
+		}
+		for (uint32_t i = 0; i < OBJECTDB_STRESS_OBJECTS; i++) {
+			if (ObjectDB::get_instance(ids[i]) != nullptr) {
+				data->failures.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[Object] ObjectDB handles concurrent creation and deletion") {
+	const int count_before = ObjectDB::get_object_count();
+	ObjectDBStressData data;
+
+	Thread threads[OBJECTDB_STRESS_THREADS];
+	for (uint32_t i = 0; i < OBJECTDB_STRESS_THREADS; i++) {
+		threads[i].start(objectdb_stress, &data);
+	}
+	for (uint32_t i = 0; i < OBJECTDB_STRESS_THREADS; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	CHECK(data.failures.get() == 0);
+	CHECK(ObjectDB::get_object_count() == count_before);
+}
+
+static constexpr uint32_t OBJECTDB_BENCHMARK_OBJECTS = 1000000;
+static constexpr uint32_t OBJECTDB_BENCHMARK_MAX_THREADS = 8;
+static constexpr uint32_t OBJECTDB_BENCHMARK_LOOKUP_ROUNDS = 10;
+
+struct ObjectDBBenchmarkData {
+	uint32_t from = 0;
+	uint32_t to = 0;
+	const LocalVector<ObjectID> *ids = nullptr;
+	const LocalVector<Ref<RefCounted>> *objects = nullptr;
+	SafeNumeric<uint32_t> *failures = nullptr;
+};
+
+static void objectdb_benchmark_create_free(void *p_data) {
+	ObjectDBBenchmarkData *data = (ObjectDBBenchmarkData *)p_data;
+	LocalVector<Ref<RefCounted>> objects;
+	objects.resize(data->to - data->from);
+	for (Ref<RefCounted> &object : objects) {
+		object.instantiate();
+	}
+	objects.clear();
+}
+
+static void objectdb_benchmark_lookup(void *p_data) {
+	ObjectDBBenchmarkData *data = (ObjectDBBenchmarkData *)p_data;
+	for (uint32_t round = 0; round < OBJECTDB_BENCHMARK_LOOKUP_ROUNDS; round++) {
+		for (uint32_t i = data->from; i < data->to; i++) {
+			if (ObjectDB::get_instance((*data->ids)[i]) != (*data->objects)[i].ptr()) {
+				data->failures->increment();
+			}
+		}
+	}
+}
+
+static double objectdb_benchmark_threads(uint32_t p_thread_count, ObjectDBBenchmarkData p_data, void (*p_function)(void *)) {
+	ObjectDBBenchmarkData data[OBJECTDB_BENCHMARK_MAX_THREADS];
+	Thread threads[OBJECTDB_BENCHMARK_MAX_THREADS];
+	const uint64_t from = OS::get_singleton()->get_ticks_usec();
+	for (uint32_t i = 0; i < p_thread_count; i++) {
+		data[i] = p_data;
+		data[i].from = i * OBJECTDB_BENCHMARK_OBJECTS / p_thread_count;
+		data[i].to = (i + 1) * OBJECTDB_BENCHMARK_OBJECTS / p_thread_count;
+		threads[i].start(p_function, &data[i]);
+	}
+	for (uint32_t i = 0; i < p_thread_count; i++) {
+		threads[i].wait_to_finish();
+	}
+	return double(OS::get_singleton()->get_ticks_usec() - from) / 1000.0;
+}
+
+// Skipped by default; run it with:
+//   godot --test --no-skip --test-case="*[Benchmark]*" [--benchmark-objectdb-file <path>]
+// The same 1M objects are split between the threads, so with perfect scaling the wall time drops.
+TEST_CASE("[Object][Benchmark] ObjectDB with 1M RefCounted objects" * doctest::skip()) {
+	SafeNumeric<uint32_t> failures;
+	LocalVector<Ref<RefCounted>> objects;
+	LocalVector<ObjectID> ids;
+	objects.resize(OBJECTDB_BENCHMARK_OBJECTS);
+	ids.resize(OBJECTDB_BENCHMARK_OBJECTS);
+	for (uint32_t i = 0; i < OBJECTDB_BENCHMARK_OBJECTS; i++) {
+		objects[i].instantiate();
+		ids[i] = objects[i]->get_instance_id();
+	}
+
+	ObjectDBBenchmarkData data;
+	data.ids = &ids;
+	data.objects = &objects;
+	data.failures = &failures;
+
+	Array results;
+	for (uint32_t thread_count : { 1, 2, 4, 8 }) {
+		Dictionary result;
+		result["threads"] = thread_count;
+		result["create_free_msec"] = objectdb_benchmark_threads(thread_count, data, objectdb_benchmark_create_free);
+		result["lookup_msec"] = objectdb_benchmark_threads(thread_count, data, objectdb_benchmark_lookup);
+		results.push_back(result);
+	}
+	objects.clear();
+
+	CHECK_MESSAGE(failures.get() == 0, "Every ObjectDB lookup should find its object.");
+
+	Dictionary report;
+	report["benchmark"] = "objectdb";
+	report["objects"] = OBJECTDB_BENCHMARK_OBJECTS;
+	report["lookup_rounds"] = OBJECTDB_BENCHMARK_LOOKUP_ROUNDS;
+	report["results"] = results;
+	REQUIRE_MESSAGE(TestUtils::write_benchmark_report("objectdb", report), "Couldn't write the benchmark results file.");
+}
+
+static constexpr uint32_t SIGNAL_BENCHMARK_EMISSIONS = 100000;
+
+static uint64_t signal_benchmark_calls = 0;
+
+static void signal_benchmark_callback(int p_connection) {
+	signal_benchmark_calls++;
+}
+
+// Skipped by default; run it with:
+//   godot --test --no-skip --test-case="*[Benchmark]*" [--benchmark-signal-emission-file <path>]
+// Plain Objects take the signal mutex when emitting, unlike Nodes.
+TEST_CASE("[Object][Benchmark] Signal emission" * doctest::skip()) {
+	const StringName signal_name = "benchmark_signal";
+
+	Array results;
+	for (uint32_t connections : { 0, 1, 8, 64 }) {
+		Object *object = memnew(Object);
+		object->add_user_signal(MethodInfo(signal_name));
+		for (uint32_t i = 0; i < connections; i++) {
+			object->connect(signal_name, callable_mp_static(&signal_benchmark_callback).bind(i));
+		}
+
+		signal_benchmark_calls = 0;
+		const uint64_t from = OS::get_singleton()->get_ticks_usec();
+		for (uint32_t i = 0; i < SIGNAL_BENCHMARK_EMISSIONS; i++) {
+			object->emit_signal(signal_name);
+		}
+		const uint64_t usec = MAX<uint64_t>(OS::get_singleton()->get_ticks_usec() - from, 1);
+		memdelete(object);
+
+		CHECK(signal_benchmark_calls == uint64_t(SIGNAL_BENCHMARK_EMISSIONS) * connections);
+
+		Dictionary result;
+		result["connections"] = connections;
+		result["msec"] = double(usec) / 1000.0;
+		result["emits_per_sec"] = double(SIGNAL_BENCHMARK_EMISSIONS) * 1000000.0 / usec;
+		results.push_back(result);
+	}
+
+	Dictionary report;
+	report["benchmark"] = "signal-emission";
+	report["emissions"] = SIGNAL_BENCHMARK_EMISSIONS;
+	report["results"] = results;
+	REQUIRE_MESSAGE(TestUtils::write_benchmark_report("signal-emission", report), "Couldn't write the benchmark results file.");
+}
+
 int required_param_compare(const Ref<RefCounted> &p_ref, const RequiredParam<RefCounted> &rp_required) {
 	EXTRACT_PARAM_OR_FAIL_V(p_required, rp_required, false);
 	ERR_FAIL_COND_V(p_ref->get_reference_count() != p_required->get_reference_count(), -1);
@@ -0,0 +1,110 @@
+/**************************************************************************/
+/*  test_frame_arena.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_frame_arena)
+
+#include "core/os/frame_arena.h"
+
+namespace TestFrameArena {
+
+static void _ensure_frame_arena() {
+	if (!FrameArena::is_enabled()) {
+		FrameArena::setup(256 * 1024);
+	}
+	// Start from a clean frame for this thread.
+	FrameArena::end_frame();
+}
+
+TEST_CASE("[FrameArena] Allocations are only served inside a scope") {
+	_ensure_frame_arena();
+
+	String outside = String("outside ") + itos(1);
+	CHECK_FALSE(FrameArena::owns(outside.ptr()));
+
+	{
+		FrameArena::Scope scope;
+		CHECK(FrameArena::is_active());
+
+		String inside = String("inside ") + itos(2);
+		CHECK(FrameArena::owns(inside.ptr()));
+		CHECK(inside == "inside 2");
+
+		Vector<uint8_t> large;
+		large.resize(FrameArena::MAX_ALLOCATION_SIZE * 2);
+		CHECK_FALSE(FrameArena::owns(large.ptr()));
+	}
+	CHECK_FALSE(FrameArena::is_active());
+
+	FrameArena::end_frame();
+	const FrameArena::Stats stats = FrameArena::get_last_frame_stats();
+	CHECK(stats.allocations > 0);
+	CHECK(stats.fallbacks > 0);
+	CHECK(stats.pinned_chunks == 0);
+}
+
+TEST_CASE("[FrameArena] Payloads outliving the frame stay valid") {
+	_ensure_frame_arena();
+
+	String escaped;
+	Vector<int> grown;
+	{
+		FrameArena::Scope scope;
+		escaped = String("escaped ") + itos(42);
+		CHECK(FrameArena::owns(escaped.ptr()));
+
+		grown.push_back(1);
+		CHECK(FrameArena::owns(grown.ptr()));
+		for (int i = 2; i <= 1000; i++) {
+			grown.push_back(i);
+		}
+		// Growing past the arena limit moves the buffer back to the system allocator.
+		CHECK_FALSE(FrameArena::owns(grown.ptr()));
+	}
+
+	FrameArena::end_frame();
+	CHECK(FrameArena::get_last_frame_stats().pinned_chunks == 1);
+
+	{
+		FrameArena::Scope scope;
+		for (int i = 0; i < 100; i++) {
+			String temp = String("temp ") + itos(i);
+		}
+	}
+	FrameArena::end_frame();
+
+	CHECK(escaped == "escaped 42");
+	CHECK(grown.size() == 1000);
+	CHECK(grown[0] == 1);
+	CHECK(grown[999] == 1000);
+}
+
+} // namespace TestFrameArena
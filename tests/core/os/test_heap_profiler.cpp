@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  test_heap_profiler.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_heap_profiler)
+
+#include "core/os/heap_profiler.h"
+
+namespace TestHeapProfiler {
+
+static const char *TEST_TAG = "heap_profiler_test";
+
+static HeapProfiler::Callsite _get_tag_totals(const char *p_tag) {
+	LocalVector<HeapProfiler::Callsite> callsites;
+	HeapProfiler::get_callsites(callsites);
+
+	HeapProfiler::Callsite totals;
+	for (const HeapProfiler::Callsite &callsite : callsites) {
+		if (callsite.tag == p_tag) {
+			totals.live_bytes += callsite.live_bytes;
+			totals.allocated_bytes += callsite.allocated_bytes;
+		}
+	}
+	return totals;
+}
+
+TEST_CASE("[HeapProfiler] Live and allocated bytes per tag") {
+	// Sample every allocation.
+	HeapProfiler::start(1);
+	CHECK(HeapProfiler::is_active());
+
+	void *kept = nullptr;
+	{
+		HeapProfiler::Tag tag(TEST_TAG);
+		kept = memalloc(1000);
+		void *freed = memalloc(500);
+		memfree(freed);
+	}
+
+	HeapProfiler::Callsite totals = _get_tag_totals(TEST_TAG);
+	CHECK(totals.live_bytes == 1000);
+	CHECK(totals.allocated_bytes == 1500);
+
+	kept = memrealloc(kept, 2000);
+	// Reallocated outside of the tag, so the new block is accounted elsewhere.
+	totals = _get_tag_totals(TEST_TAG);
+	CHECK(totals.live_bytes == 0);
+
+	memfree(kept);
+	HeapProfiler::stop();
+	CHECK_FALSE(HeapProfiler::is_active());
+}
+
+TEST_CASE("[HeapProfiler] Samples are weighted by the interval") {
+	HeapProfiler::start(4096);
+
+	LocalVector<void *> blocks;
+	blocks.reserve(256);
+	{
+		HeapProfiler::Tag tag(TEST_TAG);
+		for (int i = 0; i < 256; i++) {
+			blocks.push_back(memalloc(64));
+		}
+	}
+
+	// 16 KiB allocated in total, with roughly one sample every 4 KiB, each worth 4 KiB.
+	const HeapProfiler::Callsite totals = _get_tag_totals(TEST_TAG);
+	CHECK(totals.allocated_bytes >= 8 * 1024);
+	CHECK(totals.allocated_bytes <= 24 * 1024);
+	CHECK(totals.live_bytes == totals.allocated_bytes);
+
+	for (void *block : blocks) {
+		memfree(block);
+	}
+	CHECK(_get_tag_totals(TEST_TAG).live_bytes == 0);
+
+	HeapProfiler::stop();
+}
+
+} // namespace TestHeapProfiler
@@ -0,0 +1,178 @@
+/**************************************************************************/
+/*  test_string_name.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_string_name)
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
+#include "tests/test_utils.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Equal strings share the same data") {
+	const StringName a = "string_name_test";
+	const StringName b = String("string_name_test");
+	const StringName c = "string_name_other";
+
+	CHECK(a == b);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(a != c);
+	CHECK(a.hash() == String("string_name_test").hash());
+	CHECK(StringName("").is_empty());
+}
+
+TEST_CASE("[StringName] Interning many names keeps them unique") {
+	constexpr int COUNT = 100000;
+	LocalVector<StringName> names;
+	names.reserve(COUNT);
+	for (int i = 0; i < COUNT; i++) {
+		names.push_back(StringName("string_name_many_" + itos(i)));
+	}
+
+	bool all_found = true;
+	for (int i = 0; i < COUNT; i++) {
+		const StringName again = "string_name_many_" + itos(i);
+		all_found = all_found && again.data_unique_pointer() == names[i].data_unique_pointer();
+	}
+	CHECK(all_found);
+	CHECK(names[0] != names[COUNT - 1]);
+}
+
+static constexpr int THREAD_COUNT = 4;
+static constexpr int THREAD_NAMES = 2000;
+
+struct ThreadData {
+	LocalVector<StringName> names;
+};
+
+static void intern_names(void *p_data) {
+	ThreadData *data = (ThreadData *)p_data;
+	data->names.resize(THREAD_NAMES);
+	for (int round = 0; round < 4; round++) {
+		for (int i = 0; i < THREAD_NAMES; i++) {
+			// Temporary names are released right away, racing with other threads interning them.
+			const StringName temporary = "string_name_temporary_" + itos(i);
+			data->names[i] = "string_name_shared_" + itos(i);
+		}
+	}
+}
+
+TEST_CASE("[StringName] Interning from several threads returns the same data") {
+	ThreadData data[THREAD_COUNT];
+	Thread threads[THREAD_COUNT];
+	for (int i = 0; i < THREAD_COUNT; i++) {
+		threads[i].start(intern_names, &data[i]);
+	}
+	for (int i = 0; i < THREAD_COUNT; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	bool all_equal = true;
+	for (int i = 0; i < THREAD_NAMES; i++) {
+		const StringName expected = "string_name_shared_" + itos(i);
+		for (int j = 0; j < THREAD_COUNT; j++) {
+			all_equal = all_equal && data[j].names[i].data_unique_pointer() == expected.data_unique_pointer();
+		}
+	}
+	CHECK(all_equal);
+}
+
+static constexpr int BENCHMARK_MAX_THREADS = 8;
+static constexpr int BENCHMARK_NAMES = 20000;
+static constexpr int BENCHMARK_ROUNDS = 10;
+
+struct BenchmarkThreadData {
+	const LocalVector<String> *names = nullptr;
+};
+
+static void intern_and_release_names(void *p_data) {
+	BenchmarkThreadData *data = (BenchmarkThreadData *)p_data;
+	LocalVector<StringName> interned;
+	interned.reserve(data->names->size());
+	for (int round = 0; round < BENCHMARK_ROUNDS; round++) {
+		for (const String &name : *data->names) {
+			interned.push_back(StringName(name));
+		}
+		// Releasing the last reference removes the names from the table again.
+		interned.clear();
+	}
+}
+
+// Skipped by default; run it with:
+//   godot --test --no-skip --test-case="*[Benchmark]*" [--benchmark-string-name-file <path>]
+// Each thread does the same amount of work, so with perfect scaling the wall time stays flat.
+TEST_CASE("[StringName][Benchmark] Interning scales with threads" * doctest::skip()) {
+	// Built ahead, so only interning and releasing is measured.
+	LocalVector<String> distinct_names[BENCHMARK_MAX_THREADS];
+	LocalVector<String> shared_names;
+	for (int i = 0; i < BENCHMARK_MAX_THREADS; i++) {
+		for (int j = 0; j < BENCHMARK_NAMES; j++) {
+			distinct_names[i].push_back(vformat("benchmark_name_%d_%d", i, j));
+		}
+	}
+	for (int j = 0; j < BENCHMARK_NAMES; j++) {
+		shared_names.push_back(vformat("benchmark_shared_name_%d", j));
+	}
+
+	Array results;
+	for (bool shared : { false, true }) {
+		for (int thread_count : { 1, 2, 4, 8 }) {
+			BenchmarkThreadData data[BENCHMARK_MAX_THREADS];
+			Thread threads[BENCHMARK_MAX_THREADS];
+			const uint64_t from = OS::get_singleton()->get_ticks_usec();
+			for (int i = 0; i < thread_count; i++) {
+				data[i].names = shared ? &shared_names : &distinct_names[i];
+				threads[i].start(intern_and_release_names, &data[i]);
+			}
+			for (int i = 0; i < thread_count; i++) {
+				threads[i].wait_to_finish();
+			}
+			const double msec = double(OS::get_singleton()->get_ticks_usec() - from) / 1000.0;
+
+			Dictionary result;
+			result["names"] = shared ? "shared" : "distinct";
+			result["threads"] = thread_count;
+			result["msec"] = msec;
+			result["interned_per_sec"] = double(thread_count) * BENCHMARK_NAMES * BENCHMARK_ROUNDS / (msec / 1000.0);
+			results.push_back(result);
+		}
+	}
+
+	Dictionary report;
+	report["benchmark"] = "string_name";
+	report["results"] = results;
+	REQUIRE_MESSAGE(TestUtils::write_benchmark_report("string-name", report), "Couldn't write the benchmark results file.");
+}
+
+} // namespace TestStringName
@@ -0,0 +1,185 @@
+/**************************************************************************/
+/*  test_small_hash_map.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_small_hash_map)
+
+#include "core/templates/small_hash_map.h"
+
+namespace TestSmallHashMap {
+
+TEST_CASE("[SmallHashMap] Insert and lookup before promotion") {
+	SmallHashMap<int, int> map;
+	SmallHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK_FALSE(map.has(43));
+	CHECK(map.getptr(43) == nullptr);
+	CHECK_FALSE(map.is_promoted());
+
+	map[42] = 1234;
+	CHECK(map.size() == 1);
+	CHECK(map[42] == 1234);
+}
+
+TEST_CASE("[SmallHashMap] Promotion preserves insertion order") {
+	SmallHashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, 4> map;
+	for (int i = 0; i < 4; i++) {
+		map.insert(10 - i, i);
+	}
+	CHECK_FALSE(map.is_promoted());
+
+	map[100] = 4;
+	map[101] = 5;
+	CHECK(map.is_promoted());
+	CHECK(map.size() == 6);
+
+	const int expected_keys[] = { 10, 9, 8, 7, 100, 101 };
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected_keys[idx]);
+		CHECK(E.value == idx);
+		idx++;
+	}
+	CHECK(idx == 6);
+}
+
+TEST_CASE("[SmallHashMap] Erase before promotion") {
+	SmallHashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, 4> map;
+	map.insert(1, 1);
+	map.insert(2, 2);
+	map.insert(3, 3);
+	map.insert(4, 4);
+
+	CHECK(map.erase(2));
+	CHECK_FALSE(map.erase(2));
+	map.insert(5, 5);
+	CHECK_FALSE(map.is_promoted());
+	CHECK(map.size() == 4);
+
+	const int expected_keys[] = { 1, 3, 4, 5 };
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected_keys[idx++]);
+	}
+
+	CHECK(map.erase(1));
+	CHECK(map.erase(5));
+	CHECK(map.begin()->key == 3);
+	CHECK(map.size() == 2);
+}
+
+TEST_CASE("[SmallHashMap] Pointers to entries stay valid across promotion") {
+	SmallHashMap<int, String, HashMapHasherDefault, HashMapComparatorDefault<int>, 4> map;
+	String &first = map[1];
+	first = "one";
+	map.insert(2, "two");
+	String *second = map.getptr(2);
+	SmallHashMap<int, String, HashMapHasherDefault, HashMapComparatorDefault<int>, 4>::Iterator third = map.insert(3, "three");
+	map.insert(4, "four");
+	CHECK_FALSE(map.is_promoted());
+
+	map[5] = "five";
+	CHECK(map.is_promoted());
+	CHECK(&first == map.getptr(1));
+	CHECK(second == map.getptr(2));
+	CHECK(&third->value == map.getptr(3));
+	CHECK(first == "one");
+	CHECK(*second == "two");
+	CHECK(third->value == "three");
+
+	// Erasing moves the last entry into the freed spot, which must not move the entry itself.
+	map.clear();
+	map.insert(1, "one");
+	map.insert(2, "two");
+	String *last = map.getptr(2);
+	map.erase(1);
+	map.insert(3, "three");
+	CHECK(last == map.getptr(2));
+	CHECK(*map.getptr(3) == "three");
+}
+
+TEST_CASE("[SmallHashMap] Copy and clear") {
+	SmallHashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, 4> map;
+	for (int i = 0; i < 8; i++) {
+		map.insert(i, i * 2);
+	}
+	CHECK(map.is_promoted());
+
+	SmallHashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, 4> copy(map);
+	CHECK(copy.is_promoted());
+	CHECK(copy.size() == 8);
+	CHECK(copy[7] == 14);
+
+	// A promoted map that shrank is not promoted again when copied.
+	for (int i = 0; i < 6; i++) {
+		map.erase(i);
+	}
+	copy = map;
+	CHECK_FALSE(copy.is_promoted());
+	CHECK(copy.size() == 2);
+	CHECK(copy.begin()->key == 6);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK_FALSE(map.is_promoted());
+	map.insert(1, 1);
+	CHECK(map[1] == 1);
+}
+
+TEST_CASE("[SmallHashMap] Sort inline and promoted") {
+	SmallHashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, 4> map;
+	map.insert(3, 0);
+	map.insert(1, 0);
+	map.insert(2, 0);
+	map.sort_custom<KeyValueSort<int, int>>();
+
+	int expected = 1;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected++);
+	}
+
+	map.insert(0, 0);
+	map.insert(-1, 0);
+	CHECK(map.is_promoted());
+	map.sort_custom<KeyValueSort<int, int>>();
+
+	expected = -1;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected++);
+	}
+}
+
+} // namespace TestSmallHashMap
@@ -0,0 +1,148 @@
+/**************************************************************************/
+/*  test_work_stealing_deque.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_work_stealing_deque)
+
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
+
+namespace TestWorkStealingDeque {
+
+TEST_CASE("[WorkStealingDeque] Pop is LIFO, steal is FIFO") {
+	WorkStealingDeque<int, 8> deque;
+	CHECK(deque.is_empty());
+
+	for (int i = 0; i < 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK(deque.size() == 4);
+
+	int value = -1;
+	CHECK(deque.pop(value));
+	CHECK(value == 3);
+	CHECK(deque.steal(value));
+	CHECK(value == 0);
+	CHECK(deque.pop(value));
+	CHECK(value == 2);
+	CHECK(deque.steal(value));
+	CHECK(value == 1);
+
+	CHECK(deque.is_empty());
+	CHECK_FALSE(deque.pop(value));
+	CHECK_FALSE(deque.steal(value));
+}
+
+TEST_CASE("[WorkStealingDeque] Full deque rejects pushes") {
+	WorkStealingDeque<int, 4> deque;
+	for (int i = 0; i < 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK_FALSE(deque.push(4));
+	CHECK(deque.size() == deque.get_capacity());
+
+	int value = -1;
+	CHECK(deque.steal(value));
+	CHECK(value == 0);
+	CHECK(deque.push(4));
+
+	// Wraps around the buffer.
+	for (int i = 4; i >= 1; i--) {
+		CHECK(deque.pop(value));
+		CHECK(value == i);
+	}
+	CHECK(deque.is_empty());
+}
+
+static constexpr uint32_t STRESS_ITEMS = 100000;
+static constexpr uint32_t STRESS_STEALERS = 3;
+
+struct StressData {
+	WorkStealingDeque<uint32_t, 256> deque;
+	LocalVector<SafeNumeric<uint32_t>> taken;
+	SafeNumeric<uint32_t> taken_count;
+	SafeFlag done;
+};
+
+static void stress_stealer(void *p_data) {
+	StressData *data = (StressData *)p_data;
+	while (!data->done.is_set() || !data->deque.is_empty()) {
+		uint32_t value;
+		if (data->deque.steal(value)) {
+			data->taken[value].increment();
+			data->taken_count.increment();
+		}
+	}
+}
+
+TEST_CASE("[WorkStealingDeque] Concurrent stealing takes every item exactly once") {
+	StressData data;
+	data.taken.resize(STRESS_ITEMS);
+
+	Thread stealers[STRESS_STEALERS];
+	for (uint32_t i = 0; i < STRESS_STEALERS; i++) {
+		stealers[i].start(stress_stealer, &data);
+	}
+
+	for (uint32_t i = 0; i < STRESS_ITEMS; i++) {
+		while (!data.deque.push(i)) {
+			// Full; help draining it from the owner side.
+			uint32_t value;
+			if (data.deque.pop(value)) {
+				data.taken[value].increment();
+				data.taken_count.increment();
+			}
+		}
+		if (i % 3 == 0) {
+			uint32_t value;
+			if (data.deque.pop(value)) {
+				data.taken[value].increment();
+				data.taken_count.increment();
+			}
+		}
+	}
+	data.done.set();
+
+	for (uint32_t i = 0; i < STRESS_STEALERS; i++) {
+		stealers[i].wait_to_finish();
+	}
+
+	CHECK(data.taken_count.get() == STRESS_ITEMS);
+	bool all_taken_once = true;
+	for (uint32_t i = 0; i < STRESS_ITEMS; i++) {
+		all_taken_once &= data.taken[i].get() == 1;
+	}
+	CHECK(all_taken_once);
+}
+
+} // namespace TestWorkStealingDeque
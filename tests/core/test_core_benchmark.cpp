@@ -0,0 +1,99 @@
+/**************************************************************************/
+/*  test_core_benchmark.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_core_benchmark)
+
+#include "core/os/frame_arena.h"
+#include "core/os/os.h"
+#include "tests/test_utils.h"
+
+namespace TestCoreBenchmark {
+
+// CPU time of core allocation helpers, to compare before and after changes to them.
+// They are skipped by default; run them with:
+//   godot --test --no-skip --test-case="*[Benchmark]*" [--benchmark-core-file <path>]
+// Results are printed as JSON, and also written to <path> if given.
+
+template <typename F>
+double measure_msec(F p_function) {
+	const uint64_t from = OS::get_singleton()->get_ticks_usec();
+	p_function();
+	return double(OS::get_singleton()->get_ticks_usec() - from) / 1000.0;
+}
+
+Dictionary benchmark_frame_arena() {
+	constexpr uint32_t FRAMES = 100;
+	constexpr uint32_t TEMPORARIES = 1000;
+
+	if (!FrameArena::is_enabled()) {
+		FrameArena::setup(256 * 1024);
+	}
+	FrameArena::end_frame();
+
+	auto frame = []() {
+		for (uint32_t i = 0; i < TEMPORARIES; i++) {
+			String temp = String("temporary ") + itos(i);
+			Vector<int> values;
+			values.push_back(i);
+		}
+	};
+
+	Dictionary result;
+	result["name"] = "frame_arena";
+	result["malloc_msec"] = measure_msec([&]() {
+		for (uint32_t i = 0; i < FRAMES; i++) {
+			frame();
+		}
+	});
+	result["arena_msec"] = measure_msec([&]() {
+		for (uint32_t i = 0; i < FRAMES; i++) {
+			{
+				FrameArena::Scope scope;
+				frame();
+			}
+			FrameArena::end_frame();
+		}
+	});
+	return result;
+}
+
+TEST_CASE("[Benchmark] Core CPU time" * doctest::skip()) {
+	Array results;
+	results.push_back(benchmark_frame_arena());
+
+	Dictionary report;
+	report["benchmark"] = "core";
+	report["results"] = results;
+	REQUIRE_MESSAGE(TestUtils::write_benchmark_report("core", report), "Couldn't write the benchmark results file.");
+}
+
+} // namespace TestCoreBenchmark
@@ -174,4 +174,179 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+static void static_nested_subtask(void *p_arg) {
+	counter[(uintptr_t)p_arg].increment();
+}
+
+static void static_nested_task(void *p_arg) {
+	// Posted from a pool thread, so these go through the thread's local queue and may be stolen.
+	const uint32_t first = (uintptr_t)p_arg;
+	LocalVector<WorkerThreadPool::TaskID> subtasks;
+	for (uint32_t i = 0; i < 16; i++) {
+		subtasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_nested_subtask, (void *)(uintptr_t)(first + i), true));
+	}
+	for (WorkerThreadPool::TaskID subtask : subtasks) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(subtask);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Run tasks posted from pool threads") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 4.0f));
+
+		counter.clear();
+		counter.resize(count * 16);
+
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		for (int i = 0; i < count; i++) {
+			tasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_nested_task, (void *)(uintptr_t)(i * 16), true));
+		}
+		for (WorkerThreadPool::TaskID task : tasks) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+		}
+
+		bool all_run_once = true;
+		for (int i = 0; i < count * 16; i++) {
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+static SafeFlag gate;
+static SafeNumeric<int> sequence;
+static int order[8];
+
+static void static_gated_task(void *p_arg) {
+	while (!gate.is_set()) {
+		OS::get_singleton()->delay_usec(1);
+	}
+	order[(uintptr_t)p_arg] = sequence.increment();
+}
+
+static void static_ordered_task(void *p_arg) {
+	order[(uintptr_t)p_arg] = sequence.increment();
+}
+
+static void static_ordered_group_task(void *p_arg, uint32_t p_index) {
+	counter[p_index].increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Fan-out and fan-in with task dependencies") {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	for (int iterations = 0; iterations < 50; iterations++) {
+		gate.clear();
+		sequence.set(0);
+		memset(order, 0, sizeof(order));
+
+		// 0 -> {1, 2, 3} -> 4
+		WorkerThreadPool::TaskID root = pool->add_native_task(static_gated_task, (void *)0, true);
+		WorkerThreadPool::TaskID fan_out[3];
+		for (int i = 0; i < 3; i++) {
+			fan_out[i] = pool->add_native_task_with_dependencies(static_ordered_task, (void *)(uintptr_t)(i + 1), Span<WorkerThreadPool::TaskID>(&root, 1), i % 2);
+		}
+		WorkerThreadPool::TaskID fan_in = pool->add_native_task_with_dependencies(static_ordered_task, (void *)4, fan_out, true);
+
+		CHECK_FALSE(pool->is_task_completed(fan_in));
+		gate.set();
+		CHECK(pool->wait_for_task_completion(fan_in) == OK);
+
+		CHECK(order[0] == 1);
+		bool fan_out_ran_between = true;
+		for (int i = 1; i <= 3; i++) {
+			fan_out_ran_between &= order[i] > 1 && order[i] < 5;
+		}
+		CHECK(fan_out_ran_between);
+		CHECK(order[4] == 5);
+
+		for (int i = 0; i < 3; i++) {
+			pool->wait_for_task_completion(fan_out[i]);
+		}
+		pool->wait_for_task_completion(root);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Group task dependencies") {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	const int count = 64;
+
+	gate.clear();
+	sequence.set(0);
+	counter.clear();
+	counter.resize(count);
+
+	WorkerThreadPool::TaskID first = pool->add_native_task(static_gated_task, (void *)0, true);
+	WorkerThreadPool::GroupID group = pool->add_native_group_task_with_dependencies(static_ordered_group_task, nullptr, count, Span<WorkerThreadPool::TaskID>(&first, 1), -1, true);
+	WorkerThreadPool::TaskID last = pool->add_native_task_with_dependencies(static_ordered_task, (void *)1, Span<WorkerThreadPool::GroupID>(&group, 1), true);
+
+	OS::get_singleton()->delay_usec(1000);
+	CHECK(pool->get_group_processed_element_count(group) == 0);
+	gate.set();
+
+	pool->wait_for_task_completion(last);
+	CHECK(pool->is_group_task_completed(group));
+	pool->wait_for_group_task_completion(group);
+	pool->wait_for_task_completion(first);
+
+	bool all_run_once = true;
+	for (int i = 0; i < count; i++) {
+		all_run_once &= counter[i].get() == 1;
+	}
+	CHECK(all_run_once);
+	CHECK(order[1] == 2);
+}
+
+TEST_CASE("[WorkerThreadPool] Cancelling a task cancels its dependents") {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	gate.clear();
+	sequence.set(0);
+	memset(order, 0, sizeof(order));
+	counter.clear();
+	counter.resize(4);
+
+	WorkerThreadPool::TaskID first = pool->add_native_task(static_gated_task, (void *)0, true);
+	WorkerThreadPool::TaskID second = pool->add_native_task_with_dependencies(static_ordered_task, (void *)1, Span<WorkerThreadPool::TaskID>(&first, 1), true);
+	WorkerThreadPool::TaskID third = pool->add_native_task_with_dependencies(static_ordered_task, (void *)2, Span<WorkerThreadPool::TaskID>(&second, 1), true);
+	WorkerThreadPool::GroupID group = pool->add_native_group_task_with_dependencies(static_ordered_group_task, nullptr, 4, Span<WorkerThreadPool::TaskID>(&second, 1), -1, true);
+
+	CHECK(pool->cancel_task(second) == OK);
+	CHECK(pool->is_task_cancelled(second));
+	CHECK_FALSE(pool->is_task_cancelled(third)); // Only known once the cancelled task is done.
+	gate.set();
+
+	CHECK(pool->wait_for_task_completion(third) == OK);
+	CHECK(pool->is_task_cancelled(third));
+	pool->wait_for_group_task_completion(group);
+	CHECK(pool->wait_for_task_completion(second) == OK);
+	CHECK(pool->wait_for_task_completion(first) == OK);
+
+	CHECK(order[0] == 1);
+	CHECK(order[1] == 0);
+	CHECK(order[2] == 0);
+	CHECK(counter[0].get() == 0);
+
+	// Depending on a cancelled task that already finished, but wasn't awaited yet, cancels right away.
+	gate.clear();
+	WorkerThreadPool::TaskID blocker = pool->add_native_task(static_gated_task, (void *)5, true);
+	WorkerThreadPool::TaskID cancelled = pool->add_native_task_with_dependencies(static_ordered_task, (void *)6, Span<WorkerThreadPool::TaskID>(&blocker, 1), true);
+	CHECK(pool->cancel_task(cancelled) == OK);
+	gate.set();
+	while (!pool->is_task_completed(cancelled)) {
+		OS::get_singleton()->delay_usec(1);
+	}
+	WorkerThreadPool::TaskID late = pool->add_native_task_with_dependencies(static_ordered_task, (void *)7, Span<WorkerThreadPool::TaskID>(&cancelled, 1), true);
+	CHECK(pool->is_task_cancelled(late));
+	CHECK(pool->is_task_completed(late));
+
+	pool->wait_for_task_completion(late);
+	pool->wait_for_task_completion(cancelled);
+	pool->wait_for_task_completion(blocker);
+	CHECK(order[6] == 0);
+	CHECK(order[7] == 0);
+	ERR_PRINT_OFF;
+	CHECK(pool->cancel_task(blocker) == ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON;
+}
+
 } // namespace TestWorkerThreadPool
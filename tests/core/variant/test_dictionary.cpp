@@ -33,7 +33,9 @@
 TEST_FORCE_LINK(test_dictionary)
 
 #include "core/object/ref_counted.h"
+#include "core/os/os.h"
 #include "core/variant/typed_dictionary.h"
+#include "tests/test_utils.h"
 
 namespace TestDictionary {
 
@@ -601,6 +603,53 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] References to values stay valid when growing") {
+	Dictionary d;
+	Variant &a = d["a"];
+	a = 1;
+	d["b"] = 2;
+	Variant *b = d.getptr("b");
+	for (int i = 0; i < 16; i++) {
+		d[i] = i;
+	}
+
+	CHECK(&a == d.getptr("a"));
+	CHECK(b == d.getptr("b"));
+	CHECK_EQ(a, Variant(1));
+	CHECK_EQ(*b, Variant(2));
+
+	a = 3;
+	CHECK_EQ(d["a"], Variant(3));
+}
+
+TEST_CASE("[Dictionary] Order is kept when growing past the small map") {
+	Dictionary d;
+	d["b"] = 1;
+	d["a"] = 2;
+	d[StringName("c")] = 3;
+	d.erase("a");
+	d["d"] = 4;
+	d["a"] = 5;
+
+	Dictionary small_copy = d.duplicate();
+	CHECK_EQ(small_copy.keys(), Array({ "b", "c", "d", "a" }));
+	CHECK(small_copy.has("c"));
+
+	d["e"] = 6;
+	d["f"] = 7;
+	CHECK_EQ(d.keys(), Array({ "b", "c", "d", "a", "e", "f" }));
+	CHECK_EQ(d.values(), Array({ 1, 3, 4, 5, 6, 7 }));
+	CHECK_EQ(int(d[StringName("a")]), 5);
+
+	// The copy made before growing is not affected.
+	CHECK_EQ(small_copy.size(), 4);
+	CHECK_FALSE(small_copy.has("e"));
+
+	Dictionary shared = d;
+	shared["g"] = 8;
+	CHECK(d.has("g"));
+}
+
 TEST_CASE("[Dictionary] sort()") {
 	Dictionary d;
 	d[3] = 3;
@@ -750,4 +799,62 @@ TEST_CASE("[Dictionary] RefCounted value init") {
 	CHECK_EQ(tdict[5.0], Variant(b));
 }
 
+// Skipped by default; run it with:
+//   godot --test --no-skip --test-case="*[Benchmark]*" [--benchmark-dictionary-file <path>]
+// Up to four entries are kept in the small map, larger dictionaries use the hash table.
+TEST_CASE("[Dictionary][Benchmark] Small dictionary CPU time" * doctest::skip()) {
+	constexpr uint32_t DICTIONARIES = 100000;
+	constexpr uint32_t LOOKUPS = 1000000;
+
+	Array results;
+	for (int size : { 2, 4, 8, 32 }) {
+		Vector<String> keys;
+		for (int i = 0; i < size; i++) {
+			keys.push_back(vformat("key_%d", i));
+		}
+
+		uint64_t total_size = 0;
+		uint64_t from = OS::get_singleton()->get_ticks_usec();
+		for (uint32_t i = 0; i < DICTIONARIES; i++) {
+			Dictionary dictionary;
+			for (const String &key : keys) {
+				dictionary[key] = i;
+			}
+			total_size += dictionary.duplicate().size();
+		}
+		const uint64_t build_usec = OS::get_singleton()->get_ticks_usec() - from;
+		CHECK(total_size == uint64_t(DICTIONARIES) * size);
+
+		Dictionary dictionary;
+		for (const String &key : keys) {
+			dictionary[key] = 1;
+		}
+		// Half of the lookups miss, as `has()` checks on options often do.
+		const String missing = "missing";
+		const Dictionary &const_dictionary = dictionary;
+		int64_t found = 0;
+		from = OS::get_singleton()->get_ticks_usec();
+		for (uint32_t i = 0; i < LOOKUPS; i++) {
+			if (i & 1) {
+				found += const_dictionary.has(missing);
+			} else {
+				found += int64_t(const_dictionary[keys[i % size]]);
+			}
+		}
+		const uint64_t lookup_usec = OS::get_singleton()->get_ticks_usec() - from;
+		CHECK(found == LOOKUPS / 2);
+
+		Dictionary result;
+		result["size"] = size;
+		result["build_and_duplicate_msec"] = double(build_usec) / 1000.0;
+		result["lookup_ns"] = double(lookup_usec) * 1000.0 / LOOKUPS;
+		results.push_back(result);
+	}
+
+	Dictionary report;
+	report["benchmark"] = "dictionary";
+	report["results"] = results;
+	REQUIRE_MESSAGE(TestUtils::write_benchmark_report("dictionary", report), "Couldn't write the benchmark results file.");
+}
+
 } // namespace TestDictionary
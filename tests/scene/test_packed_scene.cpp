@@ -282,4 +282,65 @@ TEST_CASE("[PackedScene] Recreate State") {
 	memdelete(scene);
 }
 
+TEST_CASE("[PackedScene] Threaded Instantiation") {
+	// Sub-scene: Item with one owned child.
+	Node *item = memnew(Node);
+	item->set_name("Item");
+	Node *item_child = memnew(Node);
+	item_child->set_name("Child");
+	item->add_child(item_child);
+	item_child->set_owner(item);
+
+	Ref<PackedScene> item_scene;
+	item_scene.instantiate();
+	CHECK(item_scene->pack(item) == OK);
+	memdelete(item);
+
+	// Level: a root with many instances of the sub-scene, and one plain node.
+	const int item_count = 32;
+	Ref<PackedScene> level_scene;
+	level_scene.instantiate();
+	Ref<SceneState> state = level_scene->get_state();
+	const int node_type = state->add_name("Node");
+	state->add_node(-1, -1, node_type, state->add_name("Level"), -1, -1, Node::UNIQUE_SCENE_ID_UNASSIGNED);
+	const int item_scene_value = state->add_value(item_scene);
+	for (int i = 0; i < item_count; i++) {
+		state->add_node(0, 0, SceneState::TYPE_INSTANTIATED, state->add_name(vformat("Item%d", i)), item_scene_value, -1, Node::UNIQUE_SCENE_ID_UNASSIGNED);
+	}
+	state->add_node(0, 0, node_type, state->add_name("Plain"), -1, -1, Node::UNIQUE_SCENE_ID_UNASSIGNED);
+
+	const int64_t request = level_scene->instantiate_threaded_request();
+	CHECK(request >= 0);
+
+	Array progress;
+	PackedScene::InstantiationStatus status = level_scene->instantiate_threaded_get_status(request, progress);
+	CHECK((status == PackedScene::INSTANTIATION_STATUS_IN_PROGRESS || status == PackedScene::INSTANTIATION_STATUS_DONE));
+	CHECK(progress.size() == 1);
+
+	Node *instance = level_scene->instantiate_threaded_get(request);
+	REQUIRE(instance != nullptr);
+	CHECK(level_scene->instantiate_threaded_get_status(request) == PackedScene::INSTANTIATION_STATUS_INVALID);
+
+	// Same result as a regular instantiation.
+	Node *reference = level_scene->instantiate();
+	REQUIRE(reference != nullptr);
+	CHECK(instance->get_name() == reference->get_name());
+	REQUIRE(instance->get_child_count() == reference->get_child_count());
+	CHECK(instance->get_child_count() == item_count + 1);
+	for (int i = 0; i < instance->get_child_count(); i++) {
+		Node *child = instance->get_child(i);
+		CHECK(child->get_name() == reference->get_child(i)->get_name());
+		CHECK(child->get_owner() == instance);
+		CHECK(child->get_child_count() == reference->get_child(i)->get_child_count());
+		if (i < item_count) {
+			REQUIRE(child->get_child_count() == 1);
+			CHECK(child->get_child(0)->get_name() == "Child");
+			CHECK(child->get_child(0)->get_owner() == child);
+		}
+	}
+
+	memdelete(reference);
+	memdelete(instance);
+}
+
 } // namespace TestPackedScene
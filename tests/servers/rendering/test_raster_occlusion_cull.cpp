@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*  test_raster_occlusion_cull.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_raster_occlusion_cull)
+
+#include "servers/rendering/raster_occlusion_cull.h"
+
+namespace TestRasterOcclusionCull {
+
+bool is_occluded(RendererSceneOcclusionCull::HZBuffer *p_buffer, const AABB &p_aabb, const Transform3D &p_cam_transform, const Projection &p_cam_projection) {
+	const real_t bounds[6] = {
+		p_aabb.position.x, p_aabb.position.y, p_aabb.position.z,
+		p_aabb.position.x + p_aabb.size.x, p_aabb.position.y + p_aabb.size.y, p_aabb.position.z + p_aabb.size.z
+	};
+	uint64_t timeout = 0;
+	return p_buffer->is_occluded(bounds, p_cam_transform.origin, p_cam_transform.affine_inverse(), p_cam_projection, p_cam_projection.get_z_near(), p_cam_projection.is_orthogonal(), timeout);
+}
+
+TEST_CASE("[RasterOcclusionCull] Rasterized occluders hide what is behind them") {
+	RasterOcclusionCull occlusion_cull;
+
+	// A 4x4 wall facing the camera, 5 units in front of it.
+	const PackedVector3Array vertices = { Vector3(-2, -2, 0), Vector3(2, -2, 0), Vector3(2, 2, 0), Vector3(-2, 2, 0) };
+	const PackedInt32Array indices = { 0, 1, 2, 0, 2, 3 };
+
+	RID occluder = occlusion_cull.occluder_allocate();
+	occlusion_cull.occluder_initialize(occluder);
+	occlusion_cull.occluder_set_mesh(occluder, vertices, indices);
+
+	RID scenario = RID::from_uint64(1);
+	RID instance = RID::from_uint64(2);
+	RID buffer = RID::from_uint64(3);
+	occlusion_cull.add_scenario(scenario);
+	occlusion_cull.scenario_set_instance(scenario, instance, occluder, Transform3D(Basis(), Vector3(0, 0, -5)), true);
+
+	occlusion_cull.add_buffer(buffer);
+	occlusion_cull.buffer_set_scenario(buffer, scenario);
+	occlusion_cull.buffer_set_size(buffer, Size2i(64, 64));
+
+	const Transform3D cam_transform;
+
+	SUBCASE("Perspective") {
+		Projection projection;
+		projection.set_perspective(60.0, 1.0, 0.1, 100.0);
+		occlusion_cull.buffer_update(buffer, cam_transform, projection, false);
+
+		RendererSceneOcclusionCull::HZBuffer *hz_buffer = occlusion_cull.buffer_get_ptr(buffer);
+		REQUIRE(hz_buffer != nullptr);
+
+		CHECK_MESSAGE(is_occluded(hz_buffer, AABB(Vector3(-0.5, -0.5, -10.5), Vector3(1, 1, 1)), cam_transform, projection),
+				"A box right behind the wall should be occluded.");
+		CHECK_FALSE_MESSAGE(is_occluded(hz_buffer, AABB(Vector3(-0.5, -0.5, -3.5), Vector3(1, 1, 1)), cam_transform, projection),
+				"A box in front of the wall should be visible.");
+		CHECK_FALSE_MESSAGE(is_occluded(hz_buffer, AABB(Vector3(5, -0.5, -10.5), Vector3(1, 1, 1)), cam_transform, projection),
+				"A box beside the wall should be visible.");
+	}
+
+	SUBCASE("Orthogonal") {
+		Projection projection;
+		projection.set_orthogonal(8.0, 1.0, 0.1, 100.0, false);
+		occlusion_cull.buffer_update(buffer, cam_transform, projection, true);
+
+		RendererSceneOcclusionCull::HZBuffer *hz_buffer = occlusion_cull.buffer_get_ptr(buffer);
+		REQUIRE(hz_buffer != nullptr);
+
+		CHECK(is_occluded(hz_buffer, AABB(Vector3(-0.5, -0.5, -10.5), Vector3(1, 1, 1)), cam_transform, projection));
+		CHECK_FALSE(is_occluded(hz_buffer, AABB(Vector3(3, -0.5, -10.5), Vector3(1, 1, 1)), cam_transform, projection));
+	}
+
+	SUBCASE("Disabled occluders") {
+		occlusion_cull.scenario_set_instance(scenario, instance, occluder, Transform3D(Basis(), Vector3(0, 0, -5)), false);
+
+		Projection projection;
+		projection.set_perspective(60.0, 1.0, 0.1, 100.0);
+		occlusion_cull.buffer_update(buffer, cam_transform, projection, false);
+
+		CHECK_FALSE(is_occluded(occlusion_cull.buffer_get_ptr(buffer), AABB(Vector3(-0.5, -0.5, -10.5), Vector3(1, 1, 1)), cam_transform, projection));
+	}
+
+	occlusion_cull.remove_buffer(buffer);
+	occlusion_cull.scenario_remove_instance(scenario, instance);
+	occlusion_cull.remove_scenario(scenario);
+	occlusion_cull.free_occluder(occluder);
+}
+
+} // namespace TestRasterOcclusionCull
@@ -0,0 +1,315 @@
+/**************************************************************************/
+/*  test_renderer_canvas_cull.cpp                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_renderer_canvas_cull)
+
+#include "core/object/callable_mp.h"
+#include "servers/rendering/dummy/rasterizer_canvas_dummy.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+class TestRendererCanvasCullInternalsAccessor {
+public:
+	static uint32_t &thread_cull_threshold() {
+		return RSG::canvas->thread_cull_threshold;
+	}
+};
+
+namespace TestRendererCanvasCull {
+
+constexpr Size2 VIEWPORT_SIZE = Size2(640, 480);
+
+// Records the items handed to the renderer, in draw order.
+class CanvasRenderRecorder : public RasterizerCanvasDummy {
+public:
+	LocalVector<RID> items;
+
+	void canvas_render_items(RID p_to_render_target, Item *p_item_list, const Color &p_modulate, Light *p_light_list, Light *p_directional_list, const Transform2D &p_canvas_transform, RSE::CanvasItemTextureFilter p_default_filter, RSE::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, bool &r_sdf_used, RenderingServerTypes::RenderInfo *r_render_info = nullptr) override {
+		items.clear();
+		for (Item *item = p_item_list; item; item = item->next) {
+			items.push_back(static_cast<RendererCanvasCull::Item *>(item)->self);
+			// Cleared by every renderer once the group is drawn.
+			item->canvas_group_owner = nullptr;
+		}
+		r_sdf_used = false;
+	}
+};
+
+// Replaces the canvas renderer with a recorder while in scope.
+class ScopedCanvasRenderRecorder {
+	RendererCanvasRender *previous = nullptr;
+
+public:
+	CanvasRenderRecorder *recorder = nullptr;
+
+	ScopedCanvasRenderRecorder() {
+		previous = RSG::canvas_render;
+		// The renderer is a singleton, so the current one is hidden while the recorder exists.
+		RendererCanvasRender::singleton = nullptr;
+		recorder = memnew(CanvasRenderRecorder);
+		RSG::canvas_render = recorder;
+	}
+
+	~ScopedCanvasRenderRecorder() {
+		memdelete(recorder);
+		RendererCanvasRender::singleton = previous;
+		RSG::canvas_render = previous;
+	}
+};
+
+// A canvas whose items are labeled, so the draw order of two trees built the same way can be compared.
+struct CanvasTree {
+	RID canvas;
+	LocalVector<RID> rids;
+	HashMap<RID, int> labels;
+
+	RID add_item(RID p_parent, const Point2 &p_position) {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		RID item = rs->canvas_item_create();
+		rs->canvas_item_set_parent(item, p_parent);
+		rs->canvas_item_set_transform(item, Transform2D(0.0, p_position));
+		rs->canvas_item_add_rect(item, Rect2(0, 0, 64, 64), Color(1, 1, 1));
+		labels[item] = rids.size();
+		rids.push_back(item);
+		return item;
+	}
+
+	RID add_item(const Point2 &p_position) {
+		return add_item(canvas, p_position);
+	}
+
+	PackedInt32Array render(CanvasRenderRecorder *p_recorder) {
+		RSG::canvas->update();
+		RendererCanvasCull::Canvas *canvas_ptr = RSG::canvas->canvas_owner.get_or_null(canvas);
+		RSG::canvas->render_canvas(RID(), canvas_ptr, Transform2D(), nullptr, nullptr, Rect2(Point2(), VIEWPORT_SIZE), RSE::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RSE::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED, false, false, 0xFFFFFFFF);
+
+		PackedInt32Array order;
+		for (const RID &item : p_recorder->items) {
+			order.push_back(labels[item]);
+		}
+		return order;
+	}
+
+	CanvasTree() {
+		canvas = RenderingServer::get_singleton()->canvas_create();
+	}
+
+	~CanvasTree() {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		// Free children before their parents.
+		for (int i = int(rids.size()) - 1; i >= 0; i--) {
+			rs->free_rid(rids[i]);
+		}
+		rs->free_rid(canvas);
+	}
+};
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Spatial index keeps the draw order of children") {
+	ScopedCanvasRenderRecorder scoped_recorder;
+	CanvasRenderRecorder *recorder = scoped_recorder.recorder;
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	// Two identical trees, only one of them indexed. The children overlap and all share the same
+	// draw index, so only their position in the parent decides which one is drawn on top.
+	CanvasTree indexed;
+	CanvasTree unindexed;
+	RID indexed_parent = indexed.add_item(Point2());
+	RID unindexed_parent = unindexed.add_item(Point2());
+	rs->canvas_item_set_use_spatial_index(indexed_parent, true);
+
+	LocalVector<RID> indexed_children;
+	LocalVector<RID> unindexed_children;
+	for (int i = 0; i < 200; i++) {
+		const Point2 position = Point2((i % 20) * 48, (i / 20) * 48);
+		indexed_children.push_back(indexed.add_item(indexed_parent, position));
+		unindexed_children.push_back(unindexed.add_item(unindexed_parent, position));
+	}
+
+	const PackedInt32Array initial_order = indexed.render(recorder);
+	CHECK_MESSAGE(initial_order.size() > 1, "Some children should be visible.");
+	CHECK_MESSAGE(initial_order.size() < indexed.rids.size(), "Some children should be culled.");
+	CHECK(initial_order == unindexed.render(recorder));
+
+	SUBCASE("Dirty children") {
+		for (uint32_t i = 0; i < indexed_children.size(); i += 3) {
+			const Transform2D xform = Transform2D(0.0, Point2((i % 20) * 48 + 24, (i / 20) * 48 + 8));
+			rs->canvas_item_set_transform(indexed_children[i], xform);
+			rs->canvas_item_set_transform(unindexed_children[i], xform);
+		}
+		CHECK(indexed.render(recorder) == unindexed.render(recorder));
+
+		// Off screen and back again, so they leave and rejoin the culled set.
+		for (uint32_t i = 0; i < indexed_children.size(); i += 5) {
+			rs->canvas_item_set_transform(indexed_children[i], Transform2D(0.0, Point2(-1000, -1000)));
+			rs->canvas_item_set_transform(unindexed_children[i], Transform2D(0.0, Point2(-1000, -1000)));
+		}
+		CHECK(indexed.render(recorder) == unindexed.render(recorder));
+
+		for (uint32_t i = 0; i < indexed_children.size(); i += 5) {
+			rs->canvas_item_set_transform(indexed_children[i], Transform2D(0.0, Point2(100, 100)));
+			rs->canvas_item_set_transform(unindexed_children[i], Transform2D(0.0, Point2(100, 100)));
+		}
+		CHECK(indexed.render(recorder) == unindexed.render(recorder));
+	}
+
+	SUBCASE("Moved children") {
+		for (uint32_t i = 0; i < indexed_children.size(); i++) {
+			const int index = (i % 7 == 0) ? 1 : ((i % 11 == 0) ? -1 : 0);
+			rs->canvas_item_set_draw_index(indexed_children[i], index);
+			rs->canvas_item_set_draw_index(unindexed_children[i], index);
+		}
+		const PackedInt32Array order = indexed.render(recorder);
+		CHECK(order != initial_order);
+		CHECK(order == unindexed.render(recorder));
+
+		// Reparenting moves a child to the end of its parent.
+		rs->canvas_item_set_parent(indexed_children[0], indexed.canvas);
+		rs->canvas_item_set_parent(indexed_children[0], indexed_parent);
+		rs->canvas_item_set_parent(unindexed_children[0], unindexed.canvas);
+		rs->canvas_item_set_parent(unindexed_children[0], unindexed_parent);
+		CHECK(indexed.render(recorder) == unindexed.render(recorder));
+	}
+}
+
+LocalVector<int> entered_notifiers;
+
+void notifier_entered(int p_label) {
+	entered_notifiers.push_back(p_label);
+}
+
+void add_notifier(CanvasTree &r_tree, RID p_item) {
+	const Callable enter_callable = callable_mp_static(&notifier_entered).bind(r_tree.labels[p_item]);
+	RenderingServer::get_singleton()->canvas_item_set_visibility_notifier(p_item, true, Rect2(0, 0, 64, 64), enter_callable, Callable());
+}
+
+constexpr int THREADED_CULL_ITEMS = 1200;
+constexpr uint32_t THREADED_CULL_THRESHOLD = 64;
+
+// Builds the same tree twice, culls it on a single thread and then split across threads,
+// and checks that the renderer gets the same items in the same order both times.
+template <typename F>
+void check_threaded_cull_order(CanvasRenderRecorder *p_recorder, F p_build) {
+	uint32_t &threshold = TestRendererCanvasCullInternalsAccessor::thread_cull_threshold();
+	const uint32_t previous_threshold = threshold;
+	const uint32_t thresholds[2] = { UINT32_MAX, THREADED_CULL_THRESHOLD };
+
+	PackedInt32Array orders[2];
+	PackedInt32Array notifiers[2];
+	for (int i = 0; i < 2; i++) {
+		threshold = thresholds[i];
+		entered_notifiers.clear();
+
+		CanvasTree tree;
+		p_build(tree);
+		orders[i] = tree.render(p_recorder);
+		RSG::canvas->update_visibility_notifiers();
+
+		// Notifiers may be queued in a different order, only which ones entered matters.
+		entered_notifiers.sort();
+		for (int label : entered_notifiers) {
+			notifiers[i].push_back(label);
+		}
+	}
+	threshold = previous_threshold;
+
+	CHECK_MESSAGE(orders[0].size() >= int(THREADED_CULL_THRESHOLD), "Enough items should be visible to cull on threads.");
+	CHECK(orders[1] == orders[0]);
+	CHECK(notifiers[1] == notifiers[0]);
+}
+
+Point2 scattered_position(int p_index) {
+	// Spread over twice the viewport, so about a quarter of the items are visible.
+	return Point2((p_index * 53) % int(VIEWPORT_SIZE.x * 2), (p_index * 37) % int(VIEWPORT_SIZE.y * 2));
+}
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Threaded culling keeps the draw order") {
+	ScopedCanvasRenderRecorder scoped_recorder;
+	CanvasRenderRecorder *recorder = scoped_recorder.recorder;
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	SUBCASE("Plain siblings") {
+		check_threaded_cull_order(recorder, [&](CanvasTree &r_tree) {
+			for (int i = 0; i < THREADED_CULL_ITEMS; i++) {
+				RID item = r_tree.add_item(scattered_position(i));
+				rs->canvas_item_set_z_index(item, i % 3 - 1);
+				if (i % 5 == 0) {
+					// Grandchildren are culled by the worker thread of their parent.
+					RID child = r_tree.add_item(item, Point2(16, 16));
+					rs->canvas_item_set_z_index(child, 1);
+				}
+			}
+		});
+	}
+
+	SUBCASE("Y-sorted siblings") {
+		check_threaded_cull_order(recorder, [&](CanvasTree &r_tree) {
+			RID parent = r_tree.add_item(Point2());
+			rs->canvas_item_set_sort_children_by_y(parent, true);
+			for (int i = 0; i < THREADED_CULL_ITEMS; i++) {
+				// Rows of items share the same Y, so ties are broken by their position in the tree.
+				RID item = r_tree.add_item(parent, Point2((i * 53) % int(VIEWPORT_SIZE.x * 2), (i % 40) * 24));
+				rs->canvas_item_set_z_index(item, i % 3 - 1);
+				if (i % 5 == 0) {
+					r_tree.add_item(item, Point2(8, -8));
+				}
+			}
+		});
+	}
+
+	SUBCASE("Canvas group") {
+		check_threaded_cull_order(recorder, [&](CanvasTree &r_tree) {
+			r_tree.add_item(Point2(100, 100));
+			RID group = r_tree.add_item(Point2());
+			rs->canvas_item_set_canvas_group_mode(group, RSE::CANVAS_GROUP_MODE_TRANSPARENT, 5.0, true);
+			for (int i = 0; i < THREADED_CULL_ITEMS; i++) {
+				r_tree.add_item(group, scattered_position(i));
+			}
+			r_tree.add_item(Point2(200, 200));
+		});
+	}
+
+	SUBCASE("Visibility notifiers") {
+		check_threaded_cull_order(recorder, [&](CanvasTree &r_tree) {
+			RID parent = r_tree.add_item(Point2());
+			for (int i = 0; i < THREADED_CULL_ITEMS; i++) {
+				RID item = r_tree.add_item(parent, scattered_position(i));
+				if (i % 3 == 0) {
+					add_notifier(r_tree, item);
+				}
+			}
+		});
+		CHECK_MESSAGE(!entered_notifiers.is_empty(), "Some notifiers should have entered the screen.");
+	}
+}
+
+} // namespace TestRendererCanvasCull
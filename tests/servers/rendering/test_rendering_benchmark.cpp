@@ -0,0 +1,478 @@
+/**************************************************************************/
+/*  test_rendering_benchmark.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_rendering_benchmark)
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "core/templates/command_queue_mt.h"
+#include "servers/rendering/dummy/storage/light_storage.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/renderer_compositor.h"
+#include "servers/rendering/rendering_method.h"
+#include "servers/rendering/rendering_server.h"
+#include "servers/rendering/rendering_server_globals.h"
+#include "servers/rendering/storage/render_data_extension.h"
+#include "tests/test_utils.h"
+
+namespace TestRenderingBenchmark {
+
+// CPU-side rendering benchmarks, run on the dummy rasterizer so they need no GPU.
+// They are skipped by default; run them with:
+//   godot --test --no-skip --test-case="*[Benchmark]*" [--benchmark-rendering-file <path>]
+// Results are printed as JSON, and also written to <path> if given.
+
+constexpr int BENCHMARK_FRAMES = 20;
+constexpr Size2 BENCHMARK_VIEWPORT_SIZE = Size2(1920, 1080);
+
+class RenderingBenchmark {
+	String name;
+	int frames = 0;
+	uint64_t setup_usec = 0;
+	uint64_t setup_from = 0;
+
+	// HashMap keeps insertion order, so phases are reported in the order they ran.
+	HashMap<String, uint64_t> phase_usec;
+	HashMap<String, uint64_t> timestamp_usec;
+
+	void _collect_timestamps() {
+		uint32_t count = RSG::utilities->get_captured_timestamps_count();
+		for (uint32_t i = 0; i + 1 < count; i++) {
+			uint64_t elapsed = RSG::utilities->get_captured_timestamp_cpu_time(i + 1) - RSG::utilities->get_captured_timestamp_cpu_time(i);
+			timestamp_usec[RSG::utilities->get_captured_timestamp_name(i)] += elapsed;
+		}
+	}
+
+public:
+	void setup_end() {
+		setup_usec = OS::get_singleton()->get_ticks_usec() - setup_from;
+	}
+
+	void begin_frame() {
+		// Timestamps are published when the next frame begins.
+		RSG::rasterizer->begin_frame(1.0 / 60.0);
+		if (frames > 0) {
+			_collect_timestamps();
+		}
+		RSG::utilities->capture_timestamps_begin();
+		frames++;
+	}
+
+	template <typename F>
+	void measure(const String &p_phase, F p_function) {
+		uint64_t from = OS::get_singleton()->get_ticks_usec();
+		p_function();
+		phase_usec[p_phase] += OS::get_singleton()->get_ticks_usec() - from;
+	}
+
+	Dictionary finish() {
+		RSG::rasterizer->begin_frame(1.0 / 60.0);
+		_collect_timestamps();
+
+		Dictionary phases;
+		for (const KeyValue<String, uint64_t> &E : phase_usec) {
+			phases[E.key] = double(E.value) / frames / 1000.0;
+		}
+		Dictionary timestamps;
+		for (const KeyValue<String, uint64_t> &E : timestamp_usec) {
+			timestamps[E.key] = double(E.value) / frames / 1000.0;
+		}
+
+		Dictionary result;
+		result["name"] = name;
+		result["frames"] = frames;
+		result["setup_msec"] = double(setup_usec) / 1000.0;
+		result["phases_msec"] = phases;
+		result["timestamps_msec"] = timestamps;
+		return result;
+	}
+
+	RenderingBenchmark(const String &p_name) :
+			name(p_name) {
+		setup_from = OS::get_singleton()->get_ticks_usec();
+	}
+};
+
+// Stands in for the render thread of a threaded RenderingServerDefault: commands pushed to the
+// queue run on a pump task, exactly like the server's own command queue and _thread_loop().
+// The harness server is single-threaded and can't be swapped mid-test, since the SceneTree
+// holds RIDs from it, so the queue is driven directly on top of the same rendering method.
+class ServerThread {
+	bool exit = false;
+	WorkerThreadPool::TaskID pump_task_id = WorkerThreadPool::INVALID_TASK_ID;
+
+	static void _thread_loop(void *p_userdata) {
+		ServerThread *server_thread = static_cast<ServerThread *>(p_userdata);
+		while (!server_thread->exit) {
+			WorkerThreadPool::get_singleton()->yield();
+			server_thread->command_queue.flush_all();
+		}
+	}
+
+	void _thread_exit() {
+		exit = true;
+	}
+
+public:
+	CommandQueueMT command_queue;
+
+	ServerThread() {
+		pump_task_id = WorkerThreadPool::get_singleton()->add_native_task(&ServerThread::_thread_loop, this, true, "Rendering benchmark pump task");
+		command_queue.set_pump_task_id(pump_task_id);
+	}
+
+	~ServerThread() {
+		command_queue.push(this, &ServerThread::_thread_exit);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(pump_task_id);
+	}
+};
+
+// A scenario with a camera and a viewport to cull for.
+struct Scene3D {
+	RID scenario;
+	RID camera;
+	RID viewport;
+	Ref<RenderSceneBuffers> render_buffers;
+	LocalVector<RID> rids;
+
+	void render(RenderingBenchmark &r_benchmark) {
+		r_benchmark.measure("scene_update", [&]() {
+			RSG::scene->update();
+		});
+		r_benchmark.measure("scene_cull", [&]() {
+			Ref<XRInterface> xr_interface;
+			RSG::scene->render_camera(render_buffers, camera, scenario, viewport, BENCHMARK_VIEWPORT_SIZE, 0, 1.0, RID(), xr_interface, 1.0);
+		});
+		r_benchmark.measure("visibility_notifiers", [&]() {
+			RSG::scene->update_visibility_notifiers();
+		});
+	}
+
+	Scene3D() {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		scenario = rs->scenario_create();
+		viewport = rs->viewport_create();
+		camera = rs->camera_create();
+		rs->camera_set_perspective(camera, 75.0, 0.05, 500.0);
+		render_buffers = Ref<RenderSceneBuffers>(memnew(RenderSceneBuffersExtension));
+	}
+
+	~Scene3D() {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		for (const RID &rid : rids) {
+			rs->free_rid(rid);
+		}
+		rs->free_rid(camera);
+		rs->free_rid(viewport);
+		rs->free_rid(scenario);
+	}
+};
+
+struct Scene2D {
+	RID canvas;
+	LocalVector<RID> rids;
+
+	void render(RenderingBenchmark &r_benchmark) {
+		r_benchmark.measure("canvas_update", [&]() {
+			RSG::canvas->update();
+		});
+		r_benchmark.measure("canvas_cull", [&]() {
+			RendererCanvasCull::Canvas *canvas_ptr = RSG::canvas->canvas_owner.get_or_null(canvas);
+			RSG::canvas->render_canvas(RID(), canvas_ptr, Transform2D(), nullptr, nullptr, Rect2(Point2(), BENCHMARK_VIEWPORT_SIZE), RSE::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RSE::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED, false, false, 0xFFFFFFFF);
+		});
+		r_benchmark.measure("visibility_notifiers", [&]() {
+			RSG::canvas->update_visibility_notifiers();
+		});
+	}
+
+	Scene2D() {
+		canvas = RenderingServer::get_singleton()->canvas_create();
+	}
+
+	~Scene2D() {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		// Free children before their parents.
+		for (int i = int(rids.size()) - 1; i >= 0; i--) {
+			rs->free_rid(rids[i]);
+		}
+		rs->free_rid(canvas);
+	}
+};
+
+Transform3D grid_transform(uint32_t p_index, uint32_t p_width, uint32_t p_height, real_t p_spacing) {
+	uint32_t x = p_index % p_width;
+	uint32_t y = (p_index / p_width) % p_height;
+	uint32_t z = p_index / (p_width * p_height);
+	Vector3 origin = Vector3(real_t(x) - p_width * 0.5, real_t(y) - p_height * 0.5, -real_t(z)) * p_spacing;
+	return Transform3D(Basis(), origin);
+}
+
+// With a server thread, transform updates go through its command queue and the frame waits for
+// them to be flushed, like RenderingServerDefault::sync() does before drawing.
+Dictionary benchmark_instances(uint32_t p_count, ServerThread *p_server_thread = nullptr) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RenderingBenchmark benchmark(String(p_server_thread ? "instances_threaded_" : "instances_") + itos(p_count));
+	Scene3D scene;
+
+	RID mesh = rs->mesh_create();
+	const AABB aabb = AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1));
+	for (uint32_t i = 0; i < p_count; i++) {
+		RID instance = rs->instance_create2(mesh, scene.scenario);
+		rs->instance_set_custom_aabb(instance, aabb);
+		rs->instance_set_transform(instance, grid_transform(i, 100, 100, 2.0));
+		scene.rids.push_back(instance);
+	}
+	scene.rids.push_back(mesh);
+	benchmark.setup_end();
+
+	for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+		benchmark.begin_frame();
+		// Move one percent of the instances every frame.
+		benchmark.measure("commands", [&]() {
+			for (uint32_t i = frame; i < p_count; i += 100) {
+				Transform3D xform = grid_transform(i, 100, 100, 2.0);
+				xform.origin.y += Math::sin(real_t(frame));
+				if (p_server_thread) {
+					p_server_thread->command_queue.push(RSG::scene, &RenderingMethod::instance_set_transform, scene.rids[i], xform);
+				} else {
+					rs->instance_set_transform(scene.rids[i], xform);
+				}
+			}
+		});
+		if (p_server_thread) {
+			benchmark.measure("server_sync", [&]() {
+				p_server_thread->command_queue.sync();
+			});
+		}
+		rs->camera_set_transform(scene.camera, Transform3D(Basis(Vector3(0, 1, 0), frame * 0.05), Vector3(0, 0, 10)));
+		scene.render(benchmark);
+	}
+
+	return benchmark.finish();
+}
+
+Dictionary benchmark_lights(uint32_t p_count) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RenderingBenchmark benchmark("lights_" + itos(p_count));
+	Scene3D scene;
+
+	RID mesh = rs->mesh_create();
+	const AABB aabb = AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1));
+	for (uint32_t i = 0; i < p_count; i++) {
+		RID instance = rs->instance_create2(mesh, scene.scenario);
+		rs->instance_set_custom_aabb(instance, aabb);
+		rs->instance_set_transform(instance, grid_transform(i, 100, 10, 2.0));
+		scene.rids.push_back(instance);
+	}
+
+	uint32_t first_light = scene.rids.size();
+	for (uint32_t i = 0; i < p_count; i++) {
+		RID light = rs->omni_light_create();
+		rs->light_set_param(light, RSE::LIGHT_PARAM_RANGE, 3.0);
+		RID instance = rs->instance_create2(light, scene.scenario);
+		Transform3D xform = grid_transform(i, 100, 10, 2.0);
+		xform.origin += Vector3(1, 1, 1);
+		rs->instance_set_transform(instance, xform);
+		scene.rids.push_back(instance);
+		scene.rids.push_back(light);
+	}
+	scene.rids.push_back(mesh);
+	benchmark.setup_end();
+
+	for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+		benchmark.begin_frame();
+		// Move one percent of the lights every frame, forcing them to be paired again.
+		benchmark.measure("commands", [&]() {
+			for (uint32_t i = frame; i < p_count; i += 100) {
+				Transform3D xform = grid_transform(i, 100, 10, 2.0);
+				xform.origin += Vector3(1, 1 + Math::sin(real_t(frame)), 1);
+				rs->instance_set_transform(scene.rids[first_light + i * 2], xform);
+			}
+		});
+		rs->camera_set_transform(scene.camera, Transform3D(Basis(Vector3(0, 1, 0), frame * 0.05), Vector3(0, 0, 10)));
+		scene.render(benchmark);
+	}
+
+	return benchmark.finish();
+}
+
+Dictionary benchmark_multimesh_upload(uint32_t p_multimesh_count, uint32_t p_instance_count) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RenderingBenchmark benchmark("multimesh_upload_" + itos(p_multimesh_count) + "x" + itos(p_instance_count));
+	Scene3D scene;
+
+	LocalVector<RID> multimeshes;
+	for (uint32_t i = 0; i < p_multimesh_count; i++) {
+		RID multimesh = rs->multimesh_create();
+		rs->multimesh_allocate_data(multimesh, p_instance_count, RSE::MULTIMESH_TRANSFORM_3D);
+		RID instance = rs->instance_create2(multimesh, scene.scenario);
+		rs->instance_set_transform(instance, grid_transform(i, 10, 10, 20.0));
+		scene.rids.push_back(instance);
+		scene.rids.push_back(multimesh);
+		multimeshes.push_back(multimesh);
+	}
+
+	Vector<float> buffer;
+	buffer.resize(p_instance_count * 12);
+	benchmark.setup_end();
+
+	for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+		benchmark.begin_frame();
+		benchmark.measure("commands", [&]() {
+			float *ptr = buffer.ptrw();
+			for (uint32_t i = 0; i < p_instance_count; i++) {
+				float *xform = &ptr[i * 12];
+				xform[0] = 1.0;
+				xform[1] = 0.0;
+				xform[2] = 0.0;
+				xform[3] = float(i % 100);
+				xform[4] = 0.0;
+				xform[5] = 1.0;
+				xform[6] = 0.0;
+				xform[7] = Math::sin(float(frame + i));
+				xform[8] = 0.0;
+				xform[9] = 0.0;
+				xform[10] = 1.0;
+				xform[11] = float(i / 100);
+			}
+			for (const RID &multimesh : multimeshes) {
+				rs->multimesh_set_buffer(multimesh, buffer);
+			}
+		});
+		rs->camera_set_transform(scene.camera, Transform3D(Basis(), Vector3(0, 0, 10)));
+		scene.render(benchmark);
+	}
+
+	return benchmark.finish();
+}
+
+Dictionary benchmark_canvas_items(uint32_t p_count) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RenderingBenchmark benchmark("canvas_items_" + itos(p_count));
+	Scene2D scene;
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		RID item = rs->canvas_item_create();
+		rs->canvas_item_set_parent(item, scene.canvas);
+		rs->canvas_item_set_transform(item, Transform2D(0.0, Point2((i % 400) * 16, (i / 400) * 16)));
+		rs->canvas_item_add_rect(item, Rect2(0, 0, 12, 12), Color(1, 1, 1));
+		scene.rids.push_back(item);
+	}
+	benchmark.setup_end();
+
+	for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+		benchmark.begin_frame();
+		// Move and redraw one percent of the items every frame.
+		benchmark.measure("commands", [&]() {
+			for (uint32_t i = frame; i < p_count; i += 100) {
+				rs->canvas_item_set_transform(scene.rids[i], Transform2D(0.0, Point2((i % 400) * 16 + frame, (i / 400) * 16)));
+				rs->canvas_item_clear(scene.rids[i]);
+				rs->canvas_item_add_rect(scene.rids[i], Rect2(0, 0, 12, 12), Color(1, 1, 1));
+			}
+		});
+		scene.render(benchmark);
+	}
+
+	return benchmark.finish();
+}
+
+Dictionary benchmark_canvas_hierarchy(uint32_t p_chain_count, uint32_t p_depth) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RenderingBenchmark benchmark("canvas_hierarchy_" + itos(p_chain_count) + "x" + itos(p_depth));
+	Scene2D scene;
+
+	LocalVector<RID> roots;
+	for (uint32_t i = 0; i < p_chain_count; i++) {
+		RID parent = scene.canvas;
+		for (uint32_t j = 0; j < p_depth; j++) {
+			RID item = rs->canvas_item_create();
+			rs->canvas_item_set_parent(item, parent);
+			rs->canvas_item_set_transform(item, Transform2D(0.01, Point2(2, 1)));
+			rs->canvas_item_add_rect(item, Rect2(0, 0, 4, 4), Color(1, 1, 1));
+			scene.rids.push_back(item);
+			if (j == 0) {
+				roots.push_back(item);
+			}
+			parent = item;
+		}
+	}
+	benchmark.setup_end();
+
+	for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+		benchmark.begin_frame();
+		// Moving the roots dirties every transform below them.
+		benchmark.measure("commands", [&]() {
+			for (uint32_t i = 0; i < roots.size(); i++) {
+				rs->canvas_item_set_transform(roots[i], Transform2D(frame * 0.01, Point2((i % 40) * 48, (i / 40) * 48)));
+			}
+		});
+		scene.render(benchmark);
+	}
+
+	return benchmark.finish();
+}
+
+TEST_CASE("[SceneTree][Benchmark] Rendering CPU time on the dummy rasterizer" * doctest::skip()) {
+	// The dummy rasterizer only captures timestamps and tracks lights when asked to.
+	RendererDummy::LightStorage *light_storage = RendererDummy::LightStorage::get_singleton();
+	REQUIRE(light_storage);
+	bool was_capturing = RSG::utilities->capturing_timestamps;
+	RSG::utilities->capturing_timestamps = true;
+	light_storage->tracking_lights = true;
+
+	Array results;
+	results.push_back(benchmark_instances(100000));
+	{
+		ServerThread server_thread;
+		results.push_back(benchmark_instances(100000, &server_thread));
+	}
+	results.push_back(benchmark_lights(10000));
+	results.push_back(benchmark_multimesh_upload(100, 1000));
+	results.push_back(benchmark_canvas_items(50000));
+	results.push_back(benchmark_canvas_hierarchy(100, 100));
+
+	RSG::utilities->capturing_timestamps = was_capturing;
+	light_storage->tracking_lights = false;
+
+	Dictionary report;
+	report["benchmark"] = "rendering";
+	report["rendering_method"] = "dummy";
+	report["results"] = results;
+	REQUIRE_MESSAGE(TestUtils::write_benchmark_report("rendering", report), "Couldn't write the benchmark results file.");
+
+	for (const Variant &result : results) {
+		const Dictionary timestamps = Dictionary(result)["timestamps_msec"];
+		CHECK_MESSAGE(!timestamps.is_empty(), "The dummy rasterizer should capture CPU timestamps.");
+	}
+}
+
+} // namespace TestRenderingBenchmark
@@ -814,6 +814,94 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should relink regions when neighboring regions change") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Vector<Vector3> vertices = { Vector3(0.0, 0.0, 0.0), Vector3(1.0, 0.0, 0.0), Vector3(1.0, 0.0, 1.0), Vector3(0.0, 0.0, 1.0) };
+		navigation_mesh->set_vertices(vertices);
+		navigation_mesh->add_polygon(Vector<int>{ 0, 1, 2, 3 });
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->map_set_edge_connection_margin(map, 0.5);
+
+		// Three regions in a row, each sharing an edge with the next.
+		RID regions[3];
+		for (int i = 0; i < 3; i++) {
+			regions[i] = navigation_server->region_create();
+			navigation_server->region_set_use_async_iterations(regions[i], false);
+			navigation_server->region_set_transform(regions[i], Transform3D(Basis(), Vector3(i, 0.0, 0.0)));
+			navigation_server->region_set_navigation_mesh(regions[i], navigation_mesh);
+			navigation_server->region_set_map(regions[i], map);
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const Vector3 start_position = Vector3(0.5, 0.0, 0.5);
+		Vector<Vector3> path = navigation_server->map_get_path(map, start_position, Vector3(2.5, 0.0, 0.5), false);
+		REQUIRE_FALSE(path.is_empty());
+		CHECK(path[path.size() - 1].is_equal_approx(Vector3(2.5, 0.0, 0.5)));
+
+		SUBCASE("Removing and adding back a region should relink its neighbors") {
+			navigation_server->region_set_map(regions[1], RID());
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			path = navigation_server->map_get_path(map, start_position, Vector3(2.5, 0.0, 0.5), false);
+			REQUIRE_FALSE(path.is_empty());
+			CHECK(path[path.size() - 1].x <= 1.0 + CMP_EPSILON);
+
+			navigation_server->region_set_map(regions[1], map);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			path = navigation_server->map_get_path(map, start_position, Vector3(2.5, 0.0, 0.5), false);
+			REQUIRE_FALSE(path.is_empty());
+			CHECK(path[path.size() - 1].is_equal_approx(Vector3(2.5, 0.0, 0.5)));
+		}
+
+		SUBCASE("Moving a region should update edge connection margin connections") {
+			navigation_server->region_set_transform(regions[2], Transform3D(Basis(), Vector3(2.2, 0.0, 0.0)));
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->region_get_connections_count(regions[0]), 0);
+			CHECK_EQ(navigation_server->region_get_connections_count(regions[1]), 1);
+			CHECK_EQ(navigation_server->region_get_connections_count(regions[2]), 1);
+			path = navigation_server->map_get_path(map, start_position, Vector3(2.7, 0.0, 0.5), false);
+			REQUIRE_FALSE(path.is_empty());
+			CHECK(path[path.size() - 1].is_equal_approx(Vector3(2.7, 0.0, 0.5)));
+
+			navigation_server->region_set_transform(regions[2], Transform3D(Basis(), Vector3(5.0, 0.0, 0.0)));
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->region_get_connections_count(regions[1]), 0);
+			CHECK_EQ(navigation_server->region_get_connections_count(regions[2]), 0);
+			path = navigation_server->map_get_path(map, start_position, Vector3(5.5, 0.0, 0.5), false);
+			REQUIRE_FALSE(path.is_empty());
+			CHECK(path[path.size() - 1].x <= 2.0 + CMP_EPSILON);
+		}
+
+		SUBCASE("Regions should be linked again after edge merge errors") {
+			// A region on top of the middle one puts more than 2 edges in the same space.
+			RID overlapping_region = navigation_server->region_create();
+			navigation_server->region_set_use_async_iterations(overlapping_region, false);
+			navigation_server->region_set_transform(overlapping_region, Transform3D(Basis(), Vector3(1.0, 0.0, 0.0)));
+			navigation_server->region_set_navigation_mesh(overlapping_region, navigation_mesh);
+			navigation_server->region_set_map(overlapping_region, map);
+			ERR_PRINT_OFF;
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			ERR_PRINT_ON;
+
+			// The unchanged regions must still be connected once the overlap is gone.
+			navigation_server->free_rid(overlapping_region);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			path = navigation_server->map_get_path(map, start_position, Vector3(2.5, 0.0, 0.5), false);
+			REQUIRE_FALSE(path.is_empty());
+			CHECK(path[path.size() - 1].is_equal_approx(Vector3(2.5, 0.0, 0.5)));
+		}
+
+		for (const RID &region : regions) {
+			navigation_server->free_rid(region);
+		}
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {
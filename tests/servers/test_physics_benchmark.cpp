@@ -0,0 +1,198 @@
+/**************************************************************************/
+/*  test_physics_benchmark.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_physics_benchmark)
+
+#ifndef PHYSICS_3D_DISABLED
+
+#include "core/config/project_settings.h"
+#include "core/os/os.h"
+#include "servers/physics_3d/physics_server_3d.h"
+#include "tests/test_utils.h"
+
+namespace TestPhysicsBenchmark {
+
+// CPU time of physics steps on the default 3D physics server.
+// They are skipped by default; run them with:
+//   godot --test --no-skip --test-case="*[Benchmark]*" [--benchmark-physics-file <path>]
+// Results are printed as JSON, and also written to <path> if given.
+
+constexpr int BENCHMARK_STEPS = 120;
+
+struct BenchmarkScene {
+	RID space;
+	LocalVector<RID> rids; // Freed in reverse order, so joints and bodies go before shapes.
+};
+
+// Spaces read the solver settings when they are created, so they are set before building the scene.
+BenchmarkScene create_scene(bool p_packed_solver_bodies) {
+	ProjectSettings *settings = ProjectSettings::get_singleton();
+	const Variant previous_packed_solver_bodies = settings->get_setting("physics/3d/solver/use_packed_solver_bodies");
+	settings->set_setting("physics/3d/solver/use_packed_solver_bodies", p_packed_solver_bodies);
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	BenchmarkScene scene;
+	scene.space = ps->space_create();
+	ps->space_set_active(scene.space, true);
+	settings->set_setting("physics/3d/solver/use_packed_solver_bodies", previous_packed_solver_bodies);
+
+	RID floor_shape = ps->world_boundary_shape_create();
+	ps->shape_set_data(floor_shape, Plane(Vector3(0, 1, 0), 0));
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, floor_shape);
+	ps->body_set_space(floor, scene.space);
+	scene.rids.push_back(floor_shape);
+	scene.rids.push_back(floor);
+	return scene;
+}
+
+RID create_rigid_body(BenchmarkScene &r_scene, RID p_shape, const Transform3D &p_transform) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID body = ps->body_create();
+	ps->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+	ps->body_add_shape(body, p_shape);
+	ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, p_transform);
+	ps->body_set_space(body, r_scene.space);
+	r_scene.rids.push_back(body);
+	return body;
+}
+
+double step_and_free(BenchmarkScene &r_scene) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	const uint64_t from = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < BENCHMARK_STEPS; i++) {
+		ps->step(1.0 / 60.0);
+	}
+	const double msec = double(OS::get_singleton()->get_ticks_usec() - from) / 1000.0;
+
+	for (int64_t i = int64_t(r_scene.rids.size()) - 1; i >= 0; i--) {
+		ps->free_rid(r_scene.rids[i]);
+	}
+	ps->free_rid(r_scene.space);
+	return msec / BENCHMARK_STEPS;
+}
+
+// Piles of boxes resting on a floor, so each step solves many contacts.
+double benchmark_box_piles(uint32_t p_piles, uint32_t p_height, bool p_packed_solver_bodies) {
+	BenchmarkScene scene = create_scene(p_packed_solver_bodies);
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+	scene.rids.push_back(box_shape);
+	for (uint32_t i = 0; i < p_piles; i++) {
+		for (uint32_t j = 0; j < p_height; j++) {
+			create_rigid_body(scene, box_shape, Transform3D(Basis(), Vector3((i % 16) * 3.0, 0.5 + j * 1.01, (i / 16) * 3.0)));
+		}
+	}
+	return step_and_free(scene);
+}
+
+// Ragdolls of capsules linked by cone twist joints, falling on the floor and onto each other,
+// so each step solves both joints and contacts.
+double benchmark_ragdolls(uint32_t p_ragdolls, bool p_packed_solver_bodies) {
+	struct Part {
+		int parent;
+		Vector3 position; // Center of the part, relative to the pelvis.
+		Vector3 joint; // Where the part hangs from its parent, relative to the pelvis.
+	};
+	const Part parts[] = {
+		{ -1, Vector3(0, 0, 0), Vector3() }, // Pelvis.
+		{ 0, Vector3(0, 0.5, 0), Vector3(0, 0.25, 0) }, // Chest.
+		{ 1, Vector3(0, 1.0, 0), Vector3(0, 0.75, 0) }, // Head.
+		{ 1, Vector3(-0.5, 0.6, 0), Vector3(-0.25, 0.6, 0) }, // Upper arms.
+		{ 1, Vector3(0.5, 0.6, 0), Vector3(0.25, 0.6, 0) },
+		{ 3, Vector3(-1.0, 0.6, 0), Vector3(-0.75, 0.6, 0) }, // Forearms.
+		{ 4, Vector3(1.0, 0.6, 0), Vector3(0.75, 0.6, 0) },
+		{ 0, Vector3(-0.2, -0.5, 0), Vector3(-0.2, -0.25, 0) }, // Thighs.
+		{ 0, Vector3(0.2, -0.5, 0), Vector3(0.2, -0.25, 0) },
+		{ 7, Vector3(-0.2, -1.0, 0), Vector3(-0.2, -0.75, 0) }, // Shins.
+		{ 8, Vector3(0.2, -1.0, 0), Vector3(0.2, -0.75, 0) },
+	};
+
+	BenchmarkScene scene = create_scene(p_packed_solver_bodies);
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID capsule_shape = ps->capsule_shape_create();
+	Dictionary capsule;
+	capsule["radius"] = 0.12;
+	capsule["height"] = 0.45;
+	ps->shape_set_data(capsule_shape, capsule);
+	scene.rids.push_back(capsule_shape);
+
+	for (uint32_t i = 0; i < p_ragdolls; i++) {
+		// Stacked in columns of four, so they land on each other.
+		const Vector3 pelvis = Vector3((i % 64 / 4) * 3.0, 2.0 + (i % 4) * 2.5, (i / 64) * 3.0);
+		RID bodies[std_size(parts)];
+		for (uint32_t j = 0; j < std_size(parts); j++) {
+			const Part &part = parts[j];
+			bodies[j] = create_rigid_body(scene, capsule_shape, Transform3D(Basis(), pelvis + part.position));
+			if (part.parent < 0) {
+				continue;
+			}
+			const Vector3 parent_position = parts[part.parent].position;
+			RID joint = ps->joint_create();
+			ps->joint_make_cone_twist(joint, bodies[part.parent], Transform3D(Basis(), part.joint - parent_position), bodies[j], Transform3D(Basis(), part.joint - part.position));
+			ps->cone_twist_joint_set_param(joint, PhysicsServer3D::CONE_TWIST_JOINT_SWING_SPAN, Math::deg_to_rad(45.0));
+			ps->cone_twist_joint_set_param(joint, PhysicsServer3D::CONE_TWIST_JOINT_TWIST_SPAN, Math::deg_to_rad(30.0));
+			scene.rids.push_back(joint);
+		}
+	}
+	return step_and_free(scene);
+}
+
+TEST_CASE("[SceneTree][Benchmark] Physics CPU time" * doctest::skip()) {
+	Array results;
+
+	Dictionary box_piles;
+	box_piles["name"] = "box_piles_64x8";
+	box_piles["step_msec"] = benchmark_box_piles(64, 8, false);
+	box_piles["step_packed_solver_bodies_msec"] = benchmark_box_piles(64, 8, true);
+	results.push_back(box_piles);
+
+	Dictionary ragdolls;
+	ragdolls["name"] = "ragdolls_128";
+	ragdolls["step_msec"] = benchmark_ragdolls(128, false);
+	ragdolls["step_packed_solver_bodies_msec"] = benchmark_ragdolls(128, true);
+	results.push_back(ragdolls);
+
+	Dictionary report;
+	report["benchmark"] = "physics";
+	report["physics_engine"] = GLOBAL_GET("physics/3d/physics_engine");
+	report["results"] = results;
+	REQUIRE_MESSAGE(TestUtils::write_benchmark_report("physics", report), "Couldn't write the benchmark results file.");
+}
+
+} // namespace TestPhysicsBenchmark
+
+#endif // PHYSICS_3D_DISABLED
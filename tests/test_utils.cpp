@@ -32,6 +32,8 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/io/json.h"
 #include "core/os/os.h"
 
 String TestUtils::get_data_path(const String &p_file) {
@@ -49,6 +51,29 @@ String TestUtils::get_temp_path(const String &p_suffix) {
 	return temp_base.path_join(p_suffix);
 }
 
+bool TestUtils::write_benchmark_report(const String &p_name, const Dictionary &p_report) {
+	const String json = JSON::stringify(p_report, "\t", false);
+	print_line(json);
+
+	const String option = "--benchmark-" + p_name + "-file";
+	const List<String> args = OS::get_singleton()->get_cmdline_args();
+	for (List<String>::ConstIterator itr = args.begin(); itr != args.end(); ++itr) {
+		if (*itr == option) {
+			++itr;
+			if (itr == args.end()) {
+				return false;
+			}
+			Ref<FileAccess> f = FileAccess::open(*itr, FileAccess::WRITE);
+			if (f.is_null()) {
+				return false;
+			}
+			f->store_string(json);
+			return true;
+		}
+	}
+	return true;
+}
+
 String &TestProjectSettingsInternalsAccessor::resource_path() {
 	return ProjectSettings::get_singleton()->resource_path;
 }
@@ -30,6 +30,7 @@
 
 #pragma once
 
+class Dictionary;
 class String;
 
 namespace TestUtils {
@@ -37,6 +38,10 @@ namespace TestUtils {
 String get_data_path(const String &p_file);
 String get_executable_dir();
 String get_temp_path(const String &p_suffix);
+
+// Prints a benchmark report as JSON, and also writes it to the path given with
+// `--benchmark-<p_name>-file`, if any. Returns false if that file can't be written.
+bool write_benchmark_report(const String &p_name, const Dictionary &p_report);
 } // namespace TestUtils
 
 // FIXME: This was originally constrained to `tests/core/config/test_project_settings.h`, but that